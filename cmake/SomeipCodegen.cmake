@@ -0,0 +1,45 @@
+################################################################################
+# Copyright (c) 2025 Vinicius Tadeu Zein
+#
+# See the NOTICE file(s) distributed with this work for additional
+# information regarding copyright ownership.
+#
+# This program and the accompanying materials are made available under the
+# terms of the Apache License Version 2.0 which is available at
+# https://www.apache.org/licenses/LICENSE-2.0
+#
+# SPDX-License-Identifier: Apache-2.0
+################################################################################
+
+# Interface code generation (tools/codegen/someip_codegen.py)
+#
+#   someip_generate_interface(<target> <idl.json>)
+#
+# Generates <binary dir>/generated/<idl name>.h at build time, regenerating
+# it when the description or the generator changes, and adds the directory
+# to the target's include path.
+
+find_package(Python3 COMPONENTS Interpreter QUIET)
+
+set(SOMEIP_CODEGEN ${CMAKE_CURRENT_LIST_DIR}/../tools/codegen/someip_codegen.py)
+
+function(someip_generate_interface TARGET IDL)
+    if(NOT Python3_Interpreter_FOUND)
+        message(FATAL_ERROR "someip_generate_interface: Python 3 is required to generate ${IDL}")
+    endif()
+
+    get_filename_component(IDL_PATH ${IDL} ABSOLUTE)
+    get_filename_component(IDL_NAME ${IDL} NAME_WE)
+    set(OUTPUT_DIR ${CMAKE_CURRENT_BINARY_DIR}/generated)
+    set(HEADER ${OUTPUT_DIR}/${IDL_NAME}.h)
+
+    add_custom_command(
+        OUTPUT ${HEADER}
+        COMMAND ${Python3_EXECUTABLE} ${SOMEIP_CODEGEN} ${IDL_PATH} -o ${HEADER}
+        DEPENDS ${IDL_PATH} ${SOMEIP_CODEGEN}
+        COMMENT "Generating SOME/IP interface ${IDL_NAME}.h"
+        VERBATIM
+    )
+    target_sources(${TARGET} PRIVATE ${HEADER})
+    target_include_directories(${TARGET} PRIVATE ${OUTPUT_DIR})
+endfunction()
@@ -83,21 +83,21 @@ public:
     bool initialize() {
         // Register method handlers
         server_.register_method(PROCESS_VEHICLE_DATA_METHOD_ID, [this](uint16_t client_id, uint16_t session_id,
-                                                                       const std::vector<uint8_t>& input,
+                                                                       PayloadView input,
                                                                        std::vector<uint8_t>& output) -> RpcResult {
-            return handle_process_vehicle_data(client_id, session_id, input, output);
+            return handle_process_vehicle_data(client_id, session_id, input.to_vector(), output);
         });
 
         server_.register_method(GET_SENSOR_ARRAY_METHOD_ID, [this](uint16_t client_id, uint16_t session_id,
-                                                                  const std::vector<uint8_t>& input,
+                                                                  PayloadView input,
                                                                   std::vector<uint8_t>& output) -> RpcResult {
-            return handle_get_sensor_array(client_id, session_id, input, output);
+            return handle_get_sensor_array(client_id, session_id, input.to_vector(), output);
         });
 
         server_.register_method(ECHO_COMPLEX_STRUCT_METHOD_ID, [this](uint16_t client_id, uint16_t session_id,
-                                                                     const std::vector<uint8_t>& input,
+                                                                     PayloadView input,
                                                                      std::vector<uint8_t>& output) -> RpcResult {
-            return handle_echo_complex_struct(client_id, session_id, input, output);
+            return handle_echo_complex_struct(client_id, session_id, input.to_vector(), output);
         });
 
         if (!server_.initialize()) {
@@ -73,21 +73,21 @@ public:
 
         // Register method handlers
         server_.register_method(SEND_LARGE_DATA_METHOD_ID, [this](uint16_t client_id, uint16_t session_id,
-                                                                 const std::vector<uint8_t>& input,
+                                                                 PayloadView input,
                                                                  std::vector<uint8_t>& output) -> RpcResult {
-            return handle_send_large_data(client_id, session_id, input, output);
+            return handle_send_large_data(client_id, session_id, input.to_vector(), output);
         });
 
         server_.register_method(RECEIVE_LARGE_DATA_METHOD_ID, [this](uint16_t client_id, uint16_t session_id,
-                                                                    const std::vector<uint8_t>& input,
+                                                                    PayloadView input,
                                                                     std::vector<uint8_t>& output) -> RpcResult {
-            return handle_receive_large_data(client_id, session_id, input, output);
+            return handle_receive_large_data(client_id, session_id, input.to_vector(), output);
         });
 
         server_.register_method(ECHO_LARGE_DATA_METHOD_ID, [this](uint16_t client_id, uint16_t session_id,
-                                                                const std::vector<uint8_t>& input,
+                                                                PayloadView input,
                                                                 std::vector<uint8_t>& output) -> RpcResult {
-            return handle_echo_large_data(client_id, session_id, input, output);
+            return handle_echo_large_data(client_id, session_id, input.to_vector(), output);
         });
 
         if (!server_.initialize()) {
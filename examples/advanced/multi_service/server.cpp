@@ -186,26 +186,26 @@ private:
     bool initialize_calculator_service() {
         calculator_server_.register_method(CALC_ADD_METHOD_ID,
             [this](uint16_t client_id, uint16_t session_id,
-                   const std::vector<uint8_t>& input, std::vector<uint8_t>& output) -> RpcResult {
-                return handle_calculator_op(client_id, session_id, input, output, "ADD", [](int32_t a, int32_t b) { return a + b; });
+                   PayloadView input, std::vector<uint8_t>& output) -> RpcResult {
+                return handle_calculator_op(client_id, session_id, input.to_vector(), output, "ADD", [](int32_t a, int32_t b) { return a + b; });
             });
 
         calculator_server_.register_method(CALC_SUBTRACT_METHOD_ID,
             [this](uint16_t client_id, uint16_t session_id,
-                   const std::vector<uint8_t>& input, std::vector<uint8_t>& output) -> RpcResult {
-                return handle_calculator_op(client_id, session_id, input, output, "SUBTRACT", [](int32_t a, int32_t b) { return a - b; });
+                   PayloadView input, std::vector<uint8_t>& output) -> RpcResult {
+                return handle_calculator_op(client_id, session_id, input.to_vector(), output, "SUBTRACT", [](int32_t a, int32_t b) { return a - b; });
             });
 
         calculator_server_.register_method(CALC_MULTIPLY_METHOD_ID,
             [this](uint16_t client_id, uint16_t session_id,
-                   const std::vector<uint8_t>& input, std::vector<uint8_t>& output) -> RpcResult {
-                return handle_calculator_op(client_id, session_id, input, output, "MULTIPLY", [](int32_t a, int32_t b) { return a * b; });
+                   PayloadView input, std::vector<uint8_t>& output) -> RpcResult {
+                return handle_calculator_op(client_id, session_id, input.to_vector(), output, "MULTIPLY", [](int32_t a, int32_t b) { return a * b; });
             });
 
         calculator_server_.register_method(CALC_DIVIDE_METHOD_ID,
             [this](uint16_t client_id, uint16_t session_id,
-                   const std::vector<uint8_t>& input, std::vector<uint8_t>& output) -> RpcResult {
-                return handle_calculator_op(client_id, session_id, input, output, "DIVIDE",
+                   PayloadView input, std::vector<uint8_t>& output) -> RpcResult {
+                return handle_calculator_op(client_id, session_id, input.to_vector(), output, "DIVIDE",
                     [](int32_t a, int32_t b) -> int32_t {
                         if (b == 0) throw std::runtime_error("Division by zero");
                         return a / b;
@@ -214,8 +214,8 @@ private:
 
         calculator_server_.register_method(CALC_GET_HISTORY_METHOD_ID,
             [this](uint16_t client_id, uint16_t session_id,
-                   const std::vector<uint8_t>& input, std::vector<uint8_t>& output) -> RpcResult {
-                return handle_get_calc_history(client_id, session_id, input, output);
+                   PayloadView input, std::vector<uint8_t>& output) -> RpcResult {
+                return handle_get_calc_history(client_id, session_id, input.to_vector(), output);
             });
 
         return calculator_server_.initialize();
@@ -285,32 +285,32 @@ private:
     bool initialize_filesystem_service() {
         filesystem_server_.register_method(FS_LIST_DIR_METHOD_ID,
             [this](uint16_t client_id, uint16_t session_id,
-                   const std::vector<uint8_t>& input, std::vector<uint8_t>& output) -> RpcResult {
-                return handle_list_dir(client_id, session_id, input, output);
+                   PayloadView input, std::vector<uint8_t>& output) -> RpcResult {
+                return handle_list_dir(client_id, session_id, input.to_vector(), output);
             });
 
         filesystem_server_.register_method(FS_READ_FILE_METHOD_ID,
             [this](uint16_t client_id, uint16_t session_id,
-                   const std::vector<uint8_t>& input, std::vector<uint8_t>& output) -> RpcResult {
-                return handle_read_file(client_id, session_id, input, output);
+                   PayloadView input, std::vector<uint8_t>& output) -> RpcResult {
+                return handle_read_file(client_id, session_id, input.to_vector(), output);
             });
 
         filesystem_server_.register_method(FS_WRITE_FILE_METHOD_ID,
             [this](uint16_t client_id, uint16_t session_id,
-                   const std::vector<uint8_t>& input, std::vector<uint8_t>& output) -> RpcResult {
-                return handle_write_file(client_id, session_id, input, output);
+                   PayloadView input, std::vector<uint8_t>& output) -> RpcResult {
+                return handle_write_file(client_id, session_id, input.to_vector(), output);
             });
 
         filesystem_server_.register_method(FS_DELETE_FILE_METHOD_ID,
             [this](uint16_t client_id, uint16_t session_id,
-                   const std::vector<uint8_t>& input, std::vector<uint8_t>& output) -> RpcResult {
-                return handle_delete_file(client_id, session_id, input, output);
+                   PayloadView input, std::vector<uint8_t>& output) -> RpcResult {
+                return handle_delete_file(client_id, session_id, input.to_vector(), output);
             });
 
         filesystem_server_.register_method(FS_GET_FILE_INFO_METHOD_ID,
             [this](uint16_t client_id, uint16_t session_id,
-                   const std::vector<uint8_t>& input, std::vector<uint8_t>& output) -> RpcResult {
-                return handle_get_file_info(client_id, session_id, input, output);
+                   PayloadView input, std::vector<uint8_t>& output) -> RpcResult {
+                return handle_get_file_info(client_id, session_id, input.to_vector(), output);
             });
 
         // Initialize with some sample files
@@ -441,20 +441,20 @@ private:
     bool initialize_sensor_service() {
         sensor_server_.register_method(SENSOR_GET_READINGS_METHOD_ID,
             [this](uint16_t client_id, uint16_t session_id,
-                   const std::vector<uint8_t>& input, std::vector<uint8_t>& output) -> RpcResult {
-                return handle_get_sensor_readings(client_id, session_id, input, output);
+                   PayloadView input, std::vector<uint8_t>& output) -> RpcResult {
+                return handle_get_sensor_readings(client_id, session_id, input.to_vector(), output);
             });
 
         sensor_server_.register_method(SENSOR_SET_CONFIG_METHOD_ID,
             [this](uint16_t client_id, uint16_t session_id,
-                   const std::vector<uint8_t>& input, std::vector<uint8_t>& output) -> RpcResult {
-                return handle_set_sensor_config(client_id, session_id, input, output);
+                   PayloadView input, std::vector<uint8_t>& output) -> RpcResult {
+                return handle_set_sensor_config(client_id, session_id, input.to_vector(), output);
             });
 
         sensor_server_.register_method(SENSOR_CALIBRATE_METHOD_ID,
             [this](uint16_t client_id, uint16_t session_id,
-                   const std::vector<uint8_t>& input, std::vector<uint8_t>& output) -> RpcResult {
-                return handle_calibrate_sensor(client_id, session_id, input, output);
+                   PayloadView input, std::vector<uint8_t>& output) -> RpcResult {
+                return handle_calibrate_sensor(client_id, session_id, input.to_vector(), output);
             });
 
         // Initialize sensor publisher
@@ -621,26 +621,26 @@ private:
     bool initialize_system_service() {
         system_server_.register_method(SYS_GET_INFO_METHOD_ID,
             [this](uint16_t client_id, uint16_t session_id,
-                   const std::vector<uint8_t>& input, std::vector<uint8_t>& output) -> RpcResult {
-                return handle_get_system_info(client_id, session_id, input, output);
+                   PayloadView input, std::vector<uint8_t>& output) -> RpcResult {
+                return handle_get_system_info(client_id, session_id, input.to_vector(), output);
             });
 
         system_server_.register_method(SYS_GET_LOAD_METHOD_ID,
             [this](uint16_t client_id, uint16_t session_id,
-                   const std::vector<uint8_t>& input, std::vector<uint8_t>& output) -> RpcResult {
-                return handle_get_system_load(client_id, session_id, input, output);
+                   PayloadView input, std::vector<uint8_t>& output) -> RpcResult {
+                return handle_get_system_load(client_id, session_id, input.to_vector(), output);
             });
 
         system_server_.register_method(SYS_SHUTDOWN_METHOD_ID,
             [this](uint16_t client_id, uint16_t session_id,
-                   const std::vector<uint8_t>& input, std::vector<uint8_t>& output) -> RpcResult {
-                return handle_system_shutdown(client_id, session_id, input, output);
+                   PayloadView input, std::vector<uint8_t>& output) -> RpcResult {
+                return handle_system_shutdown(client_id, session_id, input.to_vector(), output);
             });
 
         system_server_.register_method(SYS_RESTART_METHOD_ID,
             [this](uint16_t client_id, uint16_t session_id,
-                   const std::vector<uint8_t>& input, std::vector<uint8_t>& output) -> RpcResult {
-                return handle_system_restart(client_id, session_id, input, output);
+                   PayloadView input, std::vector<uint8_t>& output) -> RpcResult {
+                return handle_system_restart(client_id, session_id, input.to_vector(), output);
             });
 
         return system_server_.initialize();
@@ -56,21 +56,21 @@ public:
     bool initialize() {
         // Register method handlers
         server_.register_method(ADD_METHOD_ID, [this](uint16_t client_id, uint16_t session_id,
-                                                     const std::vector<uint8_t>& input,
+                                                     PayloadView input,
                                                      std::vector<uint8_t>& output) -> RpcResult {
-            return handle_add(client_id, session_id, input, output);
+            return handle_add(client_id, session_id, input.to_vector(), output);
         });
 
         server_.register_method(MULTIPLY_METHOD_ID, [this](uint16_t client_id, uint16_t session_id,
-                                                          const std::vector<uint8_t>& input,
+                                                          PayloadView input,
                                                           std::vector<uint8_t>& output) -> RpcResult {
-            return handle_multiply(client_id, session_id, input, output);
+            return handle_multiply(client_id, session_id, input.to_vector(), output);
         });
 
         server_.register_method(GET_STATS_METHOD_ID, [this](uint16_t client_id, uint16_t session_id,
-                                                           const std::vector<uint8_t>& input,
+                                                           PayloadView input,
                                                            std::vector<uint8_t>& output) -> RpcResult {
-            return handle_get_stats(client_id, session_id, input, output);
+            return handle_get_stats(client_id, session_id, input.to_vector(), output);
         });
 
         if (!server_.initialize()) {
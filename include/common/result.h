@@ -73,6 +73,7 @@ enum class Result : uint8_t {
     INTERNAL_ERROR = 0x63,
     NOT_INITIALIZED = 0x64,
     INVALID_STATE = 0x65,
+    WOULD_BLOCK = 0x66,
 
     // Unknown/undefined
     UNKNOWN_ERROR = 0xFF
@@ -14,10 +14,10 @@
 #ifndef SOMEIP_CORE_SESSION_MANAGER_H
 #define SOMEIP_CORE_SESSION_MANAGER_H
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
-#include <unordered_map>
-#include <mutex>
 #include <chrono>
 
 namespace someip {
@@ -55,21 +55,65 @@ struct Session {
     }
 };
 
-// Forward declaration
-class SessionManager;
+/**
+ * @brief Lock-free SOME/IP session ID counter
+ *
+ * Hands out session IDs 1..0xFFFF in order and wraps around, skipping 0 as
+ * required for request/response sessions. Safe to call from any thread.
+ * One allocator is typically used per client, or per (client, method) when
+ * session IDs are tracked per method.
+ */
+class SessionIdAllocator {
+public:
+    static constexpr uint16_t FIRST_SESSION_ID = 1;
+
+    explicit SessionIdAllocator(uint16_t first = FIRST_SESSION_ID) noexcept
+        : next_(first == 0 ? FIRST_SESSION_ID : first) {}
+
+    /**
+     * @brief Get the next session ID (never 0)
+     */
+    uint16_t next() noexcept {
+        uint16_t current = next_.load(std::memory_order_relaxed);
+        while (!next_.compare_exchange_weak(current, successor(current), std::memory_order_relaxed)) {
+        }
+        return current;
+    }
+
+    /**
+     * @brief Peek at the ID the next call to next() will return
+     */
+    uint16_t peek() const noexcept { return next_.load(std::memory_order_relaxed); }
+
+    static constexpr uint16_t successor(uint16_t id) noexcept {
+        return id == 0xFFFF ? FIRST_SESSION_ID : static_cast<uint16_t>(id + 1);
+    }
+
+private:
+    std::atomic<uint16_t> next_;
+};
 
 /**
  * @brief Session manager for managing client sessions
  *
  * This class manages client sessions for SOME/IP communication,
  * ensuring unique session IDs and proper session lifecycle.
+ *
+ * Session IDs come from a lock-free SessionIdAllocator. When tracking is
+ * enabled, in-flight sessions are kept in a fixed array indexed by session
+ * ID, so create/remove/validate are O(1) and lock-free, and an ID is not
+ * handed out again until it has been removed. Sessions must be removed when
+ * the exchange completes. Without tracking the manager is a plain counter.
  */
 class SessionManager {
 public:
+    static constexpr size_t SESSION_SLOTS = 0x10000;
+
     /**
      * @brief Constructor
+     * @param track_sessions Keep per-session state (about 1 MiB)
      */
-    SessionManager();
+    explicit SessionManager(bool track_sessions = true);
 
     /**
      * @brief Destructor
@@ -79,19 +123,19 @@ public:
     /**
      * @brief Create a new session for a client
      * @param client_id The client ID
-     * @return New session ID
+     * @return New session ID, or 0 if all session IDs are in use
      */
     uint16_t create_session(uint16_t client_id);
 
     /**
      * @brief Get session information
      * @param session_id The session ID to look up
-     * @return Pointer to session or nullptr if not found
+     * @return Snapshot of the session or nullptr if not found
      */
-    std::shared_ptr<Session> get_session(uint16_t session_id);
+    std::shared_ptr<Session> get_session(uint16_t session_id) const;
 
     /**
-     * @brief Remove a session
+     * @brief Remove a session, making its ID available again
      * @param session_id The session ID to remove
      */
     void remove_session(uint16_t session_id);
@@ -101,7 +145,7 @@ public:
      * @param session_id The session ID to validate
      * @return true if session is valid and active
      */
-    bool validate_session(uint16_t session_id);
+    bool validate_session(uint16_t session_id) const;
 
     /**
      * @brief Update session activity timestamp
@@ -117,9 +161,8 @@ public:
     size_t cleanup_expired_sessions(std::chrono::seconds timeout);
 
     /**
-     * @brief Get the next available session ID
-     * @param client_id The client ID
-     * @return Next available session ID for the client
+     * @brief Get the next session ID without tracking it
+     * @return Next session ID (never 0)
      */
     uint16_t get_next_session_id();
 
@@ -129,10 +172,24 @@ public:
      */
     size_t get_active_session_count() const;
 
+    /**
+     * @brief Check whether sessions are tracked
+     */
+    bool is_tracking() const { return slots_ != nullptr; }
+
 private:
-    std::unordered_map<uint16_t, std::shared_ptr<Session>> sessions_;
-    mutable std::mutex sessions_mutex_;
-    uint16_t next_session_id_{1};
+    struct Slot {
+        std::atomic<uint32_t> owner{0};             // 0 = free, else ACTIVE_FLAG | client ID
+        std::atomic<int64_t> last_activity{0};      // steady_clock ticks
+    };
+
+    static constexpr uint32_t ACTIVE_FLAG = 0x10000;
+
+    static int64_t now_ticks();
+
+    SessionIdAllocator allocator_;
+    std::unique_ptr<Slot[]> slots_;
+    std::atomic<size_t> active_count_{0};
 
     // Prevent copying
     SessionManager(const SessionManager&) = delete;
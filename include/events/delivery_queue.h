@@ -0,0 +1,74 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_EVENTS_DELIVERY_QUEUE_H
+#define SOMEIP_EVENTS_DELIVERY_QUEUE_H
+
+#include "event_types.h"
+#include <memory>
+#include <thread>
+
+namespace someip {
+namespace events {
+
+/**
+ * @brief Decouples a slow notification callback from the receive thread
+ *
+ * push() never blocks: in LATEST_VALUE mode a newer sample replaces a
+ * pending one of the same event ID, in BOUNDED_QUEUE mode the oldest
+ * pending sample is dropped when the queue is full. A consumer thread
+ * invokes the callback at its own pace.
+ *
+ * The queue may be destroyed from inside its own callback (e.g. when the
+ * callback unsubscribes): the consumer thread is then detached and exits
+ * once the callback returns, keeping the state it uses alive until then.
+ */
+class EventDeliveryQueue {
+public:
+    EventDeliveryQueue(const DeliveryConfig& config, EventNotificationCallback callback);
+
+    /**
+     * @brief Destructor; drops pending samples and waits for a running callback
+     *
+     * Does not wait when called from the callback itself.
+     */
+    ~EventDeliveryQueue();
+
+    EventDeliveryQueue(const EventDeliveryQueue&) = delete;
+    EventDeliveryQueue& operator=(const EventDeliveryQueue&) = delete;
+
+    /**
+     * @brief Hand a notification to the consumer thread
+     */
+    void push(EventNotification notification);
+
+    size_t get_pending() const;
+
+    /**
+     * @brief Get the number of samples replaced or dropped before delivery
+     */
+    uint64_t get_dropped() const;
+
+private:
+    struct State;
+
+    static void consume_loop(std::shared_ptr<State> state);
+
+    std::shared_ptr<State> state_;      // Shared with the consumer thread
+    std::thread consumer_;
+};
+
+} // namespace events
+} // namespace someip
+
+#endif // SOMEIP_EVENTS_DELIVERY_QUEUE_H
@@ -15,10 +15,16 @@
 #define SOMEIP_EVENTS_PUBLISHER_H
 
 #include "event_types.h"
+#include "event_sample.h"
 #include <memory>
 #include <vector>
 
 namespace someip {
+
+namespace rpc {
+class ServerRuntime;
+} // namespace rpc
+
 namespace events {
 
 /**
@@ -41,6 +47,20 @@ public:
      */
     EventPublisher(uint16_t service_id, uint16_t instance_id);
 
+    /**
+     * @brief Constructor for publishing from a shared endpoint
+     *
+     * Notifications are sent from the runtime's endpoint, so publishers of
+     * many services need no socket of their own. The runtime is started if
+     * needed but is never stopped by the publisher.
+     *
+     * @param service_id Service identifier
+     * @param instance_id Service instance identifier
+     * @param runtime Shared server runtime
+     */
+    EventPublisher(uint16_t service_id, uint16_t instance_id,
+                   std::shared_ptr<rpc::ServerRuntime> runtime);
+
     /**
      * @brief Destructor
      */
@@ -97,6 +117,28 @@ public:
      */
     bool publish_event(uint16_t event_id, const std::vector<uint8_t>& data);
 
+    /**
+     * @brief Loan a sample to write an event payload in place
+     *
+     * The payload follows a pre-built SOME/IP header in a pooled buffer;
+     * pass the sample to publish() to send it without further copies.
+     *
+     * @param event_id Event identifier
+     * @param size Payload size in bytes
+     * @return The sample, or an invalid sample if the event is not registered
+     */
+    EventSample loan(uint16_t event_id, size_t size);
+
+    /**
+     * @brief Publish a loaned sample to the subscribers of its event
+     *
+     * The buffer returns to the pool once sent.
+     *
+     * @param sample Sample obtained from loan() of this publisher
+     * @return true if published successfully, false on error
+     */
+    bool publish(EventSample sample);
+
     /**
      * @brief Publish a field notification (immediate update)
      *
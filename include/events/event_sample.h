@@ -0,0 +1,113 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_EVENTS_EVENT_SAMPLE_H
+#define SOMEIP_EVENTS_EVENT_SAMPLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace someip {
+namespace events {
+
+class EventPublisherImpl;
+
+/**
+ * @brief Free list of sample buffers shared by a publisher and its samples
+ *
+ * Buffers keep their capacity, so a steady stream of samples of similar
+ * size is published without heap allocations. Thread-safe.
+ */
+class EventSamplePool {
+public:
+    explicit EventSamplePool(size_t max_cached = 16);
+
+    /**
+     * @brief Get a buffer of the given size, reusing a cached one if possible
+     */
+    std::vector<uint8_t> acquire(size_t size);
+
+    /**
+     * @brief Return a buffer to the pool (dropped if the pool is full)
+     */
+    void release(std::vector<uint8_t> buffer);
+
+    size_t get_cached() const;
+
+private:
+    std::vector<std::vector<uint8_t>> free_;
+    size_t max_cached_;
+    mutable std::mutex mutex_;
+};
+
+/**
+ * @brief Event payload loaned from a publisher
+ *
+ * The payload is written in place right after a pre-built SOME/IP header,
+ * so publishing sends the buffer as it is. Move-only; a sample that is not
+ * published returns its buffer to the pool when destroyed.
+ */
+class EventSample {
+public:
+    static constexpr size_t HEADER_SIZE = 16;   // SOME/IP header preceding the payload
+
+    EventSample() = default;
+    ~EventSample();
+
+    EventSample(EventSample&& other) noexcept;
+    EventSample& operator=(EventSample&& other) noexcept;
+    EventSample(const EventSample&) = delete;
+    EventSample& operator=(const EventSample&) = delete;
+
+    /**
+     * @brief Writable payload, or nullptr if the sample is not valid
+     */
+    uint8_t* data() { return is_valid() ? buffer_.data() + HEADER_SIZE : nullptr; }
+    const uint8_t* data() const { return is_valid() ? buffer_.data() + HEADER_SIZE : nullptr; }
+
+    /**
+     * @brief Payload size in bytes
+     */
+    size_t size() const { return buffer_.empty() ? 0 : buffer_.size() - HEADER_SIZE; }
+
+    /**
+     * @brief Change the payload size (e.g. after encoding a variable-size value)
+     */
+    void resize(size_t size);
+
+    uint16_t get_event_id() const { return event_id_; }
+
+    /**
+     * @brief Check if the loan succeeded
+     */
+    bool is_valid() const { return !buffer_.empty(); }
+    explicit operator bool() const { return is_valid(); }
+
+private:
+    friend class EventPublisherImpl;
+
+    EventSample(std::shared_ptr<EventSamplePool> pool, std::vector<uint8_t> buffer, uint16_t event_id);
+    void release();
+
+    std::shared_ptr<EventSamplePool> pool_;
+    std::vector<uint8_t> buffer_;               // SOME/IP header followed by the payload
+    uint16_t event_id_{0};
+};
+
+} // namespace events
+} // namespace someip
+
+#endif // SOMEIP_EVENTS_EVENT_SAMPLE_H
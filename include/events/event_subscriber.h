@@ -71,12 +71,16 @@ public:
      * @param notification_callback Callback for event notifications
      * @param status_callback Callback for subscription status changes
      * @param filters Optional filters for selective notifications
+     * @param delivery How notifications reach the callback; LATEST_VALUE and
+     *        BOUNDED_QUEUE run it on a consumer thread of the subscription so
+     *        a slow callback never holds up the receive thread
      * @return true if subscription request sent, false on error
      */
     bool subscribe_eventgroup(uint16_t service_id, uint16_t instance_id, uint16_t eventgroup_id,
                             EventNotificationCallback notification_callback,
                             SubscriptionStatusCallback status_callback = nullptr,
-                            const std::vector<EventFilter>& filters = {});
+                            const std::vector<EventFilter>& filters = {},
+                            const DeliveryConfig& delivery = DeliveryConfig());
 
     /**
      * @brief Unsubscribe from an event group
@@ -136,6 +136,23 @@ struct EventFilter {
 using EventNotificationCallback = std::function<void(const EventNotification&)>;
 using SubscriptionStatusCallback = std::function<void(uint16_t event_id, SubscriptionState state)>;
 
+/**
+ * @brief How notifications of a subscription reach its callback
+ */
+enum class DeliveryMode : uint8_t {
+    IMMEDIATE,      // Callback runs on the receive thread
+    LATEST_VALUE,   // Consumer thread; only the newest sample per event ID is kept
+    BOUNDED_QUEUE   // Consumer thread; up to queue_depth samples, the oldest is dropped
+};
+
+/**
+ * @brief Notification delivery configuration of a subscription
+ */
+struct DeliveryConfig {
+    DeliveryMode mode{DeliveryMode::IMMEDIATE};
+    size_t queue_depth{16};                 // BOUNDED_QUEUE capacity
+};
+
 /**
  * @brief Event publication policies
  */
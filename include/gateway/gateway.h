@@ -0,0 +1,143 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_GATEWAY_GATEWAY_H
+#define SOMEIP_GATEWAY_GATEWAY_H
+
+#include "common/result.h"
+#include "transport/endpoint.h"
+#include "transport/transport.h"
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace someip {
+namespace gateway {
+
+constexpr uint16_t ANY_INSTANCE = 0xFFFF;
+constexpr uint16_t ANY_METHOD = 0xFFFF;
+
+/**
+ * @brief Forwarding rule
+ *
+ * SOME/IP headers carry no instance ID, so the instance of a message is the
+ * one its ingress interface was registered for.
+ */
+struct Route {
+    uint16_t service_id{0};
+    uint16_t instance_id{ANY_INSTANCE};     // Instance of the ingress interface
+    uint16_t method_id{ANY_METHOD};         // Method or event ID
+    std::string egress;                     // Interface the message leaves on
+    transport::Endpoint destination;        // Ignored by connected (TCP) egress interfaces
+};
+
+/**
+ * @brief Gateway configuration
+ */
+struct GatewayConfig {
+    size_t max_pending_requests{4096};                  // Proxied requests awaiting a response
+    std::chrono::milliseconds request_timeout{5000};    // Unanswered requests are forgotten after this
+    uint16_t client_id{0x7FFF};                         // Client ID of proxied requests
+};
+
+class GatewayImpl;
+
+/**
+ * @brief SOME/IP routing gateway
+ *
+ * Receives on a set of named transports and forwards by a flat
+ * (service, instance, method) routing table. Requests are proxied: their
+ * client/session IDs are replaced so the response can be routed back to the
+ * original sender, then restored; the TP segments of one request (same
+ * ingress, sender, message ID and request ID) share one gateway session ID
+ * and one pending entry, which the segments of a TP response (0xA0/0xA1)
+ * keep until the last one. Notifications and fire-and-forget requests
+ * are forwarded unchanged. The received message object is forwarded
+ * without being rebuilt, but the egress transport serializes it, so each
+ * hop copies the payload once into the outgoing buffer. Translation
+ * between UDP and TCP falls out of sending on a transport of the other
+ * kind.
+ */
+class Gateway {
+public:
+    struct Statistics {
+        uint64_t forwarded_requests{0};
+        uint64_t forwarded_notifications{0};
+        uint64_t routed_responses{0};
+        uint64_t dropped_no_route{0};
+        uint64_t dropped_unmatched_responses{0};
+        uint64_t dropped_pending_full{0};
+        uint64_t timed_out_requests{0};
+        uint64_t send_failures{0};
+    };
+
+    explicit Gateway(const GatewayConfig& config = GatewayConfig());
+    ~Gateway();
+
+    Gateway(const Gateway&) = delete;
+    Gateway& operator=(const Gateway&) = delete;
+    Gateway(Gateway&&) = delete;
+    Gateway& operator=(Gateway&&) = delete;
+
+    /**
+     * @brief Attach a transport; must be called before start()
+     *
+     * The gateway becomes the transport's listener. Connection-oriented
+     * transports must already be initialized (and connected, for egress).
+     *
+     * @param name Interface name used by routes
+     * @param transport Transport to receive on and send over
+     * @param instance_id Instance addressed by requests arriving here
+     * @return INVALID_ARGUMENT for a duplicate name, INVALID_STATE once started
+     */
+    Result add_interface(const std::string& name, std::shared_ptr<transport::ITransport> transport,
+                         uint16_t instance_id = ANY_INSTANCE);
+
+    /**
+     * @brief Add a forwarding rule; must be called before start()
+     *
+     * Lookup prefers an exact instance over ANY_INSTANCE and, within that,
+     * an exact method over ANY_METHOD.
+     *
+     * @return INVALID_ARGUMENT for an unknown egress or a duplicate rule
+     */
+    Result add_route(const Route& route);
+
+    /**
+     * @brief Start the transports that are not running yet
+     */
+    Result start();
+
+    /**
+     * @brief Stop all transports and forget outstanding requests
+     */
+    Result stop();
+
+    bool is_running() const;
+
+    /**
+     * @brief Get the number of proxied requests awaiting a response
+     */
+    size_t get_pending_requests() const;
+
+    Statistics get_statistics() const;
+
+private:
+    std::unique_ptr<GatewayImpl> impl_;
+};
+
+} // namespace gateway
+} // namespace someip
+
+#endif // SOMEIP_GATEWAY_GATEWAY_H
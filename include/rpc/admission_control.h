@@ -0,0 +1,146 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_RPC_ADMISSION_CONTROL_H
+#define SOMEIP_RPC_ADMISSION_CONTROL_H
+
+#include "rpc/rpc_types.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+namespace someip {
+namespace rpc {
+
+/**
+ * @brief Token bucket parameters
+ */
+struct RateLimit {
+    double rate{0.0};                       // Requests per second, 0 = unlimited
+    uint32_t burst{10};                     // Requests admitted back to back
+};
+
+/**
+ * @brief Admission control configuration
+ */
+struct AdmissionConfig {
+    RateLimit client_limit;                 // Applied to each client ID
+    std::map<MethodId, RateLimit> method_limits;  // Applied to each client ID per method
+    size_t queue_capacity{1024};            // Requests queued across all clients
+    size_t client_queue_capacity{64};       // Requests queued per client ID
+    uint32_t quantum{512};                  // Bytes a client may dequeue per DRR round
+};
+
+/**
+ * @brief Outcome of an admission request
+ */
+enum class AdmissionResult : uint8_t {
+    ADMITTED,
+    RATE_LIMITED,
+    QUEUE_FULL,
+    CLOSED
+};
+
+/**
+ * @brief Per-client rate limiting and fair queueing in front of handlers
+ *
+ * Requests first pass a token bucket per client ID and, where configured,
+ * one per client ID and method. Admitted requests are queued per client and
+ * dequeued by deficit round robin weighted by request size, so a client that
+ * floods the server only delays its own requests. Thread-safe.
+ */
+class AdmissionController {
+public:
+    using Task = std::function<void()>;
+
+    explicit AdmissionController(const AdmissionConfig& config = AdmissionConfig());
+
+    /**
+     * @brief Rate-limit and queue a request
+     *
+     * @param client_id Client ID of the request
+     * @param method_id Method called
+     * @param cost Request size in bytes (DRR weight)
+     * @param task Work to run once the request is dequeued
+     * @return ADMITTED if the task was queued
+     */
+    AdmissionResult admit(uint16_t client_id, MethodId method_id, uint32_t cost, Task task);
+
+    /**
+     * @brief Dequeue the next request without blocking
+     * @return false if nothing is queued
+     */
+    bool pop(Task& task);
+
+    /**
+     * @brief Dequeue the next request, waiting until one is queued
+     * @return false once close() was called
+     */
+    bool wait_pop(Task& task);
+
+    /**
+     * @brief Reject further requests, drop queued ones and wake waiters
+     */
+    void close();
+
+    /**
+     * @brief Accept requests again after close()
+     */
+    void reopen();
+
+    size_t get_queued() const;
+    uint64_t get_rejected() const;
+
+private:
+    struct Bucket {
+        double tokens{0.0};
+        std::chrono::steady_clock::time_point refilled_at{};
+        bool initialized{false};
+    };
+
+    struct Request {
+        uint32_t cost;
+        Task task;
+    };
+
+    struct Flow {
+        std::deque<Request> requests;
+        uint32_t deficit{0};
+    };
+
+    static bool take_token(Bucket& bucket, const RateLimit& limit,
+                           std::chrono::steady_clock::time_point now);
+    bool pop_locked(Task& task);
+
+    AdmissionConfig config_;
+    std::unordered_map<uint16_t, Bucket> client_buckets_;
+    std::unordered_map<uint32_t, Bucket> method_buckets_;   // client_id << 16 | method_id
+    std::unordered_map<uint16_t, Flow> flows_;
+    std::deque<uint16_t> active_clients_;                   // Clients with queued requests, DRR order
+    size_t queued_{0};
+    uint64_t rejected_{0};
+    bool closed_{false};
+    mutable std::mutex mutex_;
+    std::condition_variable queue_cv_;
+};
+
+} // namespace rpc
+} // namespace someip
+
+#endif // SOMEIP_RPC_ADMISSION_CONTROL_H
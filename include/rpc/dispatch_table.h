@@ -0,0 +1,267 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_RPC_DISPATCH_TABLE_H
+#define SOMEIP_RPC_DISPATCH_TABLE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace someip {
+namespace rpc {
+
+/**
+ * @brief Lock-free lookup table from a 16-bit ID to a handler
+ *
+ * The table is a 256 x 256 paged array of handler pointers, so a lookup is
+ * two indexed loads. Readers never lock: they pin the current snapshot with
+ * a Reader and call the handler by reference. Writers (register/unregister)
+ * serialize on a mutex, build a new snapshot that shares unchanged pages
+ * with the old one, and publish it with an atomic pointer swap (RCU). Old
+ * snapshots are reclaimed by the next writer, the last reader to leave, or
+ * synchronize(), whichever first sees no reader active.
+ *
+ * Each handler is stored once and kept alive by every snapshot that refers
+ * to it, so a handler may be unregistered while it is running.
+ *
+ * @tparam Handler Callable type stored in the table
+ */
+template <typename Handler>
+class DispatchTable {
+    struct Snapshot;
+
+public:
+    static constexpr size_t PAGE_SIZE = 256;
+
+    /**
+     * @brief Pins the current snapshot for lock-free lookups
+     *
+     * Handler pointers returned by find() stay valid while the reader lives.
+     */
+    class Reader {
+    public:
+        explicit Reader(const DispatchTable& table) noexcept : table_(table) {
+            table_.active_readers_.fetch_add(1, std::memory_order_seq_cst);
+            snapshot_ = table_.current_.load(std::memory_order_seq_cst);
+        }
+
+        ~Reader() {
+            if (table_.active_readers_.fetch_sub(1, std::memory_order_seq_cst) == 1 &&
+                table_.has_retired_.load(std::memory_order_acquire)) {
+                // Last reader out; a writer holding the lock reclaims itself
+                std::unique_lock lock(table_.write_mutex_, std::try_to_lock);
+                if (lock.owns_lock()) {
+                    table_.reclaim();
+                }
+            }
+        }
+
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+
+        /**
+         * @brief Look up a handler
+         * @return Handler, or nullptr if the ID is not registered
+         */
+        const Handler* find(uint16_t id) const noexcept {
+            const Page* page = snapshot_->pages[id >> 8].get();
+            return page ? (*page)[id & 0xFF] : nullptr;
+        }
+
+    private:
+        friend class DispatchTable;
+
+        const DispatchTable& table_;
+        const Snapshot* snapshot_;
+    };
+
+    DispatchTable() : current_(new Snapshot()) {}
+
+    ~DispatchTable() {
+        delete current_.load(std::memory_order_relaxed);
+    }
+
+    DispatchTable(const DispatchTable&) = delete;
+    DispatchTable& operator=(const DispatchTable&) = delete;
+
+    /**
+     * @brief Register a handler
+     * @return true if registered, false if the ID already has a handler
+     */
+    bool insert(uint16_t id, Handler handler) {
+        std::scoped_lock lock(write_mutex_);
+        const Snapshot* old = current_.load(std::memory_order_relaxed);
+        if (lookup(*old, id) != nullptr) {
+            return false;
+        }
+
+        auto stored = std::make_shared<const Handler>(std::move(handler));
+        auto next = std::make_unique<Snapshot>(*old);
+        auto page = copy_page(*next, id);
+        (*page)[id & 0xFF] = stored.get();
+        next->pages[id >> 8] = std::move(page);
+        next->owners.push_back(std::move(stored));
+        ++next->count;
+        publish(std::move(next));
+        return true;
+    }
+
+    /**
+     * @brief Unregister a handler
+     * @return true if removed, false if the ID was not registered
+     */
+    bool erase(uint16_t id) {
+        std::scoped_lock lock(write_mutex_);
+        const Snapshot* old = current_.load(std::memory_order_relaxed);
+        const Handler* handler = lookup(*old, id);
+        if (handler == nullptr) {
+            return false;
+        }
+
+        auto next = std::make_unique<Snapshot>(*old);
+        auto page = copy_page(*next, id);
+        (*page)[id & 0xFF] = nullptr;
+        next->pages[id >> 8] = std::move(page);
+        for (auto it = next->owners.begin(); it != next->owners.end(); ++it) {
+            if (it->get() == handler) {
+                next->owners.erase(it);
+                break;
+            }
+        }
+        --next->count;
+        publish(std::move(next));
+        return true;
+    }
+
+    /**
+     * @brief Remove every handler
+     */
+    void clear() {
+        std::scoped_lock lock(write_mutex_);
+        publish(std::make_unique<Snapshot>());
+    }
+
+    /**
+     * @brief Wait until no reader is active
+     *
+     * After erase() followed by synchronize(), no thread is still running the
+     * erased handler, so state it refers to may be destroyed. Retired
+     * snapshots are reclaimed on the way out. Must not be called while the
+     * calling thread holds a Reader.
+     */
+    void synchronize() const {
+        while (active_readers_.load(std::memory_order_acquire) != 0) {
+            std::this_thread::yield();
+        }
+        std::scoped_lock lock(write_mutex_);
+        reclaim();
+    }
+
+    bool contains(uint16_t id) const {
+        Reader reader(*this);
+        return reader.find(id) != nullptr;
+    }
+
+    size_t size() const {
+        Reader reader(*this);
+        return reader_snapshot(reader).count;
+    }
+
+    /**
+     * @brief Get the registered IDs in ascending order
+     */
+    std::vector<uint16_t> ids() const {
+        std::vector<uint16_t> result;
+        Reader reader(*this);
+        const Snapshot& snapshot = reader_snapshot(reader);
+        for (size_t high = 0; high < PAGE_SIZE; ++high) {
+            const Page* page = snapshot.pages[high].get();
+            if (page == nullptr) {
+                continue;
+            }
+            for (size_t low = 0; low < PAGE_SIZE; ++low) {
+                if ((*page)[low] != nullptr) {
+                    result.push_back(static_cast<uint16_t>((high << 8) | low));
+                }
+            }
+        }
+        return result;
+    }
+
+private:
+    using Page = std::array<const Handler*, PAGE_SIZE>;
+
+    struct Snapshot {
+        std::array<std::shared_ptr<const Page>, PAGE_SIZE> pages{};
+        std::vector<std::shared_ptr<const Handler>> owners;
+        size_t count{0};
+    };
+
+    static const Handler* lookup(const Snapshot& snapshot, uint16_t id) {
+        const Page* page = snapshot.pages[id >> 8].get();
+        return page ? (*page)[id & 0xFF] : nullptr;
+    }
+
+    static std::shared_ptr<Page> copy_page(const Snapshot& snapshot, uint16_t id) {
+        const Page* page = snapshot.pages[id >> 8].get();
+        auto copy = std::make_shared<Page>();
+        if (page != nullptr) {
+            *copy = *page;
+        } else {
+            copy->fill(nullptr);
+        }
+        return copy;
+    }
+
+    static const Snapshot& reader_snapshot(const Reader& reader) { return *reader.snapshot_; }
+
+    /**
+     * @brief Swap in a new snapshot and reclaim old ones if no reader is active
+     * @note Requires write_mutex_
+     */
+    void publish(std::unique_ptr<Snapshot> next) {
+        retired_.emplace_back(current_.exchange(next.release(), std::memory_order_seq_cst));
+        has_retired_.store(true, std::memory_order_release);
+        reclaim();
+    }
+
+    /**
+     * @brief Free the retired snapshots if no reader is active
+     * @note Requires write_mutex_
+     */
+    void reclaim() const {
+        // A reader that starts after a snapshot was retired sees a newer one,
+        // so once the count drops to zero no one can hold a retired one
+        if (active_readers_.load(std::memory_order_seq_cst) == 0) {
+            retired_.clear();
+            has_retired_.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    std::atomic<const Snapshot*> current_;
+    mutable std::atomic<size_t> active_readers_{0};
+    mutable std::atomic<bool> has_retired_{false};                  // retired_ is not empty
+    mutable std::mutex write_mutex_;
+    mutable std::vector<std::unique_ptr<const Snapshot>> retired_;  // Guarded by write_mutex_
+};
+
+} // namespace rpc
+} // namespace someip
+
+#endif // SOMEIP_RPC_DISPATCH_TABLE_H
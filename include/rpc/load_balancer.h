@@ -0,0 +1,141 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_RPC_LOAD_BALANCER_H
+#define SOMEIP_RPC_LOAD_BALANCER_H
+
+#include "transport/endpoint.h"
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <random>
+#include <vector>
+
+namespace someip {
+namespace rpc {
+
+/**
+ * @brief How a request picks one of several service instances
+ */
+enum class LoadBalancingStrategy : uint8_t {
+    ROUND_ROBIN,        // Cycle through the instances
+    LEAST_OUTSTANDING,  // Instance with the fewest requests in flight
+    LATENCY_EWMA        // Better of two random instances by latency EWMA x load
+};
+
+/**
+ * @brief Load balancer configuration
+ */
+struct LoadBalancerConfig {
+    LoadBalancingStrategy strategy{LoadBalancingStrategy::ROUND_ROBIN};
+    uint32_t max_consecutive_failures{3};                   // Eject after this many timeouts in a row
+    std::chrono::milliseconds ejection_duration{10000};     // Time an ejected instance is skipped
+    double latency_ewma_alpha{0.3};                         // Weight of the newest latency sample
+    std::chrono::microseconds latency_prior{1000};          // Estimate when no instance has a sample yet
+    double failure_latency_penalty{2.0};                    // A timeout counts as this many times its wait
+};
+
+/**
+ * @brief Per-service set of instances with request balancing and ejection
+ *
+ * Instances that time out max_consecutive_failures times in a row are
+ * ejected for ejection_duration and then re-admitted. If every instance of
+ * a service is ejected, all of them are used again rather than failing.
+ *
+ * With LATENCY_EWMA, an instance without latency samples is estimated at
+ * the mean of the sampled instances of its service (latency_prior if there
+ * are none), and a timeout is folded into the EWMA as a penalty sample, so
+ * neither new nor unresponsive instances look free.
+ * Thread-safe.
+ */
+class LoadBalancer {
+public:
+    explicit LoadBalancer(const LoadBalancerConfig& config = LoadBalancerConfig());
+
+    /**
+     * @brief Replace the instance set of a service
+     *
+     * Statistics of instances that remain in the set are kept.
+     */
+    void set_instances(uint16_t service_id, const std::vector<transport::Endpoint>& endpoints);
+
+    void add_instance(uint16_t service_id, const transport::Endpoint& endpoint);
+    bool remove_instance(uint16_t service_id, const transport::Endpoint& endpoint);
+    std::vector<transport::Endpoint> get_instances(uint16_t service_id) const;
+
+    /**
+     * @brief Pick the instance for the next request
+     *
+     * Counts the request as outstanding; every successful select() must be
+     * followed by one report_success(), report_failure() or release().
+     *
+     * @param service_id Target service
+     * @param endpoint Selected instance (output)
+     * @return false if the service has no instances
+     */
+    bool select(uint16_t service_id, transport::Endpoint& endpoint);
+
+    /**
+     * @brief Record a response and its latency
+     */
+    void report_success(uint16_t service_id, const transport::Endpoint& endpoint,
+                        std::chrono::microseconds latency);
+
+    /**
+     * @brief Record a request that was not answered in time
+     *
+     * @param waited Time the request waited before it was given up; the
+     *        latency penalty is at least the instance's current estimate
+     */
+    void report_failure(uint16_t service_id, const transport::Endpoint& endpoint,
+                        std::chrono::microseconds waited = std::chrono::microseconds(0));
+
+    /**
+     * @brief Record a request that ended without a verdict (e.g. cancelled)
+     */
+    void release(uint16_t service_id, const transport::Endpoint& endpoint);
+
+    bool is_ejected(uint16_t service_id, const transport::Endpoint& endpoint) const;
+    uint32_t get_outstanding(uint16_t service_id, const transport::Endpoint& endpoint) const;
+
+private:
+    struct Instance {
+        transport::Endpoint endpoint;
+        uint32_t outstanding{0};
+        uint32_t consecutive_failures{0};
+        double latency_ewma_us{0.0};        // 0 = no sample yet
+        std::chrono::steady_clock::time_point ejected_until{};
+    };
+
+    struct Service {
+        std::vector<Instance> instances;
+        size_t next{0};                     // Round-robin position
+    };
+
+    Instance* find(uint16_t service_id, const transport::Endpoint& endpoint);
+    const Instance* find(uint16_t service_id, const transport::Endpoint& endpoint) const;
+    size_t pick(Service& service, const std::vector<size_t>& candidates);
+    double estimate_latency(const Service& service, const Instance& instance) const;
+    void add_latency_sample(Instance& instance, double sample_us);
+
+    LoadBalancerConfig config_;
+    std::map<uint16_t, Service> services_;
+    std::minstd_rand random_;
+    mutable std::mutex mutex_;
+};
+
+} // namespace rpc
+} // namespace someip
+
+#endif // SOMEIP_RPC_LOAD_BALANCER_H
@@ -0,0 +1,110 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_RPC_RESPONSE_CACHE_H
+#define SOMEIP_RPC_RESPONSE_CACHE_H
+
+#include "someip/payload.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace someip {
+namespace rpc {
+
+/**
+ * @brief Response cache configuration
+ */
+struct ResponseCacheConfig {
+    size_t max_entries{256};                    // LRU bound
+    std::chrono::milliseconds ttl{0};           // 0 = keep until invalidated or evicted
+};
+
+/**
+ * @brief Bounded LRU cache of successful method responses
+ *
+ * Entries are keyed by a hash of the request parameters and verified
+ * against the full parameters, so hash collisions never return a wrong
+ * response. Cached payloads share their buffer with every response built
+ * from them. Thread-safe.
+ */
+class ResponseCache {
+public:
+    explicit ResponseCache(const ResponseCacheConfig& config = ResponseCacheConfig());
+
+    /**
+     * @brief Look up the response for a set of parameters
+     * @param params Request parameters
+     * @param response Cached response payload (output)
+     * @return true on a hit
+     */
+    bool lookup(PayloadView params, Payload& response);
+
+    /**
+     * @brief Store the response for a set of parameters
+     *
+     * @param params Request parameters
+     * @param response Response payload
+     * @param generation Value of get_generation() before the response was
+     *        computed; the response is dropped if the cache was cleared since
+     */
+    void store(PayloadView params, Payload response, uint64_t generation);
+
+    /**
+     * @brief Drop every entry
+     */
+    void clear();
+
+    /**
+     * @brief Get the invalidation generation (incremented by clear())
+     */
+    uint64_t get_generation() const;
+
+    size_t size() const;
+    uint64_t get_hits() const;
+    uint64_t get_misses() const;
+
+    /**
+     * @brief Hash request parameters (FNV-1a)
+     */
+    static uint64_t hash(PayloadView params) noexcept;
+
+private:
+    struct Entry {
+        uint64_t key;
+        std::vector<uint8_t> params;
+        Payload response;
+        std::chrono::steady_clock::time_point stored_at;
+    };
+    using EntryList = std::list<Entry>;
+
+    EntryList::iterator find(uint64_t key, PayloadView params);
+    void erase(EntryList::iterator entry);
+
+    ResponseCacheConfig config_;
+    EntryList entries_;                                                 // Most recently used first
+    std::unordered_multimap<uint64_t, EntryList::iterator> index_;
+    uint64_t hits_{0};
+    uint64_t misses_{0};
+    uint64_t generation_{0};
+    mutable std::mutex mutex_;
+};
+
+} // namespace rpc
+} // namespace someip
+
+#endif // SOMEIP_RPC_RESPONSE_CACHE_H
@@ -15,6 +15,7 @@
 #define SOMEIP_RPC_CLIENT_H
 
 #include "rpc/rpc_types.h"
+#include "transport/endpoint.h"
 #include <memory>
 
 namespace someip {
@@ -24,6 +25,7 @@ namespace rpc {
  * @brief Forward declaration
  */
 class RpcClientImpl;
+class LoadBalancer;
 
 /**
  * @brief SOME/IP RPC Client Interface
@@ -89,6 +91,76 @@ public:
                                     RpcCallback callback,
                                     const RpcTimeout& timeout = RpcTimeout());
 
+    /**
+     * @brief Set the server used for services without balanced instances
+     *
+     * @param endpoint Server endpoint (default 127.0.0.1:30490)
+     */
+    void set_server_endpoint(const transport::Endpoint& endpoint);
+
+    /**
+     * @brief Spread calls across the instances known to a load balancer
+     *
+     * Calls to a service with instances in the balancer are sent to the
+     * instance it selects; responses and timeouts are reported back so
+     * unresponsive instances get ejected. Calls to other services go to the
+     * server endpoint. The balancer may be shared between clients and fed
+     * from service discovery (see rpc/sd_load_balancing.h).
+     *
+     * @param balancer Load balancer, or nullptr to disable balancing
+     */
+    void set_load_balancer(std::shared_ptr<LoadBalancer> balancer);
+
+    /**
+     * @brief Coalesce identical concurrent calls to a method (single-flight)
+     *
+     * While a call with the same service, method and parameters is in
+     * flight, later calls do not send a request of their own; they complete
+     * with the response of the call in flight. Each caller keeps its own
+     * timeout: one that gives up early does not fail the others. Only enable
+     * this for methods without side effects.
+     *
+     * @param service_id Target service ID
+     * @param method_id Method to coalesce
+     * @return true if enabled, false if already enabled
+     */
+    bool enable_request_coalescing(uint16_t service_id, MethodId method_id);
+
+    /**
+     * @brief Stop coalescing calls to a method
+     *
+     * @param service_id Target service ID
+     * @param method_id Method identifier
+     * @return true if disabled, false if it was not enabled
+     */
+    bool disable_request_coalescing(uint16_t service_id, MethodId method_id);
+
+    /**
+     * @brief Send a fire-and-forget request (REQUEST_NO_RETURN)
+     *
+     * No session is tracked, no pending state is created and the server
+     * sends no response, so the call completes as soon as the request is
+     * handed to the transport.
+     *
+     * @param service_id Target service ID
+     * @param method_id Method to call
+     * @param parameters Serialized method parameters
+     * @return true if the request was sent
+     */
+    bool send_request_no_return(uint16_t service_id, MethodId method_id,
+                                const std::vector<uint8_t>& parameters);
+
+    /**
+     * @brief Send a batch of fire-and-forget requests to one service
+     *
+     * The requests are packed into as few datagrams as possible.
+     *
+     * @param service_id Target service ID
+     * @param requests Methods and parameters, sent in order
+     * @return true if every request was sent
+     */
+    bool send_requests_no_return(uint16_t service_id, const std::vector<NoReturnRequest>& requests);
+
     /**
      * @brief Cancel asynchronous RPC call
      *
@@ -14,7 +14,10 @@
 #ifndef SOMEIP_RPC_SERVER_H
 #define SOMEIP_RPC_SERVER_H
 
+#include "rpc/admission_control.h"
+#include "rpc/response_cache.h"
 #include "rpc/rpc_types.h"
+#include "someip/payload.h"
 #include <memory>
 #include <functional>
 
@@ -25,17 +28,23 @@ namespace rpc {
  * @brief Forward declaration
  */
 class RpcServerImpl;
+class ServerRuntime;
 
 /**
  * @brief Method handler function type
  *
  * Function signature for handling RPC method calls on the server side.
  * Receives method parameters and returns result with output parameters.
+ * The input parameters are a view into the request message, valid only for
+ * the duration of the call; copy them with to_vector() to keep them.
+ *
+ * @note API change: handlers used to take `const std::vector<uint8_t>&`.
+ *       Such handlers no longer compile and must take a PayloadView.
  */
 using MethodHandler = std::function<RpcResult(
     uint16_t client_id,
     uint16_t session_id,
-    const std::vector<uint8_t>& input_params,
+    PayloadView input_params,
     std::vector<uint8_t>& output_params
 )>;
 
@@ -49,10 +58,25 @@ class RpcServer {
 public:
     /**
      * @brief Constructor
+     *
+     * The server gets a private runtime bound to 127.0.0.1:30490.
+     *
      * @param service_id Service identifier this server handles
      */
     explicit RpcServer(uint16_t service_id);
 
+    /**
+     * @brief Constructor for hosting on a shared endpoint
+     *
+     * The server registers its service with the runtime in initialize() and
+     * unregisters it in shutdown(); the runtime is started if needed but is
+     * never stopped by the server.
+     *
+     * @param service_id Service identifier this server handles
+     * @param runtime Shared server runtime
+     */
+    RpcServer(uint16_t service_id, std::shared_ptr<ServerRuntime> runtime);
+
     /**
      * @brief Destructor
      */
@@ -66,7 +90,7 @@ public:
 
     /**
      * @brief Initialize the RPC server
-     * @return true on success, false on failure
+     * @return true on success, false on failure or if the service is already hosted
      */
     bool initialize();
 
@@ -92,6 +116,49 @@ public:
      */
     bool unregister_method(MethodId method_id);
 
+    /**
+     * @brief Enable response caching for an idempotent method
+     *
+     * Successful responses are cached per set of input parameters. A cached
+     * response is sent with the caller's request ID without running the
+     * handler. Only use this for methods whose result depends on nothing
+     * but their parameters, or invalidate the cache when it changes.
+     *
+     * @param method_id Method identifier
+     * @param config Cache size and time-to-live
+     * @return true if enabled, false if the method already has a cache
+     */
+    bool enable_response_cache(MethodId method_id, const ResponseCacheConfig& config = ResponseCacheConfig());
+
+    /**
+     * @brief Disable response caching for a method
+     *
+     * @param method_id Method identifier
+     * @return true if disabled, false if the method had no cache
+     */
+    bool disable_response_cache(MethodId method_id);
+
+    /**
+     * @brief Drop all cached responses of a method
+     *
+     * @param method_id Method identifier
+     */
+    void invalidate_response_cache(MethodId method_id);
+
+    /**
+     * @brief Put rate limiting and fair queueing in front of the handlers
+     *
+     * Requests are rate-limited per client ID (and per client ID and method
+     * where configured) and queued per client; a worker thread runs the
+     * handlers in deficit round robin order across clients. Requests that
+     * exceed a rate limit or find the queue full are answered immediately
+     * with E_NOT_READY (fire-and-forget requests are dropped).
+     *
+     * @param config Rate limits, queue bounds and DRR quantum
+     * @return true if enabled, false if the server is already initialized
+     */
+    bool enable_admission_control(const AdmissionConfig& config);
+
     /**
      * @brief Check if method is registered
      *
@@ -124,6 +191,7 @@ public:
         uint32_t successful_calls{0};
         uint32_t failed_calls{0};
         uint32_t method_not_found_errors{0};
+        uint32_t rejected_calls{0};             // Refused by admission control
         std::chrono::milliseconds average_processing_time{0};
     };
     Statistics get_statistics() const;
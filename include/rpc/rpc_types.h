@@ -46,6 +46,14 @@ using RpcCallHandle = uint32_t;
  */
 using MethodId = uint16_t;
 
+/**
+ * @brief One fire-and-forget request in a batch
+ */
+struct NoReturnRequest {
+    MethodId method_id{0};
+    std::vector<uint8_t> parameters;
+};
+
 /**
  * @brief Timeout configuration for RPC calls
  */
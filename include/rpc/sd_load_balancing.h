@@ -0,0 +1,59 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_RPC_SD_LOAD_BALANCING_H
+#define SOMEIP_RPC_SD_LOAD_BALANCING_H
+
+#include "rpc/load_balancer.h"
+#include "sd/sd_types.h"
+#include <vector>
+
+namespace someip {
+namespace rpc {
+
+/**
+ * @brief Glue between service discovery and the RPC load balancer
+ *
+ * Header-only so that the RPC library does not depend on the SD library;
+ * applications using both feed SdClient results into a LoadBalancer, e.g.
+ * from a FindServiceCallback or after get_available_services().
+ */
+
+/**
+ * @brief Convert discovered UDP instances of a service to endpoints
+ */
+inline std::vector<transport::Endpoint> endpoints_from_sd(uint16_t service_id,
+                                                          const std::vector<sd::ServiceInstance>& instances) {
+    constexpr uint8_t PROTOCOL_UDP = 0x11;
+    std::vector<transport::Endpoint> endpoints;
+    for (const auto& instance : instances) {
+        if (instance.service_id == service_id && instance.protocol == PROTOCOL_UDP &&
+            !instance.ip_address.empty() && instance.port != 0) {
+            endpoints.emplace_back(instance.ip_address, instance.port);
+        }
+    }
+    return endpoints;
+}
+
+/**
+ * @brief Replace the balancer's instance set of a service with SD results
+ */
+inline void update_load_balancer(LoadBalancer& balancer, uint16_t service_id,
+                                 const std::vector<sd::ServiceInstance>& instances) {
+    balancer.set_instances(service_id, endpoints_from_sd(service_id, instances));
+}
+
+} // namespace rpc
+} // namespace someip
+
+#endif // SOMEIP_RPC_SD_LOAD_BALANCING_H
@@ -0,0 +1,176 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_RPC_SERVER_RUNTIME_H
+#define SOMEIP_RPC_SERVER_RUNTIME_H
+
+#include "common/result.h"
+#include "someip/message.h"
+#include "transport/endpoint.h"
+#include "transport/transport.h"
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace someip {
+namespace rpc {
+
+/**
+ * @brief Forward declaration
+ */
+class ServerRuntimeImpl;
+
+/**
+ * @brief Handler for all messages addressed to one service
+ */
+using ServiceHandler = std::function<void(MessagePtr message, const transport::Endpoint& sender)>;
+
+/**
+ * @brief Transport events other than messages, for services that track peers
+ *
+ * Members may be left empty.
+ */
+struct ConnectionObserver {
+    std::function<void(const transport::Endpoint& endpoint)> on_connection_lost;
+    std::function<void(const transport::Endpoint& endpoint)> on_connection_established;
+    std::function<void(Result error)> on_error;
+};
+
+/**
+ * @brief Shared server endpoint hosting many services
+ *
+ * Owns one transport (one socket and one receive thread) and dispatches each
+ * incoming message to the handler registered for its service ID. RPC servers
+ * and event publishers constructed with the same runtime share its endpoint,
+ * so socket and thread counts stay constant as services are added.
+ *
+ * Requests for services that are not registered are answered with
+ * E_UNKNOWN_SERVICE. Service lookup is lock-free.
+ */
+class ServerRuntime {
+public:
+    /**
+     * @brief Create a runtime with a UDP endpoint
+     * @param endpoint Local endpoint to bind
+     */
+    explicit ServerRuntime(const transport::Endpoint& endpoint = transport::Endpoint("127.0.0.1", 30490));
+
+    /**
+     * @brief Create a runtime on an existing transport
+     * @param transport Transport to use; the runtime becomes its listener
+     */
+    explicit ServerRuntime(std::shared_ptr<transport::ITransport> transport);
+
+    /**
+     * @brief Destructor
+     */
+    ~ServerRuntime();
+
+    // Delete copy and move operations
+    ServerRuntime(const ServerRuntime&) = delete;
+    ServerRuntime& operator=(const ServerRuntime&) = delete;
+    ServerRuntime(ServerRuntime&&) = delete;
+    ServerRuntime& operator=(ServerRuntime&&) = delete;
+
+    /**
+     * @brief Start the transport (idempotent)
+     * @return true on success, false on failure
+     */
+    bool start();
+
+    /**
+     * @brief Stop the transport
+     */
+    void stop();
+
+    /**
+     * @brief Check if the transport is running
+     */
+    bool is_running() const;
+
+    /**
+     * @brief Register the handler for a service
+     *
+     * @param service_id Service identifier
+     * @param handler Handler receiving every message for the service
+     * @return true if registered, false if the service already has a handler
+     */
+    bool register_service(uint16_t service_id, ServiceHandler handler);
+
+    /**
+     * @brief Unregister a service
+     *
+     * When this returns, the service handler is no longer running on the
+     * receive thread. Must not be called from within a service handler.
+     *
+     * @param service_id Service identifier
+     * @return true if unregistered, false if not found
+     */
+    bool unregister_service(uint16_t service_id);
+
+    /**
+     * @brief Check if a service is registered
+     */
+    bool is_service_registered(uint16_t service_id) const;
+
+    /**
+     * @brief Get the registered service IDs
+     */
+    std::vector<uint16_t> get_registered_services() const;
+
+    /**
+     * @brief Receive connection events of the shared transport
+     *
+     * @param observer Callbacks run on the thread reporting the event
+     * @return Identifier for remove_connection_observer()
+     */
+    uint32_t add_connection_observer(ConnectionObserver observer);
+
+    /**
+     * @brief Stop receiving connection events
+     *
+     * When this returns, the observer is no longer running. Must not be
+     * called from within an observer callback.
+     *
+     * @param id Identifier returned by add_connection_observer()
+     */
+    void remove_connection_observer(uint32_t id);
+
+    /**
+     * @brief Send a message from the shared endpoint
+     */
+    Result send_message(const Message& message, const transport::Endpoint& endpoint);
+
+    /**
+     * @brief Send an already serialized message from the shared endpoint
+     */
+    Result send_serialized(const uint8_t* data, size_t size, const transport::Endpoint& endpoint);
+
+    /**
+     * @brief Get the local endpoint
+     */
+    transport::Endpoint get_local_endpoint() const;
+
+    /**
+     * @brief Get the underlying transport
+     */
+    std::shared_ptr<transport::ITransport> get_transport() const;
+
+private:
+    std::unique_ptr<ServerRuntimeImpl> impl_;
+};
+
+} // namespace rpc
+} // namespace someip
+
+#endif // SOMEIP_RPC_SERVER_RUNTIME_H
@@ -0,0 +1,90 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_SD_CACHE_H
+#define SOMEIP_SD_CACHE_H
+
+#include "sd_types.h"
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace someip {
+namespace sd {
+
+/**
+ * @brief Memory-mapped store of recently seen service offers
+ *
+ * Fixed-size records hold the endpoint and the wall-clock expiry of each
+ * offered instance, so a restarted client can use them before the first
+ * live offer arrives. Only IPv4 endpoints are stored. Writes go straight to
+ * the mapping; the kernel flushes them to the file. Thread-safe.
+ */
+class SdCache {
+public:
+    SdCache() = default;
+    ~SdCache();
+
+    SdCache(const SdCache&) = delete;
+    SdCache& operator=(const SdCache&) = delete;
+
+    /**
+     * @brief Map the cache file, creating or resetting it if it does not match
+     * @param path File path
+     * @param capacity Maximum number of instances kept
+     * @return true on success
+     */
+    bool open(const std::string& path, size_t capacity);
+
+    /**
+     * @brief Flush and unmap the file
+     */
+    void close();
+
+    bool is_open() const;
+
+    /**
+     * @brief Get all unexpired instances; ttl_seconds is set to the remaining lifetime
+     */
+    std::vector<ServiceInstance> load() const;
+
+    /**
+     * @brief Insert or refresh an instance, expiring ttl_seconds from now
+     *
+     * When the cache is full the record closest to expiry is replaced.
+     */
+    bool store(const ServiceInstance& instance);
+
+    /**
+     * @brief Drop an instance (e.g. on StopOffer)
+     */
+    void remove(uint16_t service_id, uint16_t instance_id);
+
+private:
+    struct Header;
+    struct Record;
+
+    Record* records() const;
+    Record* find(uint16_t service_id, uint16_t instance_id) const;
+
+    int fd_{-1};
+    void* map_{nullptr};
+    size_t map_size_{0};
+    size_t capacity_{0};
+    mutable std::mutex mutex_;
+};
+
+} // namespace sd
+} // namespace someip
+
+#endif // SOMEIP_SD_CACHE_H
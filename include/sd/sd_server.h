@@ -16,6 +16,7 @@
 
 #include "sd_types.h"
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace someip {
@@ -114,6 +115,22 @@ public:
      */
     std::vector<ServiceInstance> get_offered_services() const;
 
+    /**
+     * @brief Get the members of an event group
+     *
+     * Acknowledged subscriptions and, in static mode, the configured subscribers.
+     * A subscription leaves the group on StopSubscribeEventgroup (TTL 0) or
+     * when its TTL runs out; subscriptions added through
+     * handle_eventgroup_subscription() do not expire. shutdown() empties all groups.
+     *
+     * @param service_id Service ID
+     * @param instance_id Instance ID
+     * @param eventgroup_id Event group ID
+     * @return Subscriber endpoints as "ip:port"
+     */
+    std::vector<std::string> get_eventgroup_subscribers(uint16_t service_id, uint16_t instance_id,
+                                                        uint16_t eventgroup_id) const;
+
     /**
      * @brief Check if server is initialized and ready
      *
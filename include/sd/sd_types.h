@@ -76,6 +76,7 @@ struct ServiceInstance {
     uint16_t port{0};
     uint8_t protocol{0x11};  // Default to UDP (0x11)
     uint32_t ttl_seconds{0};  // Time to live
+    bool from_cache{false};   // Restored from the persistent cache, not yet confirmed by a live offer
 
     ServiceInstance(uint16_t svc_id = 0, uint16_t inst_id = 0,
                    uint8_t maj_ver = 0, uint8_t min_ver = 0)
@@ -111,6 +112,9 @@ struct SdConfig {
     std::chrono::milliseconds cyclic_offer{30000};     // Cyclic offer interval (30s)
     std::chrono::milliseconds ttl{3600000};           // Default TTL (1 hour)
     size_t max_services{100};                          // Maximum number of services to track
+    std::string cache_file;                            // Persistent offer cache (empty = disabled)
+    std::string static_config_file;                    // Static discovery topology (empty = dynamic SD)
+    bool static_verification{false};                   // Static mode: keep dynamic SD running in the background
 };
 
 /**
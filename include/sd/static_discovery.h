@@ -0,0 +1,86 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_SD_STATIC_DISCOVERY_H
+#define SOMEIP_SD_STATIC_DISCOVERY_H
+
+#include "sd_types.h"
+#include <string>
+#include <vector>
+
+namespace someip {
+namespace sd {
+
+/**
+ * @brief Eventgroup of a statically configured service
+ */
+struct StaticEventGroup {
+    uint16_t eventgroup_id{0};
+    std::vector<std::string> subscribers;  // "ip:port" of each member
+};
+
+/**
+ * @brief Statically configured service instance
+ */
+struct StaticService {
+    ServiceInstance instance;
+    std::vector<StaticEventGroup> eventgroups;
+};
+
+/**
+ * @brief Fixed topology replacing dynamic service discovery
+ *
+ * JSON layout (IDs may also be given as "0x..." strings):
+ * @code
+ * { "services": [ {
+ *     "service_id": "0x1234", "instance_id": 1, "major_version": 1, "minor_version": 0,
+ *     "address": "192.168.1.10", "port": 30509, "protocol": "udp", "ttl": 3600,
+ *     "eventgroups": [ { "eventgroup_id": 1, "subscribers": ["192.168.1.20:40000"] } ]
+ * } ] }
+ * @endcode
+ */
+struct StaticDiscoveryConfig {
+    std::vector<StaticService> services;
+
+    /**
+     * @brief Find a configured service instance (nullptr if not declared)
+     */
+    const StaticService* find(uint16_t service_id, uint16_t instance_id) const;
+
+    /**
+     * @brief Find a configured eventgroup (nullptr if not declared)
+     */
+    const StaticEventGroup* find_eventgroup(uint16_t service_id, uint16_t instance_id,
+                                            uint16_t eventgroup_id) const;
+};
+
+/**
+ * @brief Parse a static discovery configuration from JSON text
+ * @param json JSON document
+ * @param config Receives the configuration
+ * @param error Optional; receives a description of the first problem
+ * @return true on success
+ */
+bool parse_static_discovery(const std::string& json, StaticDiscoveryConfig& config,
+                            std::string* error = nullptr);
+
+/**
+ * @brief Read and parse a static discovery configuration file
+ */
+bool load_static_discovery(const std::string& path, StaticDiscoveryConfig& config,
+                           std::string* error = nullptr);
+
+} // namespace sd
+} // namespace someip
+
+#endif // SOMEIP_SD_STATIC_DISCOVERY_H
@@ -0,0 +1,203 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_SERIALIZATION_STREAM_DESERIALIZER_H
+#define SOMEIP_SERIALIZATION_STREAM_DESERIALIZER_H
+
+#include "serialization/serializer.h"
+#include "serialization/wire_codec.h"
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace someip {
+namespace serialization {
+
+/**
+ * @brief Deserializer over a payload that arrives in chunks
+ *
+ * Chunks, such as the segment payloads TpReassembler delivers in streaming
+ * mode, are appended in payload order and read through one cursor that
+ * crosses chunk boundaries. A read that needs bytes which have not arrived
+ * yet fails with Result::WOULD_BLOCK and leaves the cursor where it was, so
+ * the caller retries it after the next append(). Once finish() is called,
+ * such reads fail with Result::MALFORMED_MESSAGE instead.
+ *
+ * Chunks are released as soon as the cursor has passed them, so memory is
+ * bounded by the data not yet read rather than by the payload size.
+ * Offsets (for string padding and get_position()) count from the start of
+ * the payload. Not thread-safe.
+ */
+class StreamDeserializer {
+public:
+    /**
+     * @brief Saved cursor position for an all-or-nothing read of several values
+     */
+    struct Checkpoint {
+        size_t position{0};
+    };
+
+    StreamDeserializer() = default;
+
+    /**
+     * @brief Append the next chunk of the payload
+     */
+    void append(std::vector<uint8_t>&& chunk);
+    void append(const uint8_t* data, size_t size);
+
+    /**
+     * @brief Mark the end of the payload
+     */
+    void finish() { finished_ = true; }
+
+    bool is_finished() const { return finished_; }
+
+    /**
+     * @brief Check if the payload is finished and fully read
+     */
+    bool at_end() const { return finished_ && available_ == 0; }
+
+    /**
+     * @brief Bytes read since the start of the payload
+     */
+    size_t get_position() const { return position_; }
+
+    /**
+     * @brief Bytes received but not read yet
+     */
+    size_t get_available() const { return available_; }
+
+    /**
+     * @brief Number of chunks held, including a partly read one
+     */
+    size_t get_buffered_chunks() const { return chunks_.size(); }
+
+    // Basic type deserialization, all or nothing
+    DeserializationResult<bool> deserialize_bool();
+    DeserializationResult<uint8_t> deserialize_uint8();
+    DeserializationResult<uint16_t> deserialize_uint16();
+    DeserializationResult<uint32_t> deserialize_uint32();
+    DeserializationResult<uint64_t> deserialize_uint64();
+    DeserializationResult<int8_t> deserialize_int8();
+    DeserializationResult<int16_t> deserialize_int16();
+    DeserializationResult<int32_t> deserialize_int32();
+    DeserializationResult<int64_t> deserialize_int64();
+    DeserializationResult<float> deserialize_float();
+    DeserializationResult<double> deserialize_double();
+
+    /**
+     * @brief Read a length-prefixed string and its padding
+     *
+     * Padding after the last string of a finished payload may be missing.
+     */
+    DeserializationResult<std::string> deserialize_string();
+
+    /**
+     * @brief Read a fixed-size value with its wire::Codec
+     *
+     * Lets elements of large arrays of generated structs be read one at a
+     * time as their bytes arrive.
+     */
+    template <typename T>
+    Result read(T& value);
+
+    /**
+     * @brief Copy the next size bytes
+     */
+    Result read_bytes(uint8_t* out, size_t size);
+
+    Result skip(size_t bytes);
+    Result align_to(size_t alignment);
+
+    /**
+     * @brief Keep the bytes after the cursor until restore() or release()
+     *
+     * Use to read a compound value all or nothing: if one of its fields
+     * would block, restore() the checkpoint and retry after the next append().
+     */
+    Checkpoint save();
+
+    /**
+     * @brief Move the cursor back to a checkpoint
+     */
+    void restore(const Checkpoint& checkpoint);
+
+    /**
+     * @brief Drop the checkpoint and free the chunks read since
+     */
+    void release();
+
+private:
+    /**
+     * @brief Error for a read that needs more than get_available() bytes
+     */
+    Result missing() const { return finished_ ? Result::MALFORMED_MESSAGE : Result::WOULD_BLOCK; }
+
+    /**
+     * @brief Contiguous pointer to the next size bytes, or nullptr if they span chunks
+     */
+    const uint8_t* contiguous(size_t size) const;
+
+    /**
+     * @brief Move the cursor forward; the bytes must be available
+     */
+    void advance(size_t size);
+
+    void drop_read_chunks();
+
+    template <typename T>
+    DeserializationResult<T> read_value();
+
+    std::deque<std::vector<uint8_t>> chunks_;
+    size_t chunk_index_{0};       // Chunk the cursor is in
+    size_t chunk_offset_{0};      // Cursor offset in that chunk
+    size_t position_{0};
+    size_t available_{0};
+    size_t chunks_start_{0};      // Payload offset of chunks_.front()
+    bool saved_{false};           // Read chunks are kept for a checkpoint
+    bool finished_{false};
+};
+
+template <typename T>
+Result StreamDeserializer::read(T& value) {
+    static_assert(wire::fixed_size_v<T> > 0, "only fixed-size types are read from a stream");
+    constexpr size_t size = wire::fixed_size_v<T>;
+    if (available_ < size) {
+        return missing();
+    }
+    if (const uint8_t* data = contiguous(size)) {
+        wire::Codec<T>::decode_fixed(data, value);
+        advance(size);
+        return Result::SUCCESS;
+    }
+    uint8_t bytes[size];
+    read_bytes(bytes, size);
+    wire::Codec<T>::decode_fixed(bytes, value);
+    return Result::SUCCESS;
+}
+
+template <typename T>
+DeserializationResult<T> StreamDeserializer::read_value() {
+    T value{};
+    Result result = read(value);
+    if (result != Result::SUCCESS) {
+        return DeserializationResult<T>::error(result);
+    }
+    return DeserializationResult<T>::success(value);
+}
+
+} // namespace serialization
+} // namespace someip
+
+#endif // SOMEIP_SERIALIZATION_STREAM_DESERIALIZER_H
@@ -0,0 +1,414 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_SERIALIZATION_WIRE_CODEC_H
+#define SOMEIP_SERIALIZATION_WIRE_CODEC_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace someip {
+namespace serialization {
+namespace wire {
+
+/**
+ * @brief Compile-time SOME/IP codec for one C++ type
+ *
+ * Headers generated by tools/codegen specialize Codec for their structs;
+ * this header covers the primitive types, enums, std::string, std::array
+ * and std::vector. The wire format is the one Serializer writes:
+ * big-endian integers and IEEE 754 floats, strings as a 32-bit byte length
+ * followed by the bytes and zero padding to a 4-byte payload offset.
+ * Dynamic arrays carry a 32-bit length field in bytes; fixed arrays have
+ * none.
+ *
+ * Types with FIXED_SIZE > 0 always take that many bytes and provide
+ * encode_fixed()/decode_fixed(), which read and write at constant offsets
+ * without checks; the caller checks the bounds once for the whole run.
+ * Variable types (FIXED_SIZE == 0) provide end(), encode(), decode() and
+ * skip() working on an absolute payload offset, so padding is placed as
+ * Serializer places it.
+ */
+template <typename T, typename = void>
+struct Codec;
+
+inline size_t pad4(size_t pos) {
+    return (pos + 3) & ~static_cast<size_t>(3);
+}
+
+/**
+ * @brief Big-endian unsigned integer codec
+ */
+template <typename T>
+struct UnsignedCodec {
+    static constexpr size_t FIXED_SIZE = sizeof(T);
+
+    static void encode_fixed(uint8_t* out, T value) {
+        for (size_t i = 0; i < sizeof(T); ++i) {
+            out[i] = static_cast<uint8_t>(value >> (8 * (sizeof(T) - 1 - i)));
+        }
+    }
+
+    static void decode_fixed(const uint8_t* in, T& value) {
+        T result = 0;
+        for (size_t i = 0; i < sizeof(T); ++i) {
+            result = static_cast<T>((result << 8) | in[i]);
+        }
+        value = result;
+    }
+};
+
+/**
+ * @brief Codec of a type with the same wire form as an unsigned integer
+ */
+template <typename T, typename Bits>
+struct BitCastCodec {
+    static_assert(sizeof(T) == sizeof(Bits), "wire form must have the same size");
+    static constexpr size_t FIXED_SIZE = sizeof(T);
+
+    static void encode_fixed(uint8_t* out, T value) {
+        Bits bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        UnsignedCodec<Bits>::encode_fixed(out, bits);
+    }
+
+    static void decode_fixed(const uint8_t* in, T& value) {
+        Bits bits;
+        UnsignedCodec<Bits>::decode_fixed(in, bits);
+        std::memcpy(&value, &bits, sizeof(value));
+    }
+};
+
+template <> struct Codec<uint8_t> : UnsignedCodec<uint8_t> {};
+template <> struct Codec<uint16_t> : UnsignedCodec<uint16_t> {};
+template <> struct Codec<uint32_t> : UnsignedCodec<uint32_t> {};
+template <> struct Codec<uint64_t> : UnsignedCodec<uint64_t> {};
+template <> struct Codec<int8_t> : BitCastCodec<int8_t, uint8_t> {};
+template <> struct Codec<int16_t> : BitCastCodec<int16_t, uint16_t> {};
+template <> struct Codec<int32_t> : BitCastCodec<int32_t, uint32_t> {};
+template <> struct Codec<int64_t> : BitCastCodec<int64_t, uint64_t> {};
+template <> struct Codec<float> : BitCastCodec<float, uint32_t> {};
+template <> struct Codec<double> : BitCastCodec<double, uint64_t> {};
+
+template <>
+struct Codec<bool> {
+    static constexpr size_t FIXED_SIZE = 1;
+
+    static void encode_fixed(uint8_t* out, bool value) { out[0] = value ? 0x01 : 0x00; }
+    static void decode_fixed(const uint8_t* in, bool& value) { value = in[0] != 0x00; }
+};
+
+template <typename T>
+struct Codec<T, std::enable_if_t<std::is_enum_v<T>>> {
+    using Underlying = std::underlying_type_t<T>;
+    static constexpr size_t FIXED_SIZE = sizeof(Underlying);
+
+    static void encode_fixed(uint8_t* out, T value) {
+        Codec<Underlying>::encode_fixed(out, static_cast<Underlying>(value));
+    }
+
+    static void decode_fixed(const uint8_t* in, T& value) {
+        Underlying raw;
+        Codec<Underlying>::decode_fixed(in, raw);
+        value = static_cast<T>(raw);
+    }
+};
+
+template <typename T>
+constexpr size_t fixed_size_v = Codec<T>::FIXED_SIZE;
+
+/**
+ * @brief Offset after encoding a value at offset pos
+ */
+template <typename T>
+size_t encoded_end(size_t pos, const T& value) {
+    if constexpr (fixed_size_v<T> > 0) {
+        (void)value;
+        return pos + fixed_size_v<T>;
+    } else {
+        return Codec<T>::end(pos, value);
+    }
+}
+
+/**
+ * @brief Encode a value at out + pos and advance pos
+ *
+ * The buffer must hold encoded_end(pos, value) bytes.
+ */
+template <typename T>
+void encode(uint8_t* out, size_t& pos, const T& value) {
+    if constexpr (fixed_size_v<T> > 0) {
+        Codec<T>::encode_fixed(out + pos, value);
+        pos += fixed_size_v<T>;
+    } else {
+        Codec<T>::encode(out, pos, value);
+    }
+}
+
+/**
+ * @brief Decode a value from in + pos, not reading at or past end
+ * @return false if the data is truncated or malformed
+ */
+template <typename T>
+bool decode(const uint8_t* in, size_t& pos, size_t end, T& value) {
+    if constexpr (fixed_size_v<T> > 0) {
+        if (end - pos < fixed_size_v<T>) {
+            return false;
+        }
+        Codec<T>::decode_fixed(in + pos, value);
+        pos += fixed_size_v<T>;
+        return true;
+    } else {
+        return Codec<T>::decode(in, pos, end, value);
+    }
+}
+
+/**
+ * @brief Advance pos past a value at in + pos without decoding it
+ *
+ * Only length fields are read, so skipping a dynamic array or a string
+ * costs the same whatever its size. The skipped bytes are not validated.
+ *
+ * @return false if the data is truncated
+ */
+template <typename T>
+bool skip(const uint8_t* in, size_t& pos, size_t end) {
+    if constexpr (fixed_size_v<T> > 0) {
+        (void)in;
+        if (end - pos < fixed_size_v<T>) {
+            return false;
+        }
+        pos += fixed_size_v<T>;
+        return true;
+    } else {
+        return Codec<T>::skip(in, pos, end);
+    }
+}
+
+/**
+ * @brief Read a 32-bit length field and advance pos past the bytes it covers
+ */
+inline bool skip_length_prefixed(const uint8_t* in, size_t& pos, size_t end) {
+    uint32_t length = 0;
+    if (!decode(in, pos, end, length) || length > end - pos) {
+        return false;
+    }
+    pos += length;
+    return true;
+}
+
+template <>
+struct Codec<std::string> {
+    static constexpr size_t FIXED_SIZE = 0;
+
+    static size_t end(size_t pos, const std::string& value) {
+        return pad4(pos + 4 + value.size());
+    }
+
+    static void encode(uint8_t* out, size_t& pos, const std::string& value) {
+        Codec<uint32_t>::encode_fixed(out + pos, static_cast<uint32_t>(value.size()));
+        std::memcpy(out + pos + 4, value.data(), value.size());
+        size_t end_pos = end(pos, value);
+        std::memset(out + pos + 4 + value.size(), 0, end_pos - pos - 4 - value.size());
+        pos = end_pos;
+    }
+
+    static bool decode(const uint8_t* in, size_t& pos, size_t end, std::string& value) {
+        uint32_t length = 0;
+        if (!wire::decode(in, pos, end, length) || length > end - pos) {
+            return false;
+        }
+        value.assign(reinterpret_cast<const char*>(in + pos), length);
+        // Padding after the last string of a payload may be cut off
+        pos = std::min(pad4(pos + length), end);
+        return true;
+    }
+
+    static bool skip(const uint8_t* in, size_t& pos, size_t end) {
+        if (!skip_length_prefixed(in, pos, end)) {
+            return false;
+        }
+        pos = std::min(pad4(pos), end);
+        return true;
+    }
+};
+
+template <typename T, size_t N>
+struct Codec<std::array<T, N>> {
+    static constexpr size_t FIXED_SIZE = fixed_size_v<T> * N;
+
+    static void encode_fixed(uint8_t* out, const std::array<T, N>& value) {
+        for (size_t i = 0; i < N; ++i) {
+            Codec<T>::encode_fixed(out + i * fixed_size_v<T>, value[i]);
+        }
+    }
+
+    static void decode_fixed(const uint8_t* in, std::array<T, N>& value) {
+        for (size_t i = 0; i < N; ++i) {
+            Codec<T>::decode_fixed(in + i * fixed_size_v<T>, value[i]);
+        }
+    }
+
+    // Arrays of variable-size elements
+    static size_t end(size_t pos, const std::array<T, N>& value) {
+        for (const T& element : value) {
+            pos = encoded_end(pos, element);
+        }
+        return pos;
+    }
+
+    static void encode(uint8_t* out, size_t& pos, const std::array<T, N>& value) {
+        for (const T& element : value) {
+            wire::encode(out, pos, element);
+        }
+    }
+
+    static bool decode(const uint8_t* in, size_t& pos, size_t end, std::array<T, N>& value) {
+        for (T& element : value) {
+            if (!wire::decode(in, pos, end, element)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static bool skip(const uint8_t* in, size_t& pos, size_t end) {
+        for (size_t i = 0; i < N; ++i) {
+            if (!wire::skip<T>(in, pos, end)) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+template <typename T>
+struct Codec<std::vector<T>> {
+    static constexpr size_t FIXED_SIZE = 0;
+
+    static size_t end(size_t pos, const std::vector<T>& value) {
+        pos += 4;
+        if constexpr (fixed_size_v<T> > 0) {
+            return pos + value.size() * fixed_size_v<T>;
+        } else {
+            for (const T& element : value) {
+                pos = encoded_end(pos, element);
+            }
+            return pos;
+        }
+    }
+
+    static void encode(uint8_t* out, size_t& pos, const std::vector<T>& value) {
+        size_t length_pos = pos;
+        pos += 4;
+        if constexpr (std::is_same_v<T, uint8_t> || std::is_same_v<T, int8_t>) {
+            if (!value.empty()) {
+                std::memcpy(out + pos, value.data(), value.size());
+            }
+            pos += value.size();
+        } else if constexpr (fixed_size_v<T> > 0) {
+            for (const T& element : value) {
+                Codec<T>::encode_fixed(out + pos, element);
+                pos += fixed_size_v<T>;
+            }
+        } else {
+            for (const T& element : value) {
+                wire::encode(out, pos, element);
+            }
+        }
+        Codec<uint32_t>::encode_fixed(out + length_pos, static_cast<uint32_t>(pos - length_pos - 4));
+    }
+
+    static bool decode(const uint8_t* in, size_t& pos, size_t end, std::vector<T>& value) {
+        uint32_t length = 0;
+        if (!wire::decode(in, pos, end, length) || length > end - pos) {
+            return false;
+        }
+        size_t array_end = pos + length;
+
+        if constexpr (std::is_same_v<T, uint8_t> || std::is_same_v<T, int8_t>) {
+            value.resize(length);
+            if (length > 0) {
+                std::memcpy(value.data(), in + pos, length);
+            }
+        } else if constexpr (fixed_size_v<T> > 0) {
+            if (length % fixed_size_v<T> != 0) {
+                return false;
+            }
+            value.resize(length / fixed_size_v<T>);
+            for (size_t i = 0; i < value.size(); ++i) {
+                T element;
+                Codec<T>::decode_fixed(in + pos + i * fixed_size_v<T>, element);
+                value[i] = element;
+            }
+        } else {
+            value.clear();
+            size_t element_pos = pos;
+            while (element_pos < array_end) {
+                value.emplace_back();
+                if (!wire::decode(in, element_pos, array_end, value.back())) {
+                    return false;
+                }
+            }
+        }
+        pos = array_end;
+        return true;
+    }
+
+    static bool skip(const uint8_t* in, size_t& pos, size_t end) {
+        return skip_length_prefixed(in, pos, end);
+    }
+};
+
+/**
+ * @brief Encode values one after the other into a new payload
+ */
+template <typename... Ts>
+std::vector<uint8_t> encode_payload(const Ts&... values) {
+    size_t size = 0;
+    ((size = encoded_end(size, values)), ...);
+    std::vector<uint8_t> payload(size);
+    size_t pos = 0;
+    (void)pos;
+    (wire::encode(payload.data(), pos, values), ...);
+    return payload;
+}
+
+/**
+ * @brief Decode values one after the other from a payload
+ *
+ * Bytes after the last value are ignored, so newer senders may extend a
+ * payload at its end.
+ *
+ * @return false if the payload is truncated or malformed
+ */
+template <typename... Ts>
+bool decode_payload(const uint8_t* data, size_t size, Ts&... values) {
+    size_t pos = 0;
+    (void)data;
+    (void)size;
+    (void)pos;
+    return (wire::decode(data, pos, size, values) && ...);
+}
+
+} // namespace wire
+} // namespace serialization
+} // namespace someip
+
+#endif // SOMEIP_SERIALIZATION_WIRE_CODEC_H
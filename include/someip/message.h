@@ -15,6 +15,7 @@
 #define SOMEIP_MESSAGE_H
 
 #include "someip/types.h"
+#include "someip/payload.h"
 #include "e2e/e2e_header.h"
 #include <vector>
 #include <memory>
@@ -44,7 +45,7 @@ public:
             ReturnCode return_code = ReturnCode::E_OK);
 
     /**
-     * @brief Copy constructor
+     * @brief Copy constructor (large payloads are shared, not copied)
      */
     Message(const Message& other);
 
@@ -90,10 +91,16 @@ public:
     ReturnCode get_return_code() const { return return_code_; }
     void set_return_code(ReturnCode code) { return_code_ = code; }
 
-    // Payload accessors
-    const std::vector<uint8_t>& get_payload() const { return payload_; }
-    void set_payload(const std::vector<uint8_t>& payload) { payload_ = payload; update_length(); }
-    void set_payload(std::vector<uint8_t>&& payload) { payload_ = std::move(payload); update_length(); }
+    // Payload accessors (payloads up to Payload::INLINE_CAPACITY bytes are stored inline,
+    // larger ones are shared copy-on-write between message copies).
+    // get_payload() returns a view that is valid while the message is alive and unmodified;
+    // use to_vector() to keep the bytes (it used to return const std::vector<uint8_t>&).
+    PayloadView get_payload() const { return payload_.view(); }
+    uint8_t* get_mutable_payload() { return payload_.mutable_data(); }
+    void set_payload(const std::vector<uint8_t>& payload) { payload_.assign(payload.data(), payload.size()); update_length(); }
+    void set_payload(std::vector<uint8_t>&& payload) { payload_.assign(std::move(payload)); update_length(); }
+    void set_payload(const uint8_t* data, size_t size) { payload_.assign(data, size); update_length(); }
+    void set_payload(const Payload& payload) { payload_ = payload; update_length(); }
 
     // Service and method ID convenience accessors
     uint16_t get_service_id() const { return message_id_.service_id; }
@@ -163,7 +170,7 @@ private:
     ReturnCode return_code_;         // 1 byte
 
     // Payload
-    std::vector<uint8_t> payload_;
+    Payload payload_;
 
     // E2E protection header (optional)
     std::optional<e2e::E2EHeader> e2e_header_;
@@ -0,0 +1,137 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_PAYLOAD_H
+#define SOMEIP_PAYLOAD_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace someip {
+
+/**
+ * @brief Non-owning, read-only view of payload bytes
+ *
+ * The view is only valid as long as the payload it refers to is neither
+ * modified nor destroyed: keep the message alive while a view of it is in
+ * use, and copy with to_vector() to hold on to the bytes. The conversion to
+ * std::vector<uint8_t> is explicit so that every copy is visible at the call
+ * site.
+ */
+class PayloadView {
+public:
+    using value_type = uint8_t;
+    using size_type = size_t;
+    using const_iterator = const uint8_t*;
+    using iterator = const_iterator;
+
+    PayloadView() noexcept = default;
+    PayloadView(const uint8_t* data, size_t size) noexcept : data_(data), size_(size) {}
+    // NOLINTNEXTLINE(google-explicit-constructor) - views are cheap, implicit by design
+    PayloadView(const std::vector<uint8_t>& data) noexcept : data_(data.data()), size_(data.size()) {}
+
+    const uint8_t* data() const noexcept { return data_; }
+    size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    const_iterator begin() const noexcept { return data_; }
+    const_iterator end() const noexcept { return data_ + size_; }
+
+    uint8_t operator[](size_t index) const { return data_[index]; }
+
+    /**
+     * @brief View of a sub-range, clamped to the viewed bytes
+     */
+    PayloadView subview(size_t offset, size_t count = static_cast<size_t>(-1)) const noexcept;
+
+    /**
+     * @brief Copy the viewed bytes into a vector
+     */
+    std::vector<uint8_t> to_vector() const { return std::vector<uint8_t>(begin(), end()); }
+
+    explicit operator std::vector<uint8_t>() const { return to_vector(); }
+
+private:
+    const uint8_t* data_{nullptr};
+    size_t size_{0};
+};
+
+bool operator==(PayloadView lhs, PayloadView rhs) noexcept;
+inline bool operator!=(PayloadView lhs, PayloadView rhs) noexcept { return !(lhs == rhs); }
+
+/**
+ * @brief Message payload storage with small-buffer optimization
+ *
+ * Payloads up to INLINE_CAPACITY bytes are stored inside the object, so
+ * creating, copying and deserializing small messages does not allocate.
+ * Larger payloads live in an immutable, reference-counted heap buffer that is
+ * shared between copies, so copying a large payload is O(1). A vector passed
+ * by rvalue is adopted without copying. Writes through mutable_data() detach
+ * a shared buffer first (copy-on-write).
+ *
+ * Copies may be handed to other threads; a single Payload object must not be
+ * modified concurrently.
+ */
+class Payload {
+public:
+    static constexpr size_t INLINE_CAPACITY = 64;
+
+    Payload() noexcept = default;
+    Payload(const uint8_t* data, size_t size);
+    explicit Payload(const std::vector<uint8_t>& data) : Payload(data.data(), data.size()) {}
+    explicit Payload(std::vector<uint8_t>&& data);
+
+    Payload(const Payload& other);
+    Payload(Payload&& other) noexcept;
+    Payload& operator=(const Payload& other);
+    Payload& operator=(Payload&& other) noexcept;
+    ~Payload() = default;
+
+    const uint8_t* data() const noexcept { return is_inline_ ? inline_.data() : heap_->data(); }
+    size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    /**
+     * @brief Check whether the bytes are stored inside the object
+     */
+    bool is_inline() const noexcept { return is_inline_; }
+
+    /**
+     * @brief Check whether the heap buffer is shared with another payload
+     */
+    bool is_shared() const noexcept { return !is_inline_ && heap_.use_count() > 1; }
+
+    /**
+     * @brief Writable access to the bytes, detaching a shared buffer first
+     */
+    uint8_t* mutable_data();
+
+    PayloadView view() const noexcept { return PayloadView(data(), size_); }
+
+    void assign(const uint8_t* data, size_t size);
+    void assign(std::vector<uint8_t>&& data);
+    void clear() noexcept;
+
+private:
+    std::array<uint8_t, INLINE_CAPACITY> inline_;
+    std::shared_ptr<std::vector<uint8_t>> heap_;    // Never written while shared
+    size_t size_{0};
+    bool is_inline_{true};
+};
+
+} // namespace someip
+
+#endif // SOMEIP_PAYLOAD_H
@@ -133,7 +133,9 @@ enum class MessageType : uint8_t {
     ERROR_ACK = 0xC1,
     TP_REQUEST = 0x20,
     TP_REQUEST_NO_RETURN = 0x21,
-    TP_NOTIFICATION = 0x22
+    TP_NOTIFICATION = 0x22,
+    TP_RESPONSE = 0xA0,
+    TP_ERROR = 0xA1
 };
 
 /**
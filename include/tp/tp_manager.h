@@ -146,6 +146,16 @@ public:
      */
     void set_message_callback(TpMessageCallback callback);
 
+    /**
+     * @brief Receive multi-segment messages in order as their segments arrive
+     *
+     * See TpReassembler::set_stream_callback(). Single-segment messages are
+     * still returned by handle_received_segment().
+     *
+     * @param callback Function called with each in-order chunk
+     */
+    void set_stream_callback(TpStreamCallback callback);
+
     /**
      * @brief Process timeouts and cleanup stale transfers
      * Should be called periodically
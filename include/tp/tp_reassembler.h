@@ -27,6 +27,11 @@ namespace tp {
  *
  * Reassembles TP segments back into complete messages on the receiving side.
  * Handles out-of-order delivery and duplicate segments.
+ *
+ * In streaming mode (set_stream_callback()) messages are not buffered until
+ * complete: each segment's data is passed on as soon as everything before it
+ * has been, so large payloads can be decoded with a StreamDeserializer while
+ * they arrive.
  */
 class TpReassembler {
 public:
@@ -56,6 +61,22 @@ public:
      */
     bool process_segment(const TpSegment& segment, std::vector<uint8_t>& complete_message);
 
+    /**
+     * @brief Deliver messages in order as their segments arrive
+     *
+     * Segments that arrive early are held until the gap before them is
+     * filled; duplicates are dropped. A segment that reaches past the
+     * message length, or that would hold more than
+     * TpConfig::max_stream_pending early bytes, abandons the message: the
+     * callback gets an empty last chunk with INVALID_SEGMENT or
+     * RESOURCE_EXHAUSTED. process_segment() then never returns a
+     * complete message. The callback runs with the reassembler locked and
+     * must not call back into it. Pass nullptr to return to reassembly.
+     *
+     * @param callback Function called with each in-order chunk
+     */
+    void set_stream_callback(TpStreamCallback callback);
+
     /**
      * @brief Check if a message is currently being reassembled
      *
@@ -104,6 +125,8 @@ public:
 private:
     TpConfig config_;
     std::unordered_map<uint32_t, std::unique_ptr<TpReassemblyBuffer>> reassembly_buffers_;
+    std::unordered_map<uint32_t, TpStreamState> streams_;
+    TpStreamCallback stream_callback_;
     mutable std::mutex config_mutex_;
     mutable std::mutex buffers_mutex_;
 
@@ -111,6 +134,8 @@ private:
     bool validate_segment(const TpSegment& segment) const;
     TpReassemblyBuffer* find_or_create_buffer(const TpSegment& segment);
     bool add_segment_to_buffer(TpReassemblyBuffer& buffer, const TpSegment& segment);
+    bool stream_segment(const TpSegment& segment);
+    void abort_stream(std::unordered_map<uint32_t, TpStreamState>::iterator it, TpResult result);
     void cleanup_completed_buffers();
     void cleanup_timed_out_buffers(const TpConfig& config);
     bool parse_tp_header(const std::vector<uint8_t>& payload, uint16_t& offset, bool& more_segments);
@@ -76,7 +76,7 @@ private:
     uint8_t next_sequence_number_{0};
 
     TpResult create_multi_segments(const Message& message,
-                                 const std::vector<uint8_t>& payload,
+                                 PayloadView payload,
                                  std::vector<TpSegment>& segments);
 
     void serialize_tp_header(std::vector<uint8_t>& payload, uint16_t offset, bool more_segments);
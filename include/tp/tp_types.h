@@ -19,6 +19,7 @@
 #include <memory>
 #include <chrono>
 #include <functional>
+#include <map>
 
 namespace someip {
 namespace tp {
@@ -59,6 +60,7 @@ struct TpConfig {
     std::chrono::milliseconds reassembly_timeout{5000}; // Timeout for reassembly
     uint32_t max_concurrent_transfers{10}; // Maximum concurrent transfers
     bool enable_acknowledgments{true};     // Enable acknowledgment mechanism
+    uint32_t max_stream_pending{65536};    // Early segment bytes held per streamed message
 };
 
 /**
@@ -110,6 +112,24 @@ struct TpReassemblyBuffer {
     std::vector<uint8_t> get_complete_message() const;
 };
 
+/**
+ * @brief TP message being delivered in streaming mode
+ *
+ * Only segments that arrive ahead of the delivered prefix are buffered.
+ */
+struct TpStreamState {
+    uint32_t message_id{0};                    // SOME/IP message ID
+    uint32_t total_length{0};                  // Total expected message length
+    uint32_t delivered{0};                     // Bytes passed on so far
+    std::map<uint16_t, std::vector<uint8_t>> pending;  // Early segment data by (16-bit) offset
+    size_t pending_bytes{0};                   // Total size of pending data
+    std::chrono::steady_clock::time_point start_time{std::chrono::steady_clock::now()};
+
+    TpStreamState(uint32_t msg_id, uint32_t length)
+        : message_id(msg_id), total_length(length) {
+    }
+};
+
 /**
  * @brief TP transfer state
  */
@@ -153,6 +173,10 @@ struct TpTransfer {
 using TpCompletionCallback = std::function<void(uint32_t transfer_id, TpResult result)>;
 using TpProgressCallback = std::function<void(uint32_t transfer_id, uint32_t bytes_transferred, uint32_t total_bytes)>;
 using TpMessageCallback = std::function<void(uint32_t message_id, const std::vector<uint8_t>& data)>;
+// Called with each in-order chunk of a message; an empty last chunk with a
+// result other than SUCCESS means the message was abandoned
+using TpStreamCallback = std::function<void(uint32_t message_id, TpResult result,
+                                            std::vector<uint8_t>&& data, bool last)>;
 
 /**
  * @brief TP statistics
@@ -0,0 +1,196 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_TRANSPORT_IMPAIRED_TRANSPORT_H
+#define SOMEIP_TRANSPORT_IMPAIRED_TRANSPORT_H
+
+#include "transport/transport.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace someip {
+namespace transport {
+
+/**
+ * @brief Distribution of the per-message delay around ImpairmentProfile::delay
+ */
+enum class DelayDistribution : uint8_t {
+    UNIFORM,    // delay +/- jitter, uniformly
+    NORMAL      // Normal with mean delay and standard deviation jitter (never below 0)
+};
+
+/**
+ * @brief Network conditions applied to one direction
+ *
+ * Modelled on Linux netem. A message is first subject to loss, then waits
+ * for the link (rate), then for its delay. Jitter lets later messages
+ * overtake earlier ones, as on a real network.
+ */
+struct ImpairmentProfile {
+    double loss{0.0};                               // Probability that a loss burst starts
+    double burst_length{1.0};                       // Mean messages per loss burst (1 = independent losses)
+    double duplicate{0.0};                          // Probability a message is delivered twice
+    double reorder{0.0};                            // Probability a message skips the delay and overtakes
+    std::chrono::microseconds delay{0};             // Mean one-way delay
+    std::chrono::microseconds jitter{0};            // Spread of the delay
+    DelayDistribution distribution{DelayDistribution::UNIFORM};
+    uint64_t rate_bps{0};                           // Link rate in bits per second (0 = unlimited)
+    size_t queue_limit{1000};                       // Messages in flight before tail drop
+};
+
+/**
+ * @brief Impaired transport configuration
+ */
+struct ImpairedTransportConfig {
+    ImpairmentProfile outbound;                     // Applied to send_message()
+    ImpairmentProfile inbound;                      // Applied before the listener is called
+    uint64_t seed{1};                               // Same seed and traffic = same decisions
+};
+
+/**
+ * @brief Per-direction impairment counters
+ */
+struct ImpairmentStatistics {
+    uint64_t delivered{0};                          // Handed to the transport or listener
+    uint64_t lost{0};
+    uint64_t duplicated{0};
+    uint64_t reordered{0};
+    uint64_t overflowed{0};                         // Tail-dropped at queue_limit
+};
+
+/**
+ * @brief Transport decorator that emulates a lossy, slow or reordering network
+ *
+ * Wraps any transport and applies an ImpairmentProfile to outgoing messages
+ * and another to messages received through the listener, so retry, timeout
+ * and reassembly logic can be exercised in unit tests without netem or root
+ * privileges. Random decisions come from a seeded generator per direction;
+ * the same seed and message sequence give the same losses, duplicates and
+ * delays. Delayed messages are released by a scheduler thread.
+ *
+ * Lost and tail-dropped messages are reported as sent, as a network would.
+ * Messages still in flight when the transport stops are discarded.
+ * receive_message() is passed through unimpaired.
+ */
+class ImpairedTransport : public ITransport {
+public:
+    /**
+     * @brief Constructor
+     * @param transport Transport to impair; the decorator becomes its listener
+     * @param config Impairment profiles and seed
+     */
+    explicit ImpairedTransport(std::shared_ptr<ITransport> transport,
+                               const ImpairedTransportConfig& config = ImpairedTransportConfig());
+    ~ImpairedTransport() override;
+
+    /**
+     * @brief Change the outbound conditions; applies to subsequent messages
+     */
+    void set_outbound_profile(const ImpairmentProfile& profile);
+
+    /**
+     * @brief Change the inbound conditions; applies to subsequent messages
+     */
+    void set_inbound_profile(const ImpairmentProfile& profile);
+
+    ImpairmentStatistics get_outbound_statistics() const;
+    ImpairmentStatistics get_inbound_statistics() const;
+
+    // ITransport interface implementation
+    [[nodiscard]] Result send_message(const Message& message, const Endpoint& endpoint) override;
+    MessagePtr receive_message() override;
+    Result connect(const Endpoint& endpoint) override;
+    Result disconnect() override;
+    bool is_connected() const override;
+    Endpoint get_local_endpoint() const override;
+    void set_listener(ITransportListener* listener) override;
+    Result start() override;
+    Result stop() override;
+    bool is_running() const override;
+
+    // Disable copy and assignment
+    ImpairedTransport(const ImpairedTransport&) = delete;
+    ImpairedTransport& operator=(const ImpairedTransport&) = delete;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief State of one direction (mutex_ must be held to use it)
+     */
+    struct Direction {
+        ImpairmentProfile profile;
+        std::mt19937_64 random;
+        bool in_loss_burst{false};
+        Clock::time_point link_free;                // When the rate-limited link is idle again
+        ImpairmentStatistics statistics;
+    };
+
+    struct InFlight {
+        Clock::time_point due;
+        uint64_t sequence;                          // Keeps equal due times in send order
+        bool inbound;
+        MessagePtr message;
+        Endpoint endpoint;                          // Destination (outbound) or sender (inbound)
+
+        bool operator>(const InFlight& other) const {
+            return due != other.due ? due > other.due : sequence > other.sequence;
+        }
+    };
+
+    class InboundListener : public ITransportListener {
+    public:
+        explicit InboundListener(ImpairedTransport& owner) : owner_(owner) {}
+        void on_message_received(MessagePtr message, const Endpoint& sender) override;
+        void on_connection_lost(const Endpoint& endpoint) override;
+        void on_connection_established(const Endpoint& endpoint) override;
+        void on_error(Result error) override;
+
+    private:
+        ImpairedTransport& owner_;
+    };
+
+    /**
+     * @brief Decide the fate of a message (mutex_ must be held)
+     * @return Release times of its copies; empty if it was lost or dropped
+     */
+    std::vector<Clock::time_point> impair(Direction& direction, size_t size, Clock::time_point now);
+    Clock::time_point sample_arrival(Direction& direction, Clock::time_point departure);
+    void release(const InFlight& event);
+    void on_inbound(MessagePtr message, const Endpoint& sender);
+    void schedule_loop();
+
+    std::shared_ptr<ITransport> transport_;
+    InboundListener inbound_listener_;
+    std::atomic<ITransportListener*> listener_{nullptr};
+
+    Direction outbound_;
+    Direction inbound_;
+    std::priority_queue<InFlight, std::vector<InFlight>, std::greater<InFlight>> in_flight_;
+    uint64_t next_sequence_{0};
+    bool scheduling_{false};
+    mutable std::mutex mutex_;
+    std::condition_variable schedule_cv_;
+    std::thread schedule_thread_;
+};
+
+} // namespace transport
+} // namespace someip
+
+#endif // SOMEIP_TRANSPORT_IMPAIRED_TRANSPORT_H
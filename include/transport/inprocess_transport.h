@@ -0,0 +1,124 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_TRANSPORT_INPROCESS_TRANSPORT_H
+#define SOMEIP_TRANSPORT_INPROCESS_TRANSPORT_H
+
+#include "transport/transport.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+namespace someip {
+namespace transport {
+
+class InProcessMailbox;
+
+/**
+ * @brief In-process transport configuration
+ */
+struct InProcessTransportConfig {
+    size_t queue_capacity{4096};            // Undelivered messages per endpoint (rounded up to a power of two)
+    bool verify_serialization{false};       // Deliver a serialize/deserialize copy instead of the message
+};
+
+/**
+ * @brief Transport between endpoints of the same process
+ *
+ * Started transports register their local endpoint in a process-wide table.
+ * Sending looks the destination up there and pushes the MessagePtr into its
+ * bounded lock-free queue; no bytes are serialized and no system call is
+ * made. Each transport delivers its queue to the listener on its own thread,
+ * as the socket transports do, so upper layers see the same threading.
+ * Without a listener, messages are kept for receive_message().
+ *
+ * Endpoints are identified by address and port; the protocol is ignored.
+ * Port 0 picks an unused port from the dynamic range on start().
+ *
+ * With verify_serialization, every message is serialized and deserialized
+ * on send, and the copy is delivered. Use it in tests to catch messages the
+ * socket transports could not carry.
+ */
+class InProcessTransport : public ITransport {
+public:
+    /**
+     * @brief Constructor
+     * @param local_endpoint Endpoint to register under
+     * @param config In-process transport configuration
+     */
+    explicit InProcessTransport(const Endpoint& local_endpoint = Endpoint("127.0.0.1", 0),
+                                const InProcessTransportConfig& config = InProcessTransportConfig());
+
+    /**
+     * @brief Destructor
+     */
+    ~InProcessTransport() override;
+
+    InProcessTransport(const InProcessTransport&) = delete;
+    InProcessTransport& operator=(const InProcessTransport&) = delete;
+    InProcessTransport(InProcessTransport&&) = delete;
+    InProcessTransport& operator=(InProcessTransport&&) = delete;
+
+    /**
+     * @brief Send a copy of a message
+     * @return SUCCESS, NOT_CONNECTED if nothing is registered at the endpoint,
+     *         BUFFER_OVERFLOW if its queue is full, or INVALID_MESSAGE if
+     *         the verification round trip failed
+     */
+    [[nodiscard]] Result send_message(const Message& message, const Endpoint& endpoint) override;
+
+    /**
+     * @brief Hand a message over without copying it
+     *
+     * The receiver gets this very object, so the sender must not modify it
+     * afterwards. With verify_serialization a copy is delivered instead.
+     *
+     * @return Same as send_message(const Message&, const Endpoint&)
+     */
+    [[nodiscard]] Result send_message(MessagePtr message, const Endpoint& endpoint);
+
+    [[nodiscard]] Result send_serialized(const uint8_t* data, size_t size, const Endpoint& endpoint) override;
+    MessagePtr receive_message() override;
+    Result connect(const Endpoint& endpoint) override;
+    Result disconnect() override;
+    bool is_connected() const override;
+    Endpoint get_local_endpoint() const override;
+    void set_listener(ITransportListener* listener) override;
+    Result start() override;
+    Result stop() override;
+    bool is_running() const override;
+
+private:
+    Result send_verified(const Message& message, const Endpoint& endpoint);
+    void delivery_loop();
+
+    Endpoint local_endpoint_;
+    Endpoint requested_endpoint_;               // As given to the constructor (port 0 = pick one)
+    InProcessTransportConfig config_;
+    std::unique_ptr<InProcessMailbox> mailbox_; // Exists while running
+    std::atomic<bool> running_{false};
+    std::atomic<ITransportListener*> listener_{nullptr};
+    std::thread delivery_thread_;
+    std::mutex lifecycle_mutex_;
+
+    // Messages delivered while no listener was set
+    std::queue<MessagePtr> receive_queue_;
+    std::mutex receive_mutex_;
+};
+
+} // namespace transport
+} // namespace someip
+
+#endif // SOMEIP_TRANSPORT_INPROCESS_TRANSPORT_H
@@ -0,0 +1,91 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_TRANSPORT_MESSAGE_FILTER_H
+#define SOMEIP_TRANSPORT_MESSAGE_FILTER_H
+
+#include "common/result.h"
+#include <cstdint>
+#include <map>
+#include <set>
+#include <vector>
+
+namespace someip {
+namespace transport {
+
+/**
+ * @brief Set of SOME/IP message IDs a socket is interested in
+ *
+ * A datagram is accepted if the service ID of its first message is in
+ * service_ids, or if its (service ID, method ID) pair is in methods.
+ * An empty filter accepts nothing.
+ */
+struct MessageFilter {
+    std::set<uint16_t> service_ids;                     // Accept every method of these services
+    std::map<uint16_t, std::set<uint16_t>> methods;     // Accept only these methods of a service
+
+    void add_service(uint16_t service_id) { service_ids.insert(service_id); }
+    void add_method(uint16_t service_id, uint16_t method_id) { methods[service_id].insert(method_id); }
+    bool empty() const { return service_ids.empty() && methods.empty(); }
+
+    /**
+     * @brief Evaluate the filter in user space
+     * @return true if a message with these IDs passes the filter
+     */
+    bool matches(uint16_t service_id, uint16_t method_id) const;
+
+    bool operator==(const MessageFilter& other) const {
+        return service_ids == other.service_ids && methods == other.methods;
+    }
+    bool operator!=(const MessageFilter& other) const { return !(*this == other); }
+};
+
+/**
+ * @brief Classic BPF instruction (same layout as Linux struct sock_filter)
+ */
+struct BpfInstruction {
+    uint16_t code;
+    uint8_t jt;
+    uint8_t jf;
+    uint32_t k;
+};
+
+/**
+ * @brief Compile a message filter into a classic BPF socket filter program
+ *
+ * The program runs on UDP sockets, where offset 0 is the UDP header, so the
+ * SOME/IP service and method IDs are read at offsets 8 and 10. Datagrams too
+ * short to carry a message ID are dropped.
+ *
+ * @param filter Message IDs to accept
+ * @param program Compiled program (output)
+ * @return SUCCESS, or RESOURCE_EXHAUSTED if the program exceeds the kernel limit
+ */
+Result compile_message_filter(const MessageFilter& filter, std::vector<BpfInstruction>& program);
+
+/**
+ * @brief Run a compiled program against a UDP payload
+ *
+ * Interprets the subset of classic BPF emitted by compile_message_filter().
+ *
+ * @param program Compiled program
+ * @param udp_payload Datagram payload (without UDP header)
+ * @return true if the datagram would be accepted
+ */
+bool run_message_filter(const std::vector<BpfInstruction>& program,
+                        const std::vector<uint8_t>& udp_payload);
+
+} // namespace transport
+} // namespace someip
+
+#endif // SOMEIP_TRANSPORT_MESSAGE_FILTER_H
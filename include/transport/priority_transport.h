@@ -0,0 +1,170 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_TRANSPORT_PRIORITY_TRANSPORT_H
+#define SOMEIP_TRANSPORT_PRIORITY_TRANSPORT_H
+
+#include "transport/transport.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace someip {
+namespace transport {
+
+class UdpTransport;
+
+/**
+ * @brief Send queue parameters of one traffic class
+ */
+struct TrafficClassConfig {
+    uint32_t weight{1};                     // Share of sends under WEIGHTED scheduling
+    int socket_priority{0};                 // SO_PRIORITY of this class's datagrams (UDP)
+    uint8_t dscp{0};                        // DSCP code point of this class's datagrams (UDP)
+    size_t queue_capacity{1024};            // Queued messages before send_message() fails
+};
+
+/**
+ * @brief How the next message is chosen among the traffic classes
+ */
+enum class SchedulingPolicy : uint8_t {
+    STRICT_PRIORITY,    // Lowest class index with queued messages always goes first
+    WEIGHTED            // Weighted round robin over the class weights
+};
+
+/**
+ * @brief Priority transport configuration
+ *
+ * Class 0 has the highest priority. The defaults provide a critical class
+ * (expedited forwarding), a default class and a bulk class for large
+ * transfers such as TP segment trains.
+ */
+struct PriorityTransportConfig {
+    SchedulingPolicy policy{SchedulingPolicy::STRICT_PRIORITY};
+    std::vector<TrafficClassConfig> classes{
+        TrafficClassConfig{8, 6, 46, 1024},  // 0: critical - EF
+        TrafficClassConfig{4, 0, 0, 1024},   // 1: default - best effort
+        TrafficClassConfig{1, 1, 8, 4096}    // 2: bulk - CS1
+    };
+    uint8_t default_class{1};               // Class of unclassified messages
+};
+
+/**
+ * @brief Transport decorator that schedules outgoing messages by traffic class
+ *
+ * Messages are classified by service and method/event ID and queued per
+ * class; a sender thread drains the queues in strict-priority or weighted
+ * order and sends through the wrapped transport. Because the scheduler
+ * picks one message at a time, a long train of TP segments in a low class
+ * is preempted between segments by any message of a higher class. When the
+ * wrapped transport is a UdpTransport, each datagram carries the SO_PRIORITY
+ * and DSCP marking of its class (see UdpTransport::send_message()).
+ *
+ * Receiving, connection handling and listener events are passed through.
+ * Send errors of queued messages are reported via on_error().
+ */
+class PriorityTransport : public ITransport {
+public:
+    /**
+     * @brief Constructor
+     * @param transport Transport to send through
+     * @param config Traffic classes and scheduling policy
+     */
+    explicit PriorityTransport(std::shared_ptr<ITransport> transport,
+                               const PriorityTransportConfig& config = PriorityTransportConfig());
+    ~PriorityTransport() override;
+
+    /**
+     * @brief Assign a traffic class to all messages of a service
+     * @return SUCCESS, or INVALID_ARGUMENT for an unknown class
+     */
+    [[nodiscard]] Result set_traffic_class(uint16_t service_id, uint8_t traffic_class);
+
+    /**
+     * @brief Assign a traffic class to one method or event of a service
+     *
+     * Takes precedence over the class of the service.
+     *
+     * @return SUCCESS, or INVALID_ARGUMENT for an unknown class
+     */
+    [[nodiscard]] Result set_traffic_class(uint16_t service_id, uint16_t method_id, uint8_t traffic_class);
+
+    /**
+     * @brief Get the traffic class a message is queued in
+     */
+    uint8_t classify(const Message& message) const;
+
+    /**
+     * @brief Queue a message in an explicit traffic class
+     * @return SUCCESS, INVALID_ARGUMENT for an unknown class, or
+     *         RESOURCE_EXHAUSTED if the class queue is full
+     */
+    [[nodiscard]] Result send_message(const Message& message, const Endpoint& endpoint, uint8_t traffic_class);
+
+    /**
+     * @brief Get the number of messages queued in a class
+     */
+    size_t get_queued(uint8_t traffic_class) const;
+
+    // ITransport interface implementation
+    [[nodiscard]] Result send_message(const Message& message, const Endpoint& endpoint) override;
+    MessagePtr receive_message() override;
+    Result connect(const Endpoint& endpoint) override;
+    Result disconnect() override;
+    bool is_connected() const override;
+    Endpoint get_local_endpoint() const override;
+    void set_listener(ITransportListener* listener) override;
+    Result start() override;
+    Result stop() override;
+    bool is_running() const override;
+
+    // Disable copy and assignment
+    PriorityTransport(const PriorityTransport&) = delete;
+    PriorityTransport& operator=(const PriorityTransport&) = delete;
+
+private:
+    struct QueuedMessage {
+        Message message;
+        Endpoint endpoint;
+    };
+
+    void send_loop();
+    uint8_t pick_class();
+
+    std::shared_ptr<ITransport> transport_;
+    UdpTransport* udp_;                                         // transport_ if it is UDP, for marking
+    PriorityTransportConfig config_;
+    std::atomic<ITransportListener*> listener_{nullptr};
+
+    std::unordered_map<uint32_t, uint8_t> classes_;             // service_id << 16 | method_id
+    std::unordered_map<uint16_t, uint8_t> service_classes_;
+    mutable std::mutex classes_mutex_;
+
+    std::vector<std::deque<QueuedMessage>> queues_;             // One per traffic class
+    size_t queued_{0};
+    uint8_t weighted_class_{0};                                 // WEIGHTED: class being served
+    uint32_t weighted_credit_{0};                               // WEIGHTED: sends left in its turn
+    bool sending_{false};
+    mutable std::mutex queue_mutex_;
+    std::condition_variable queue_cv_;
+    std::thread send_thread_;
+};
+
+} // namespace transport
+} // namespace someip
+
+#endif // SOMEIP_TRANSPORT_PRIORITY_TRANSPORT_H
@@ -0,0 +1,83 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_TRANSPORT_RECORDING_TRANSPORT_H
+#define SOMEIP_TRANSPORT_RECORDING_TRANSPORT_H
+
+#include "transport/traffic_recorder.h"
+#include "transport/transport.h"
+#include <atomic>
+#include <memory>
+
+namespace someip {
+namespace transport {
+
+/**
+ * @brief Transport decorator that records all traffic to a TrafficRecorder
+ *
+ * Successfully sent messages are recorded as SENT; messages delivered
+ * through the listener are recorded as RECEIVED before the application sees
+ * them. The recorder may be shared by several transports. receive_message()
+ * is passed through, since the inner transport reports every message to the
+ * listener as well.
+ */
+class RecordingTransport : public ITransport {
+public:
+    /**
+     * @brief Constructor
+     * @param transport Transport to record; the decorator becomes its listener
+     * @param recorder Open recorder to write to
+     */
+    RecordingTransport(std::shared_ptr<ITransport> transport, std::shared_ptr<TrafficRecorder> recorder);
+    ~RecordingTransport() override;
+
+    // ITransport interface implementation
+    [[nodiscard]] Result send_message(const Message& message, const Endpoint& endpoint) override;
+    [[nodiscard]] Result send_serialized(const uint8_t* data, size_t size, const Endpoint& endpoint) override;
+    MessagePtr receive_message() override;
+    Result connect(const Endpoint& endpoint) override;
+    Result disconnect() override;
+    bool is_connected() const override;
+    Endpoint get_local_endpoint() const override;
+    void set_listener(ITransportListener* listener) override;
+    Result start() override;
+    Result stop() override;
+    bool is_running() const override;
+
+    // Disable copy and assignment
+    RecordingTransport(const RecordingTransport&) = delete;
+    RecordingTransport& operator=(const RecordingTransport&) = delete;
+
+private:
+    class InboundListener : public ITransportListener {
+    public:
+        explicit InboundListener(RecordingTransport& owner) : owner_(owner) {}
+        void on_message_received(MessagePtr message, const Endpoint& sender) override;
+        void on_connection_lost(const Endpoint& endpoint) override;
+        void on_connection_established(const Endpoint& endpoint) override;
+        void on_error(Result error) override;
+
+    private:
+        RecordingTransport& owner_;
+    };
+
+    std::shared_ptr<ITransport> transport_;
+    std::shared_ptr<TrafficRecorder> recorder_;
+    InboundListener inbound_listener_;
+    std::atomic<ITransportListener*> listener_{nullptr};
+};
+
+} // namespace transport
+} // namespace someip
+
+#endif // SOMEIP_TRANSPORT_RECORDING_TRANSPORT_H
@@ -192,6 +192,8 @@ private:
     std::atomic<bool> running_{false};
     std::thread receive_thread_;
     std::thread connection_thread_;
+    std::mutex stop_mutex_;
+    std::condition_variable stop_cv_;                   // Wakes idle waits in stop()
 
     // Connection management
     std::atomic<size_t> active_connections_{0};
@@ -213,6 +215,7 @@ private:
     Result connect_internal(const Endpoint& endpoint);
     void disconnect_internal();
     void receive_loop();
+    bool wait_for_stop(std::chrono::milliseconds timeout);
     void connection_monitor_loop();
     Result send_data(int socket_fd, const std::vector<uint8_t>& data);
     Result receive_data(int socket_fd, std::vector<uint8_t>& data);
@@ -0,0 +1,204 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_TRANSPORT_TRAFFIC_RECORDER_H
+#define SOMEIP_TRANSPORT_TRAFFIC_RECORDER_H
+
+#include "someip/message.h"
+#include "transport/endpoint.h"
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace someip {
+namespace transport {
+
+/**
+ * @brief Whether a recorded frame was sent or received by the node
+ */
+enum class TrafficDirection : uint8_t {
+    SENT = 0,
+    RECEIVED = 1
+};
+
+/**
+ * @brief Traffic recorder configuration
+ */
+struct TrafficRecorderConfig {
+    std::string path;                               // Segments are written to <path>.000000, <path>.000001, ...
+    size_t segment_size{64 * 1024 * 1024};          // Frame bytes per segment (at most 4 GiB)
+    size_t max_segments{0};                         // Oldest segments are deleted beyond this (0 = keep all)
+};
+
+/**
+ * @brief Append-only recorder of SOME/IP frames into memory-mapped segment files
+ *
+ * Each segment holds a header, a compact index of (timestamp, offset,
+ * message ID) entries and the records themselves: timestamp, direction,
+ * peer endpoint and the raw frame. Records are copied into the mapping
+ * under a short lock and the kernel writes them back, so recording costs a
+ * memcpy rather than a system call. When a segment is full the recorder
+ * moves on to the next one.
+ *
+ * Timestamps are wall-clock nanoseconds taken when the frame is recorded.
+ * They never decrease within a segment, so readers can binary-search them.
+ * Thread-safe.
+ */
+class TrafficRecorder {
+public:
+    TrafficRecorder() = default;
+    ~TrafficRecorder();
+
+    TrafficRecorder(const TrafficRecorder&) = delete;
+    TrafficRecorder& operator=(const TrafficRecorder&) = delete;
+
+    /**
+     * @brief Create the first segment, after any segments already at the path
+     * @return true on success
+     */
+    bool open(const TrafficRecorderConfig& config);
+
+    /**
+     * @brief Unmap and close the current segment
+     */
+    void close();
+
+    bool is_open() const;
+
+    /**
+     * @brief Record a message as it is (or would be) on the wire
+     * @return false if not open or the frame does not fit in a segment
+     */
+    bool record(TrafficDirection direction, const Message& message, const Endpoint& peer);
+
+    /**
+     * @brief Record an already serialized frame
+     */
+    bool record(TrafficDirection direction, const uint8_t* frame, size_t size, const Endpoint& peer);
+
+    uint64_t get_recorded() const { return recorded_.load(std::memory_order_relaxed); }
+    uint64_t get_dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Get the path of the segment being written
+     */
+    std::string get_segment_path() const;
+
+private:
+    bool open_segment();
+    void close_segment();
+
+    /**
+     * @brief Write the record header and index entry (mutex_ must be held)
+     * @return Where the frame goes, or nullptr if it cannot be recorded
+     */
+    uint8_t* reserve(TrafficDirection direction, uint32_t message_id, size_t frame_size, const Endpoint& peer);
+
+    /**
+     * @brief Publish the reserved record to readers (mutex_ must be held)
+     */
+    void commit(size_t frame_size);
+
+    TrafficRecorderConfig config_;
+    uint64_t segment_number_{0};
+    std::string segment_path_;
+    int fd_{-1};
+    uint8_t* map_{nullptr};
+    size_t map_size_{0};
+    uint64_t index_capacity_{0};
+    uint64_t data_capacity_{0};
+    uint64_t record_count_{0};
+    uint64_t data_used_{0};
+    uint64_t last_timestamp_{0};
+    std::atomic<uint64_t> recorded_{0};
+    std::atomic<uint64_t> dropped_{0};
+    mutable std::mutex mutex_;
+};
+
+/**
+ * @brief One recorded frame; frame points into the reader's mapping
+ */
+struct TrafficRecord {
+    uint64_t timestamp_ns{0};                       // Unix time in nanoseconds
+    TrafficDirection direction{TrafficDirection::SENT};
+    uint32_t message_id{0};                         // Service ID << 16 | method ID
+    Endpoint peer;                                  // Destination of sent, source of received frames
+    const uint8_t* frame{nullptr};
+    size_t size{0};
+
+    /**
+     * @brief Parse the frame into a message
+     */
+    bool to_message(Message& message) const;
+};
+
+/**
+ * @brief Read-only access to one segment written by TrafficRecorder
+ *
+ * The segment may still be being written; size() grows as records are
+ * committed. Lookups by time and service use the index only.
+ */
+class TrafficLogReader {
+public:
+    TrafficLogReader() = default;
+    ~TrafficLogReader();
+
+    TrafficLogReader(const TrafficLogReader&) = delete;
+    TrafficLogReader& operator=(const TrafficLogReader&) = delete;
+
+    /**
+     * @brief Map a segment file
+     * @return false if it cannot be read or is not a recording
+     */
+    bool open(const std::string& segment_path);
+
+    void close();
+
+    /**
+     * @brief Number of committed records
+     */
+    size_t size() const;
+
+    /**
+     * @brief Read record number index (0 = oldest)
+     */
+    bool read(size_t index, TrafficRecord& record) const;
+
+    /**
+     * @brief Find the first record at or after a time
+     * @return Record number, or size() if there is none
+     */
+    size_t seek(uint64_t timestamp_ns) const;
+
+    /**
+     * @brief Find the next record of a service, starting at record number from
+     * @return Record number, or size() if there is none
+     */
+    size_t find_next(size_t from, uint16_t service_id) const;
+
+    /**
+     * @brief List the segments recorded under a path, oldest first
+     */
+    static std::vector<std::string> list_segments(const std::string& path);
+
+private:
+    const uint8_t* map_{nullptr};
+    size_t map_size_{0};
+};
+
+} // namespace transport
+} // namespace someip
+
+#endif // SOMEIP_TRANSPORT_TRAFFIC_RECORDER_H
@@ -77,6 +77,27 @@ public:
      */
     [[nodiscard]] virtual Result send_message(const Message& message, const Endpoint& endpoint) = 0;
 
+    /**
+     * @brief Send an already serialized message
+     *
+     * Lets callers that build messages in place skip Message construction
+     * and serialization. The default implementation parses the bytes and
+     * calls send_message(); transports that can write the bytes as they are
+     * override it.
+     *
+     * @param data Serialized SOME/IP message (header and payload)
+     * @param size Number of bytes
+     * @param endpoint The destination endpoint
+     * @return Result of the operation
+     */
+    [[nodiscard]] virtual Result send_serialized(const uint8_t* data, size_t size, const Endpoint& endpoint) {
+        Message message;
+        if (!message.deserialize(std::vector<uint8_t>(data, data + size))) {
+            return Result::INVALID_MESSAGE;
+        }
+        return send_message(message, endpoint);
+    }
+
     /**
      * @brief Receive a message (non-blocking)
      * @return Received message or nullptr if no message available
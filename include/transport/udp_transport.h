@@ -15,11 +15,13 @@
 #define SOMEIP_TRANSPORT_UDP_TRANSPORT_H
 
 #include "transport/transport.h"
+#include "transport/message_filter.h"
 #include <thread>
 #include <atomic>
 #include <mutex>
 #include <queue>
 #include <condition_variable>
+#include <optional>
 #include <netinet/in.h>
 
 namespace someip {
@@ -39,6 +41,8 @@ struct UdpTransportConfig {
     bool enable_broadcast{false};           // Enable broadcast sending
     std::string multicast_interface{};      // Interface for multicast (empty = INADDR_ANY)
     int multicast_ttl{1};                   // Multicast TTL (1 = local network only)
+    int socket_priority{0};                 // SO_PRIORITY (Linux queueing discipline band)
+    uint8_t dscp{0};                        // DSCP code point written to IP_TOS (0 = best effort)
 
     // SOME/IP spec recommends max 1400 bytes to avoid IP fragmentation
     // Set to 0 to disable this check
@@ -72,6 +76,7 @@ public:
 
     // ITransport interface implementation
     [[nodiscard]] Result send_message(const Message& message, const Endpoint& endpoint) override;
+    [[nodiscard]] Result send_serialized(const uint8_t* data, size_t size, const Endpoint& endpoint) override;
     MessagePtr receive_message() override;
     Result connect(const Endpoint& endpoint) override;
     Result disconnect() override;
@@ -82,10 +87,79 @@ public:
     Result stop() override;
     bool is_running() const override;
 
+    /**
+     * @brief Send several messages to one endpoint in as few datagrams as possible
+     *
+     * Messages are packed back to back (as allowed by SOME/IP over UDP) into
+     * datagrams of at most max_message_size bytes. Each message passes the
+     * same size check as send_message(): one larger than max_message_size
+     * is accepted and sent in a datagram of its own, one that does not fit
+     * in a UDP datagram fails the whole batch with BUFFER_OVERFLOW before
+     * anything is sent. Receivers built on this transport split such
+     * datagrams into their messages.
+     *
+     * If sending a datagram fails, the datagrams before it have already been
+     * sent and the rest of the batch is not: the call is not atomic, and a
+     * caller that retries may deliver the leading messages twice.
+     *
+     * @param messages Messages to send, in order
+     * @param endpoint Destination endpoint
+     * @return SUCCESS, or the first error encountered
+     */
+    [[nodiscard]] Result send_messages(const std::vector<Message>& messages, const Endpoint& endpoint);
+
     // Multicast support
     Result join_multicast_group(const std::string& multicast_address);
     Result leave_multicast_group(const std::string& multicast_address);
 
+    /**
+     * @brief Drop datagrams for other message IDs in the kernel
+     *
+     * Compiles the filter into a classic BPF socket filter (SO_ATTACH_FILTER),
+     * so unwanted datagrams never wake the receive thread. The filter can be
+     * set before start() and replaced at any time. Only the first message of
+     * a datagram is inspected.
+     *
+     * @param filter Message IDs to accept
+     * @return SUCCESS, RESOURCE_EXHAUSTED if the filter is too large, or
+     *         NOT_IMPLEMENTED on platforms without socket filters
+     */
+    Result set_message_filter(const MessageFilter& filter);
+
+    /**
+     * @brief Remove the kernel message filter and accept all datagrams
+     * @return Result of the operation
+     */
+    Result clear_message_filter();
+
+    /**
+     * @brief Send one message with its own SO_PRIORITY and DSCP marking
+     *
+     * The marking is passed to sendmsg() as control data, so it costs no
+     * extra system call and leaves the socket marking used by concurrent
+     * senders untouched. Kernels that do not take SO_PRIORITY as control
+     * data (before Linux 6.7) send the datagram with its DSCP marking only.
+     *
+     * @param socket_priority SO_PRIORITY value (0-6 without CAP_NET_ADMIN)
+     * @param dscp DSCP code point (0-63)
+     * @return As send_message(), or INVALID_ARGUMENT for an invalid marking
+     */
+    [[nodiscard]] Result send_message(const Message& message, const Endpoint& endpoint,
+                                      int socket_priority, uint8_t dscp);
+
+    /**
+     * @brief Change the SO_PRIORITY and DSCP marking of the socket
+     *
+     * Applies to every datagram sent without a marking of its own. Can be
+     * called before start() and at any time after; unchanged values cost no
+     * system call.
+     *
+     * @param socket_priority SO_PRIORITY value (0-6 without CAP_NET_ADMIN)
+     * @param dscp DSCP code point (0-63)
+     * @return SUCCESS, INVALID_ARGUMENT, or NETWORK_ERROR if the kernel refused
+     */
+    Result set_traffic_marking(int socket_priority, uint8_t dscp);
+
 private:
     Endpoint local_endpoint_;
     UdpTransportConfig config_;
@@ -101,6 +175,10 @@ private:
 
     // Socket management
     std::mutex socket_mutex_;
+    std::optional<std::vector<BpfInstruction>> filter_program_;  // Guarded by socket_mutex_
+    int applied_priority_{0};                                   // Guarded by socket_mutex_
+    uint8_t applied_dscp_{0};                                   // Guarded by socket_mutex_
+    bool priority_cmsg_{true};                                  // Kernel takes SO_PRIORITY control data
 
     // Constants
     static constexpr size_t MAX_UDP_PAYLOAD = 65507; // Maximum UDP payload size
@@ -109,8 +187,14 @@ private:
     Result create_socket();
     Result bind_socket();
     Result configure_multicast(const Endpoint& endpoint);
+    Result apply_message_filter();
+    Result apply_traffic_marking(int socket_priority, uint8_t dscp);
     void receive_loop();
+    Result check_message_size(size_t size) const;
     Result send_data(const std::vector<uint8_t>& data, const Endpoint& endpoint);
+    Result send_data(const uint8_t* data, size_t size, const Endpoint& endpoint);
+    Result send_data(const uint8_t* data, size_t size, const Endpoint& endpoint,
+                     int socket_priority, uint8_t dscp);
     Result receive_data(std::vector<uint8_t>& data, Endpoint& sender);
     sockaddr_in create_sockaddr(const Endpoint& endpoint) const;
     Endpoint sockaddr_to_endpoint(const sockaddr_in& addr) const;
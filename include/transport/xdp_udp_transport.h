@@ -0,0 +1,234 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_TRANSPORT_XDP_UDP_TRANSPORT_H
+#define SOMEIP_TRANSPORT_XDP_UDP_TRANSPORT_H
+
+#include "transport/transport.h"
+#include "transport/udp_transport.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <unordered_map>
+
+namespace someip {
+namespace transport {
+
+/**
+ * @brief AF_XDP transport configuration
+ *
+ * Frame and ring sizes must be powers of two. Half of the UMEM frames are
+ * posted to the fill ring for reception, the other half form the TX pool.
+ */
+struct XdpTransportConfig {
+    std::string interface_name{};           // Interface to attach to (empty = kernel UDP only)
+    uint32_t queue_id{0};                   // RX queue bound to the XSK socket
+    uint32_t frame_count{4096};             // Number of UMEM frames
+    uint32_t frame_size{2048};              // Size of one UMEM frame (2048 or 4096)
+    uint32_t ring_size{2048};               // Size of each descriptor ring
+    bool generic_mode{true};                // Attach in generic/SKB mode with copy binding
+    bool fallback_to_udp{true};             // Run on UdpTransport if AF_XDP is unavailable
+    std::chrono::milliseconds neighbor_refresh_interval{1000};  // Period of neighbour table re-reads
+    std::chrono::milliseconds neighbor_miss_delay{100};         // Minimum gap between miss-triggered re-reads
+    UdpTransportConfig udp_config{};        // Configuration of the kernel UDP path
+};
+
+/**
+ * @brief AF_XDP data path counters
+ */
+struct XdpStatistics {
+    uint64_t rx_packets{0};                 // Datagrams received through the XSK socket
+    uint64_t tx_packets{0};                 // Datagrams sent through the XSK socket
+    uint64_t tx_kernel_path{0};             // Datagrams sent through the kernel UDP socket
+    uint64_t rx_dropped{0};                 // Frames that did not decode to a SOME/IP message
+    uint64_t tx_ring_full{0};               // Sends rejected because no TX frame was free
+};
+
+/**
+ * @brief Addressing of an Ethernet/IPv4/UDP frame
+ *
+ * IPv4 addresses and ports are in host byte order.
+ */
+struct XdpFrameAddress {
+    std::array<uint8_t, 6> src_mac{};
+    std::array<uint8_t, 6> dst_mac{};
+    uint32_t src_ip{0};
+    uint32_t dst_ip{0};
+    uint16_t src_port{0};
+    uint16_t dst_port{0};
+};
+
+/**
+ * @brief UDP transport backed by an AF_XDP socket
+ *
+ * Incoming datagrams for the local port are redirected by a small XDP program
+ * into a preallocated UMEM frame pool and decoded in user space; outgoing
+ * messages are encapsulated into Ethernet/IPv4/UDP frames and placed directly
+ * on the TX ring. The program is attached in generic (SKB) mode by default so
+ * it works on veth pairs and any NIC without native XDP support.
+ *
+ * A kernel UdpTransport bound to the same endpoint is always kept alongside.
+ * It is used when AF_XDP cannot be set up (missing privileges, interface or
+ * kernel support), for destinations whose link-layer address is not yet known
+ * (the kernel resolves it via ARP), for loopback destinations and for messages
+ * that do not fit in a single UMEM frame.
+ *
+ * Link-layer addresses are looked up in a cache that a background thread
+ * rebuilds from the kernel neighbour table every neighbor_refresh_interval,
+ * so entries the kernel drops age out. A send to an unknown destination
+ * only wakes that thread, no sooner than neighbor_miss_delay after the
+ * previous read; the send path never reads the table itself.
+ */
+class XdpUdpTransport : public ITransport {
+public:
+    /**
+     * @brief Constructor
+     * @param local_endpoint Local endpoint to bind to
+     * @param config AF_XDP transport configuration
+     */
+    explicit XdpUdpTransport(const Endpoint& local_endpoint,
+                             const XdpTransportConfig& config = XdpTransportConfig());
+
+    /**
+     * @brief Destructor
+     */
+    ~XdpUdpTransport() override;
+
+    // ITransport interface implementation
+    [[nodiscard]] Result send_message(const Message& message, const Endpoint& endpoint) override;
+    MessagePtr receive_message() override;
+    Result connect(const Endpoint& endpoint) override;
+    Result disconnect() override;
+    bool is_connected() const override;
+    Endpoint get_local_endpoint() const override;
+    void set_listener(ITransportListener* listener) override;
+    Result start() override;
+    Result stop() override;
+    bool is_running() const override;
+
+    // Multicast support (membership is managed by the kernel UDP path)
+    Result join_multicast_group(const std::string& multicast_address);
+    Result leave_multicast_group(const std::string& multicast_address);
+
+    /**
+     * @brief Check whether the AF_XDP data path is in use
+     * @return true if the XSK socket is bound and the XDP program attached
+     */
+    bool is_xdp_active() const;
+
+    /**
+     * @brief Get data path counters
+     * @return Current statistics
+     */
+    XdpStatistics get_statistics() const;
+
+    /**
+     * @brief Size of the Ethernet, IPv4 and UDP headers written by encapsulate()
+     */
+    static constexpr size_t FRAME_HEADER_SIZE = 14 + 20 + 8;
+
+    /**
+     * @brief Build an Ethernet/IPv4/UDP frame around a payload
+     * @param address Frame addressing
+     * @param payload Payload bytes
+     * @param payload_size Number of payload bytes
+     * @param frame Output buffer
+     * @param frame_capacity Size of the output buffer
+     * @return Frame length, or 0 if the frame does not fit
+     */
+    static size_t encapsulate(const XdpFrameAddress& address, const uint8_t* payload,
+                              size_t payload_size, uint8_t* frame, size_t frame_capacity);
+
+    /**
+     * @brief Parse an Ethernet/IPv4/UDP frame
+     *
+     * Only unfragmented IPv4 datagrams are accepted. IP options are skipped.
+     *
+     * @param frame Frame bytes
+     * @param frame_size Frame length
+     * @param address Decoded addressing (output)
+     * @param payload Start of the UDP payload within the frame (output)
+     * @param payload_size UDP payload length (output)
+     * @return true if the frame is a well-formed UDP datagram
+     */
+    static bool decapsulate(const uint8_t* frame, size_t frame_size, XdpFrameAddress& address,
+                            const uint8_t*& payload, size_t& payload_size);
+
+    /**
+     * @brief Parse the complete entries of a kernel ARP table (/proc/net/arp format)
+     * @param table Table text, including its header line
+     * @param interface_name Only entries of this device are returned
+     * @return IPv4 address in host order -> MAC
+     */
+    static std::unordered_map<uint32_t, std::array<uint8_t, 6>> parse_arp_table(
+        std::istream& table, const std::string& interface_name);
+
+private:
+    struct XskState;
+
+    Endpoint local_endpoint_;
+    XdpTransportConfig config_;
+    std::unique_ptr<UdpTransport> kernel_path_;
+    std::unique_ptr<XskState> xsk_;
+    std::atomic<bool> running_{false};
+    std::thread receive_thread_;
+    ITransportListener* listener_{nullptr};
+
+    // Thread-safe queue of messages received through the XSK socket
+    std::queue<MessagePtr> receive_queue_;
+    std::mutex queue_mutex_;
+
+    // TX and completion rings are shared by all senders; also guards xsk_
+    // against teardown while a sender uses the rings and UMEM
+    mutable std::mutex tx_mutex_;
+
+    // Link-layer address cache (IPv4 in host order -> MAC), rebuilt by neighbor_thread_
+    std::unordered_map<uint32_t, std::array<uint8_t, 6>> neighbor_cache_;
+    bool neighbor_refresh_requested_{false};
+    std::mutex neighbor_mutex_;
+    std::condition_variable neighbor_cv_;
+    std::thread neighbor_thread_;
+
+    // Data path counters (see XdpStatistics)
+    std::atomic<uint64_t> rx_packets_{0};
+    std::atomic<uint64_t> tx_packets_{0};
+    std::atomic<uint64_t> tx_kernel_path_{0};
+    std::atomic<uint64_t> rx_dropped_{0};
+    std::atomic<uint64_t> tx_ring_full_{0};
+
+    Result setup_xdp();
+    void teardown_xdp();
+    void receive_loop();
+    Result send_frame(const Message& message, const Endpoint& endpoint, const std::vector<uint8_t>& data,
+                      uint32_t dst_ip, const std::array<uint8_t, 6>& dst_mac);
+    Result send_kernel_path(const Message& message, const Endpoint& endpoint);
+    void reclaim_tx_frames();
+    bool resolve_neighbor(uint32_t ip, std::array<uint8_t, 6>& mac);
+    void refresh_neighbors();
+    void neighbor_loop();
+
+    // Disable copy and assignment
+    XdpUdpTransport(const XdpUdpTransport&) = delete;
+    XdpUdpTransport& operator=(const XdpUdpTransport&) = delete;
+};
+
+} // namespace transport
+} // namespace someip
+
+#endif // SOMEIP_TRANSPORT_XDP_UDP_TRANSPORT_H
@@ -42,6 +42,7 @@ std::string to_string(Result result) {
         {Result::INTERNAL_ERROR, "INTERNAL_ERROR"},
         {Result::NOT_INITIALIZED, "NOT_INITIALIZED"},
         {Result::INVALID_STATE, "INVALID_STATE"},
+        {Result::WOULD_BLOCK, "WOULD_BLOCK"},
         {Result::UNKNOWN_ERROR, "UNKNOWN_ERROR"}
     };
 
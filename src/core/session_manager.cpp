@@ -20,76 +20,107 @@ namespace someip {
  * @implements REQ_ARCH_002
  * @implements REQ_ARCH_003
  *
- * Thread-safe session management using mutex protection.
+ * Lock-free session management: IDs come from an atomic counter and slots
+ * are claimed and released with compare-and-swap.
  */
 
-SessionManager::SessionManager() = default;
+SessionManager::SessionManager(bool track_sessions)
+    : slots_(track_sessions ? std::make_unique<Slot[]>(SESSION_SLOTS) : nullptr) {
+}
+
+int64_t SessionManager::now_ticks() {
+    return std::chrono::steady_clock::now().time_since_epoch().count();
+}
 
 /**
  * @brief Create a new session
  * @implements REQ_ARCH_002
  */
 uint16_t SessionManager::create_session(uint16_t client_id) {
-    std::scoped_lock lock(sessions_mutex_);
-
-    uint16_t session_id = get_next_session_id();
+    if (!slots_) {
+        return allocator_.next();
+    }
 
-    auto session = std::make_shared<Session>(session_id, client_id);
-    sessions_[session_id] = session;
+    // Skip IDs still in flight; give up after one full cycle instead of spinning
+    for (size_t attempt = 0; attempt < SESSION_SLOTS - 1; ++attempt) {
+        uint16_t session_id = allocator_.next();
+        Slot& slot = slots_[session_id];
+        if (slot.owner.load(std::memory_order_relaxed) != 0) {
+            continue;
+        }
+        // Stamp the slot before claiming it: the CAS publishes the timestamp,
+        // so cleanup never sees the new owner with the previous one's activity
+        slot.last_activity.store(now_ticks(), std::memory_order_relaxed);
+        uint32_t expected = 0;
+        if (slot.owner.compare_exchange_strong(expected, ACTIVE_FLAG | client_id,
+                                               std::memory_order_acq_rel)) {
+            active_count_.fetch_add(1, std::memory_order_relaxed);
+            return session_id;
+        }
+    }
 
-    return session_id;
+    return 0;
 }
 
-std::shared_ptr<Session> SessionManager::get_session(uint16_t session_id) {
-    std::scoped_lock lock(sessions_mutex_);
+std::shared_ptr<Session> SessionManager::get_session(uint16_t session_id) const {
+    if (!slots_ || session_id == 0) {
+        return nullptr;
+    }
 
-    auto it = sessions_.find(session_id);
-    if (it != sessions_.end()) {
-        return it->second;
+    const Slot& slot = slots_[session_id];
+    uint32_t owner = slot.owner.load(std::memory_order_acquire);
+    if (owner == 0) {
+        return nullptr;
     }
 
-    return nullptr;
+    auto session = std::make_shared<Session>(session_id, static_cast<uint16_t>(owner & 0xFFFF));
+    session->last_activity = std::chrono::steady_clock::time_point(
+        std::chrono::steady_clock::duration(slot.last_activity.load(std::memory_order_relaxed)));
+    return session;
 }
 
 void SessionManager::remove_session(uint16_t session_id) {
-    std::scoped_lock lock(sessions_mutex_);
+    if (!slots_ || session_id == 0) {
+        return;
+    }
 
-    sessions_.erase(session_id);
+    if (slots_[session_id].owner.exchange(0, std::memory_order_acq_rel) != 0) {
+        active_count_.fetch_sub(1, std::memory_order_relaxed);
+    }
 }
 
-bool SessionManager::validate_session(uint16_t session_id) {
-    std::scoped_lock lock(sessions_mutex_);
-
-    auto it = sessions_.find(session_id);
-    if (it == sessions_.end()) {
+bool SessionManager::validate_session(uint16_t session_id) const {
+    if (!slots_ || session_id == 0) {
         return false;
     }
 
-    return it->second->state == SessionState::ACTIVE;
+    return slots_[session_id].owner.load(std::memory_order_acquire) != 0;
 }
 
 void SessionManager::update_session_activity(uint16_t session_id) {
-    std::scoped_lock lock(sessions_mutex_);
-
-    auto it = sessions_.find(session_id);
-    if (it != sessions_.end()) {
-        it->second->update_activity();
+    if (validate_session(session_id)) {
+        slots_[session_id].last_activity.store(now_ticks(), std::memory_order_relaxed);
     }
 }
 
 size_t SessionManager::cleanup_expired_sessions(std::chrono::seconds timeout) {
-    std::scoped_lock lock(sessions_mutex_);
+    if (!slots_) {
+        return 0;
+    }
 
+    const int64_t now = now_ticks();
+    const int64_t limit = std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout).count();
     size_t cleaned_count = 0;
-    auto it = sessions_.begin();
 
-    while (it != sessions_.end()) {
-        if (it->second->is_expired(timeout)) {
-            it->second->state = SessionState::EXPIRED;
-            it = sessions_.erase(it);
+    for (size_t session_id = 1; session_id < SESSION_SLOTS; ++session_id) {
+        Slot& slot = slots_[session_id];
+        uint32_t owner = slot.owner.load(std::memory_order_acquire);
+        if (owner == 0 || now - slot.last_activity.load(std::memory_order_relaxed) <= limit) {
+            continue;
+        }
+        if (slot.owner.compare_exchange_strong(owner, 0, std::memory_order_acq_rel)) {
+            active_count_.fetch_sub(1, std::memory_order_relaxed);
             cleaned_count++;
-        } else {
-            ++it;
         }
     }
 
@@ -97,37 +128,11 @@ size_t SessionManager::cleanup_expired_sessions(std::chrono::seconds timeout) {
 }
 
 uint16_t SessionManager::get_next_session_id() {
-    // Find the next available session ID for this client
-    // SOME/IP session IDs should not be 0
-    uint16_t candidate = next_session_id_;
-
-    // Simple linear search for available ID (could be optimized)
-    while (sessions_.find(candidate) != sessions_.end()) {
-        candidate++;
-        if (candidate == 0) { // Wrap around, skip 0
-            candidate = 1;
-        }
-    }
-
-    next_session_id_ = candidate + 1;
-    if (next_session_id_ == 0) {
-        next_session_id_ = 1;
-    }
-
-    return candidate;
+    return allocator_.next();
 }
 
 size_t SessionManager::get_active_session_count() const {
-    std::scoped_lock lock(sessions_mutex_);
-
-    size_t count = 0;
-    for (const auto& pair : sessions_) {
-        if (pair.second->state == SessionState::ACTIVE) {
-            count++;
-        }
-    }
-
-    return count;
+    return active_count_.load(std::memory_order_relaxed);
 }
 
 } // namespace someip
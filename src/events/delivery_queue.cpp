@@ -0,0 +1,128 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "events/delivery_queue.h"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace someip {
+namespace events {
+
+struct EventDeliveryQueue::State {
+    DeliveryConfig config;
+    EventNotificationCallback callback;
+
+    std::deque<EventNotification> queue;                        // BOUNDED_QUEUE
+    std::unordered_map<uint16_t, EventNotification> latest;     // LATEST_VALUE, by event ID
+    std::deque<uint16_t> latest_order;                          // LATEST_VALUE, oldest pending first
+    uint64_t dropped{0};
+    bool stopping{false};
+    std::mutex mutex;
+    std::condition_variable cv;
+};
+
+EventDeliveryQueue::EventDeliveryQueue(const DeliveryConfig& config, EventNotificationCallback callback)
+    : state_(std::make_shared<State>()) {
+    state_->config = config;
+    state_->config.queue_depth = std::max<size_t>(state_->config.queue_depth, 1);
+    state_->callback = std::move(callback);
+    consumer_ = std::thread(&EventDeliveryQueue::consume_loop, state_);
+}
+
+EventDeliveryQueue::~EventDeliveryQueue() {
+    {
+        std::scoped_lock lock(state_->mutex);
+        state_->stopping = true;
+        state_->queue.clear();
+        state_->latest.clear();
+        state_->latest_order.clear();
+        state_->cv.notify_all();
+    }
+    if (!consumer_.joinable()) {
+        return;
+    }
+    if (consumer_.get_id() == std::this_thread::get_id()) {
+        // Destroyed by the running callback; joining would deadlock
+        consumer_.detach();
+    } else {
+        consumer_.join();
+    }
+}
+
+void EventDeliveryQueue::push(EventNotification notification) {
+    State& state = *state_;
+    std::scoped_lock lock(state.mutex);
+    if (state.config.mode == DeliveryMode::LATEST_VALUE) {
+        auto pending = state.latest.find(notification.event_id);
+        if (pending != state.latest.end()) {
+            pending->second = std::move(notification);
+            state.dropped++;
+            return;
+        }
+        state.latest_order.push_back(notification.event_id);
+        state.latest.emplace(notification.event_id, std::move(notification));
+    } else {
+        if (state.queue.size() >= state.config.queue_depth) {
+            state.queue.pop_front();
+            state.dropped++;
+        }
+        state.queue.push_back(std::move(notification));
+    }
+    state.cv.notify_one();
+}
+
+size_t EventDeliveryQueue::get_pending() const {
+    std::scoped_lock lock(state_->mutex);
+    return state_->queue.size() + state_->latest.size();
+}
+
+uint64_t EventDeliveryQueue::get_dropped() const {
+    std::scoped_lock lock(state_->mutex);
+    return state_->dropped;
+}
+
+void EventDeliveryQueue::consume_loop(std::shared_ptr<State> state) {
+    for (;;) {
+        std::unique_lock lock(state->mutex);
+        state->cv.wait(lock, [&state] {
+            return state->stopping || !state->queue.empty() || !state->latest_order.empty();
+        });
+        if (state->stopping) {
+            return;
+        }
+
+        EventNotification notification;
+        if (!state->latest_order.empty()) {
+            auto pending = state->latest.find(state->latest_order.front());
+            state->latest_order.pop_front();
+            notification = std::move(pending->second);
+            state->latest.erase(pending);
+        } else {
+            notification = std::move(state->queue.front());
+            state->queue.pop_front();
+        }
+        lock.unlock();
+
+        // Only the shared state is used from here on: the queue object may
+        // have been destroyed by the callback
+        if (state->callback) {
+            state->callback(notification);
+        }
+    }
+}
+
+} // namespace events
+} // namespace someip
@@ -13,17 +13,18 @@
 
 #include "events/event_publisher.h"
 #include "events/event_types.h"
-#include "transport/udp_transport.h"
+#include "rpc/server_runtime.h"
 #include "transport/endpoint.h"
-#include "transport/transport.h"
 #include "someip/message.h"
 #include <unordered_map>
 #include <unordered_set>
+#include <condition_variable>
 #include <mutex>
 #include <atomic>
 #include <thread>
 #include <chrono>
 #include <algorithm>
+#include <cstring>
 
 namespace someip {
 namespace events {
@@ -35,15 +36,16 @@ namespace events {
  * @satisfies feat_req_someip_720
  * @satisfies feat_req_someip_721
  */
-class EventPublisherImpl : public transport::ITransportListener {
+class EventPublisherImpl {
 public:
-    EventPublisherImpl(uint16_t service_id, uint16_t instance_id)
+    EventPublisherImpl(uint16_t service_id, uint16_t instance_id,
+                       std::shared_ptr<rpc::ServerRuntime> runtime)
         : service_id_(service_id), instance_id_(instance_id),
-          transport_(std::make_shared<transport::UdpTransport>(
-              transport::Endpoint("127.0.0.1", 0))),
+          owns_runtime_(runtime == nullptr),
+          runtime_(runtime ? std::move(runtime)
+                           : std::make_shared<rpc::ServerRuntime>(transport::Endpoint("127.0.0.1", 0))),
+          sample_pool_(std::make_shared<EventSamplePool>()),
           running_(false), next_session_id_(1) {
-
-        transport_->set_listener(this);
     }
 
     ~EventPublisherImpl() {
@@ -55,10 +57,14 @@ public:
             return true;
         }
 
-        if (transport_->start() != Result::SUCCESS) {
+        if (!runtime_->start()) {
             return false;
         }
 
+        // Drop the subscriptions of clients whose connection went away
+        connection_observer_id_ = runtime_->add_connection_observer(
+            {[this](const transport::Endpoint& endpoint) { on_connection_lost(endpoint); }, nullptr, nullptr});
+
         running_ = true;
         start_publish_timer();
 
@@ -70,8 +76,8 @@ public:
             return;
         }
 
-        running_ = false;
         stop_publish_timer();
+        runtime_->remove_connection_observer(connection_observer_id_);
 
         // Clear all subscriptions and events
         std::scoped_lock subs_lock(subscriptions_mutex_);
@@ -80,7 +86,9 @@ public:
         std::scoped_lock events_lock(events_mutex_);
         registered_events_.clear();
 
-        transport_->stop();
+        if (owns_runtime_) {
+            runtime_->stop();
+        }
     }
 
     bool register_event(const EventConfig& config) {
@@ -112,29 +120,69 @@ public:
     }
 
     bool publish_event(uint16_t event_id, const std::vector<uint8_t>& data) {
-        if (!running_) {
+        EventSample sample = loan(event_id, data.size());
+        if (!sample) {
+            return false;
+        }
+        if (!data.empty()) {
+            std::memcpy(sample.data(), data.data(), data.size());
+        }
+        return publish(std::move(sample));
+    }
+
+    EventSample loan(uint16_t event_id, size_t size) {
+        {
+            std::scoped_lock events_lock(events_mutex_);
+            if (registered_events_.count(event_id) == 0) {
+                return EventSample();
+            }
+        }
+
+        // Everything but the length and session ID is known up front
+        std::vector<uint8_t> buffer = sample_pool_->acquire(EventSample::HEADER_SIZE + size);
+        buffer[0] = static_cast<uint8_t>(service_id_ >> 8);
+        buffer[1] = static_cast<uint8_t>(service_id_);
+        buffer[2] = static_cast<uint8_t>(event_id >> 8);
+        buffer[3] = static_cast<uint8_t>(event_id);
+        std::fill(buffer.begin() + 4, buffer.begin() + 12, 0);
+        buffer[12] = SOMEIP_PROTOCOL_VERSION;
+        buffer[13] = SOMEIP_INTERFACE_VERSION;
+        buffer[14] = static_cast<uint8_t>(MessageType::NOTIFICATION);
+        buffer[15] = static_cast<uint8_t>(ReturnCode::E_OK);
+        return EventSample(sample_pool_, std::move(buffer), event_id);
+    }
+
+    bool publish(EventSample sample) {
+        if (!running_ || !sample) {
             return false;
         }
 
         std::scoped_lock events_lock(events_mutex_);
-        auto event_it = registered_events_.find(event_id);
+        auto event_it = registered_events_.find(sample.get_event_id());
         if (event_it == registered_events_.end()) {
             return false;
         }
 
-        // Create event notification
-        EventNotification notification(service_id_, instance_id_, event_id);
-        notification.event_data = data;
-        notification.session_id = next_session_id_++;
-
-        // Send to all subscribed clients for this event's eventgroup
+        // Complete the header in place
+        std::vector<uint8_t>& buffer = sample.buffer_;
+        uint32_t length = static_cast<uint32_t>(buffer.size() - 8);
+        uint16_t session_id = next_session_id_++;
+        buffer[4] = static_cast<uint8_t>(length >> 24);
+        buffer[5] = static_cast<uint8_t>(length >> 16);
+        buffer[6] = static_cast<uint8_t>(length >> 8);
+        buffer[7] = static_cast<uint8_t>(length);
+        buffer[10] = static_cast<uint8_t>(session_id >> 8);
+        buffer[11] = static_cast<uint8_t>(session_id);
+
+        // Send the same bytes to all subscribed clients of the eventgroup
         std::scoped_lock subs_lock(subscriptions_mutex_);
-        auto eventgroup_id = event_it->second.eventgroup_id;
-
-        auto sub_it = subscriptions_.find(eventgroup_id);
+        auto sub_it = subscriptions_.find(event_it->second.eventgroup_id);
         if (sub_it != subscriptions_.end()) {
             for (const auto& client_info : sub_it->second) {
-                send_event_notification(notification, client_info.endpoint);
+                Result result = runtime_->send_serialized(buffer.data(), buffer.size(), client_info.endpoint);
+                if (result != Result::SUCCESS) {
+                    // Log error or handle failure
+                }
             }
         }
 
@@ -218,7 +266,7 @@ public:
     }
 
     bool is_ready() const {
-        return running_ && transport_->is_connected();
+        return running_ && runtime_->is_running();
     }
 
     EventPublisher::Statistics get_statistics() const {
@@ -233,98 +281,83 @@ private:
         std::vector<EventFilter> filters;
     };
 
+    void on_connection_lost(const transport::Endpoint& endpoint) {
+        std::scoped_lock subs_lock(subscriptions_mutex_);
+        for (auto& sub_pair : subscriptions_) {
+            auto& clients = sub_pair.second;
+            auto it = std::remove_if(clients.begin(), clients.end(),
+                [&endpoint](const ClientInfo& info) {
+                    return info.endpoint == endpoint;
+                });
+            clients.erase(it, clients.end());
+        }
+    }
+
     void start_publish_timer() {
         if (publish_timer_thread_.joinable()) {
             return;
         }
 
         publish_timer_thread_ = std::thread([this]() {
-            while (running_) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(100));  // 100ms check
-
-                if (!running_) {
-                    break;
-                }
-
+            std::unique_lock lock(timer_mutex_);
+            // 100ms check; shutdown() wakes the wait
+            while (!timer_cv_.wait_for(lock, std::chrono::milliseconds(100), [this] { return !running_; })) {
+                lock.unlock();
                 publish_cyclic_events();
+                lock.lock();
             }
         });
     }
 
     void stop_publish_timer() {
+        {
+            std::scoped_lock lock(timer_mutex_);
+            running_ = false;
+        }
+        timer_cv_.notify_all();
+
         if (publish_timer_thread_.joinable()) {
             publish_timer_thread_.join();
         }
     }
 
     void publish_cyclic_events() {
-        std::scoped_lock events_lock(events_mutex_);
-        auto now = std::chrono::steady_clock::now();
+        std::vector<uint16_t> due_events;
+        {
+            std::scoped_lock events_lock(events_mutex_);
+            auto now = std::chrono::steady_clock::now();
 
-        for (auto& event_pair : registered_events_) {
-            const auto& config = event_pair.second;
+            for (auto& event_pair : registered_events_) {
+                const auto& config = event_pair.second;
 
-            if (config.notification_type == NotificationType::PERIODIC &&
-                config.cycle_time.count() > 0) {
+                if (config.notification_type == NotificationType::PERIODIC &&
+                    config.cycle_time.count() > 0) {
 
-                // Check if it's time to publish
-                auto time_since_last = std::chrono::duration_cast<std::chrono::milliseconds>(
-                    now - last_publish_times_[config.event_id]);
+                    // Check if it's time to publish
+                    auto time_since_last = std::chrono::duration_cast<std::chrono::milliseconds>(
+                        now - last_publish_times_[config.event_id]);
 
-                if (time_since_last >= config.cycle_time) {
-                    // Publish with empty data (or default data)
-                    publish_event(config.event_id, {});
-                    last_publish_times_[config.event_id] = now;
+                    if (time_since_last >= config.cycle_time) {
+                        due_events.push_back(config.event_id);
+                        last_publish_times_[config.event_id] = now;
+                    }
                 }
             }
         }
-    }
-
-    void send_event_notification(const EventNotification& notification,
-                               const transport::Endpoint& client_endpoint) {
 
-        // Create SOME/IP message for event notification
-        MessageId msg_id(service_id_, notification.event_id);
-        Message someip_message(msg_id, RequestId(notification.client_id, notification.session_id),
-                              MessageType::NOTIFICATION, ReturnCode::E_OK);
-        someip_message.set_payload(notification.event_data);
-
-        Result result = transport_->send_message(someip_message, client_endpoint);
-        if (result != Result::SUCCESS) {
-            // Log error or handle failure
+        // Publish outside the lock: publish_event() takes events_mutex_ itself
+        for (uint16_t event_id : due_events) {
+            // Publish with empty data (or default data)
+            publish_event(event_id, {});
         }
     }
 
-    void on_message_received(MessagePtr message, const transport::Endpoint& sender) override {
-        // Handle subscription/unsubscription messages
-        // This would typically come from SD or direct subscription messages
-    }
-
-    void on_connection_lost(const transport::Endpoint& endpoint) override {
-        // Handle client disconnection
-        std::scoped_lock subs_lock(subscriptions_mutex_);
-
-        for (auto& sub_pair : subscriptions_) {
-            auto& clients = sub_pair.second;
-            auto it = std::remove_if(clients.begin(), clients.end(),
-                [&endpoint](const ClientInfo& info) {
-                    return info.endpoint == endpoint;
-                });
-            clients.erase(it, clients.end());
-        }
-    }
-
-    void on_connection_established(const transport::Endpoint& endpoint) override {
-        // Handle new client connections
-    }
-
-    void on_error(Result error) override {
-        // Handle transport errors
-    }
-
     uint16_t service_id_;
     uint16_t instance_id_;
-    std::shared_ptr<transport::UdpTransport> transport_;
+    bool owns_runtime_;
+    std::shared_ptr<rpc::ServerRuntime> runtime_;
+    std::shared_ptr<EventSamplePool> sample_pool_;
+    uint32_t connection_observer_id_{0};
 
     std::unordered_map<uint16_t, EventConfig> registered_events_;
     mutable std::mutex events_mutex_;
@@ -334,13 +367,20 @@ private:
 
     std::unordered_map<uint16_t, std::chrono::steady_clock::time_point> last_publish_times_;
     std::thread publish_timer_thread_;
+    std::mutex timer_mutex_;
+    std::condition_variable timer_cv_;
     std::atomic<uint16_t> next_session_id_;
     std::atomic<bool> running_;
 };
 
 // EventPublisher implementation
 EventPublisher::EventPublisher(uint16_t service_id, uint16_t instance_id)
-    : impl_(std::make_unique<EventPublisherImpl>(service_id, instance_id)) {
+    : impl_(std::make_unique<EventPublisherImpl>(service_id, instance_id, nullptr)) {
+}
+
+EventPublisher::EventPublisher(uint16_t service_id, uint16_t instance_id,
+                               std::shared_ptr<rpc::ServerRuntime> runtime)
+    : impl_(std::make_unique<EventPublisherImpl>(service_id, instance_id, std::move(runtime))) {
 }
 
 EventPublisher::~EventPublisher() = default;
@@ -369,6 +409,14 @@ bool EventPublisher::publish_event(uint16_t event_id, const std::vector<uint8_t>
     return impl_->publish_event(event_id, data);
 }
 
+EventSample EventPublisher::loan(uint16_t event_id, size_t size) {
+    return impl_->loan(event_id, size);
+}
+
+bool EventPublisher::publish(EventSample sample) {
+    return impl_->publish(std::move(sample));
+}
+
 bool EventPublisher::publish_field(uint16_t event_id, const std::vector<uint8_t>& data) {
     return impl_->publish_field(event_id, data);
 }
@@ -0,0 +1,96 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "events/event_sample.h"
+#include <algorithm>
+
+namespace someip {
+namespace events {
+
+EventSamplePool::EventSamplePool(size_t max_cached)
+    : max_cached_(max_cached) {
+}
+
+std::vector<uint8_t> EventSamplePool::acquire(size_t size) {
+    std::vector<uint8_t> buffer;
+    {
+        std::scoped_lock lock(mutex_);
+        // Prefer a buffer that is already large enough
+        auto fits = std::find_if(free_.begin(), free_.end(),
+            [size](const std::vector<uint8_t>& candidate) { return candidate.capacity() >= size; });
+        if (fits == free_.end() && !free_.empty()) {
+            fits = free_.end() - 1;
+        }
+        if (fits != free_.end()) {
+            buffer = std::move(*fits);
+            free_.erase(fits);
+        }
+    }
+    buffer.resize(size);
+    return buffer;
+}
+
+void EventSamplePool::release(std::vector<uint8_t> buffer) {
+    std::scoped_lock lock(mutex_);
+    if (free_.size() < max_cached_) {
+        buffer.clear();
+        free_.push_back(std::move(buffer));
+    }
+}
+
+size_t EventSamplePool::get_cached() const {
+    std::scoped_lock lock(mutex_);
+    return free_.size();
+}
+
+EventSample::EventSample(std::shared_ptr<EventSamplePool> pool, std::vector<uint8_t> buffer,
+                         uint16_t event_id)
+    : pool_(std::move(pool)), buffer_(std::move(buffer)), event_id_(event_id) {
+}
+
+EventSample::~EventSample() {
+    release();
+}
+
+EventSample::EventSample(EventSample&& other) noexcept
+    : pool_(std::move(other.pool_)), buffer_(std::move(other.buffer_)), event_id_(other.event_id_) {
+    other.buffer_.clear();
+}
+
+EventSample& EventSample::operator=(EventSample&& other) noexcept {
+    if (this != &other) {
+        release();
+        pool_ = std::move(other.pool_);
+        buffer_ = std::move(other.buffer_);
+        event_id_ = other.event_id_;
+        other.buffer_.clear();
+    }
+    return *this;
+}
+
+void EventSample::resize(size_t size) {
+    if (is_valid()) {
+        buffer_.resize(HEADER_SIZE + size);
+    }
+}
+
+void EventSample::release() {
+    if (pool_ && buffer_.capacity() > 0) {
+        pool_->release(std::move(buffer_));
+    }
+    buffer_.clear();
+    pool_.reset();
+}
+
+} // namespace events
+} // namespace someip
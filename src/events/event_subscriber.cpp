@@ -13,6 +13,7 @@
 
 #include "events/event_subscriber.h"
 #include "events/event_types.h"
+#include "events/delivery_queue.h"
 #include "transport/udp_transport.h"
 #include "transport/endpoint.h"
 #include "transport/transport.h"
@@ -41,6 +42,11 @@ public:
           running_(false) {
 
         transport_->set_listener(this);
+
+        // Nothing is subscribed yet, so no datagram is of interest
+        if (transport_->set_message_filter(transport::MessageFilter()) != Result::SUCCESS) {
+            // Not critical - notifications are still matched in on_message_received
+        }
     }
 
     ~EventSubscriberImpl() {
@@ -67,9 +73,13 @@ public:
 
         running_ = false;
 
-        // Clear all subscriptions and callbacks
-        std::scoped_lock subs_lock(subscriptions_mutex_);
-        subscriptions_.clear();
+        // Clear all subscriptions and callbacks; consumer threads are joined
+        // when `retired` goes out of scope, after the lock is released
+        std::unordered_map<std::string, SubscriptionInfo> retired;
+        {
+            std::scoped_lock subs_lock(subscriptions_mutex_);
+            retired.swap(subscriptions_);
+        }
 
         transport_->stop();
     }
@@ -77,7 +87,8 @@ public:
     bool subscribe_eventgroup(uint16_t service_id, uint16_t instance_id, uint16_t eventgroup_id,
                             EventNotificationCallback notification_callback,
                             SubscriptionStatusCallback status_callback,
-                            const std::vector<EventFilter>& filters) {
+                            const std::vector<EventFilter>& filters,
+                            const DeliveryConfig& delivery) {
 
         if (!running_) {
             return false;
@@ -92,11 +103,20 @@ public:
         sub_info.notification_callback = notification_callback;
         sub_info.status_callback = status_callback;
         sub_info.filters = filters;
+        if (delivery.mode != DeliveryMode::IMMEDIATE) {
+            sub_info.delivery = std::make_shared<EventDeliveryQueue>(delivery, notification_callback);
+        }
 
-        // Store subscription
-        std::scoped_lock subs_lock(subscriptions_mutex_);
+        // Store subscription; a replaced one is retired outside the lock
+        SubscriptionInfo retired;
+        std::scoped_lock subs_lock(subscriptions_mutex_, field_requests_mutex_);
         std::string key = make_subscription_key(service_id, instance_id, eventgroup_id);
+        auto existing = subscriptions_.find(key);
+        if (existing != subscriptions_.end()) {
+            retired = std::move(existing->second);
+        }
         subscriptions_[key] = sub_info;
+        update_message_filter();
 
         // Send subscription request via RPC (simplified - in real implementation,
         // this would use SD to find the service endpoint and send subscription)
@@ -118,6 +138,7 @@ public:
         bool success = (send_result == Result::SUCCESS);
         if (!success) {
             subscriptions_.erase(key);
+            update_message_filter();
         }
         return success;
     }
@@ -127,7 +148,8 @@ public:
             return false;
         }
 
-        std::scoped_lock subs_lock(subscriptions_mutex_);
+        SubscriptionInfo retired;   // Destroyed after the lock is released
+        std::scoped_lock subs_lock(subscriptions_mutex_, field_requests_mutex_);
         std::string key = make_subscription_key(service_id, instance_id, eventgroup_id);
 
         auto it = subscriptions_.find(key);
@@ -154,7 +176,9 @@ public:
         }
 
         // Remove subscription
+        retired = std::move(it->second);
         subscriptions_.erase(it);
+        update_message_filter();
         return true;
     }
 
@@ -166,9 +190,10 @@ public:
         }
 
         // Store callback for field response
-        std::scoped_lock field_lock(field_requests_mutex_);
+        std::scoped_lock lock(subscriptions_mutex_, field_requests_mutex_);
         std::string key = make_field_key(service_id, instance_id, event_id);
-        field_requests_[key] = callback;
+        field_requests_[key] = FieldRequest{service_id, callback};
+        update_message_filter();
 
         // Send field request
         transport::Endpoint service_endpoint("127.0.0.1", 30500);  // TODO: Get from SD
@@ -241,8 +266,34 @@ private:
         EventNotificationCallback notification_callback;
         SubscriptionStatusCallback status_callback;
         std::vector<EventFilter> filters;
+        std::shared_ptr<EventDeliveryQueue> delivery;   // null = IMMEDIATE
     };
 
+    struct FieldRequest {
+        uint16_t service_id;
+        EventNotificationCallback callback;
+    };
+
+    /**
+     * @brief Accept only services with a subscription or pending field request
+     *
+     * Callers must hold both subscriptions_mutex_ and field_requests_mutex_.
+     */
+    void update_message_filter() {
+        transport::MessageFilter filter;
+        for (const auto& sub_pair : subscriptions_) {
+            filter.add_service(sub_pair.second.subscription.service_id);
+        }
+        for (const auto& field_pair : field_requests_) {
+            filter.add_service(field_pair.second.service_id);
+        }
+
+        if (filter != active_filter_ &&
+            transport_->set_message_filter(filter) == Result::SUCCESS) {
+            active_filter_ = std::move(filter);
+        }
+    }
+
     std::string make_subscription_key(uint16_t service_id, uint16_t instance_id, uint16_t eventgroup_id) const {
         return std::to_string(service_id) + ":" + std::to_string(instance_id) + ":" + std::to_string(eventgroup_id);
     }
@@ -271,10 +322,12 @@ private:
                 EventNotification notification(service_id, sub_info.subscription.instance_id, event_id);
                 notification.client_id = message->get_client_id();
                 notification.session_id = message->get_session_id();
-                notification.event_data = message->get_payload();
+                notification.event_data = message->get_payload().to_vector();
 
-                // Call notification callback
-                if (sub_info.notification_callback) {
+                // Call notification callback, or leave it to the consumer thread
+                if (sub_info.delivery) {
+                    sub_info.delivery->push(std::move(notification));
+                } else if (sub_info.notification_callback) {
                     sub_info.notification_callback(notification);
                 }
 
@@ -293,13 +346,14 @@ private:
         auto field_it = field_requests_.find(field_key);
         if (field_it != field_requests_.end()) {
             EventNotification notification(service_id, 0, event_id);
-            notification.event_data = message->get_payload();
+            notification.event_data = message->get_payload().to_vector();
 
-            if (field_it->second) {
-                field_it->second(notification);
+            if (field_it->second.callback) {
+                field_it->second.callback(notification);
             }
 
             field_requests_.erase(field_it);
+            update_message_filter();
         }
     }
 
@@ -330,9 +384,11 @@ private:
     std::unordered_map<std::string, SubscriptionInfo> subscriptions_;
     mutable std::mutex subscriptions_mutex_;
 
-    std::unordered_map<std::string, EventNotificationCallback> field_requests_;
+    std::unordered_map<std::string, FieldRequest> field_requests_;
     mutable std::mutex field_requests_mutex_;
 
+    transport::MessageFilter active_filter_;  // Guarded by subscriptions_mutex_
+
     std::atomic<bool> running_;
 };
 
@@ -354,9 +410,10 @@ void EventSubscriber::shutdown() {
 bool EventSubscriber::subscribe_eventgroup(uint16_t service_id, uint16_t instance_id, uint16_t eventgroup_id,
                                          EventNotificationCallback notification_callback,
                                          SubscriptionStatusCallback status_callback,
-                                         const std::vector<EventFilter>& filters) {
+                                         const std::vector<EventFilter>& filters,
+                                         const DeliveryConfig& delivery) {
     return impl_->subscribe_eventgroup(service_id, instance_id, eventgroup_id,
-                                     notification_callback, status_callback, filters);
+                                     notification_callback, status_callback, filters, delivery);
 }
 
 bool EventSubscriber::unsubscribe_eventgroup(uint16_t service_id, uint16_t instance_id, uint16_t eventgroup_id) {
@@ -0,0 +1,461 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "gateway/gateway.h"
+#include "someip/message.h"
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace someip {
+namespace gateway {
+
+namespace {
+
+uint64_t route_key(uint16_t service_id, uint16_t instance_id, uint16_t method_id) {
+    return (static_cast<uint64_t>(service_id) << 32) | (static_cast<uint64_t>(instance_id) << 16) |
+           method_id;
+}
+
+// Segments of a large message carry its type with the TP flag (0x20) set
+constexpr uint8_t TP_FLAG = 0x20;
+
+MessageType without_tp_flag(MessageType type) {
+    return static_cast<MessageType>(static_cast<uint8_t>(type) & ~TP_FLAG);
+}
+
+bool is_proxied_request(MessageType type) {
+    return without_tp_flag(type) == MessageType::REQUEST;
+}
+
+bool is_response_type(MessageType type) {
+    type = without_tp_flag(type);
+    return type == MessageType::RESPONSE || type == MessageType::ERROR;
+}
+
+/**
+ * @brief Check whether a TP segment is the last of its message (More Segments flag clear)
+ */
+bool is_last_segment(const Message& message) {
+    auto payload = message.get_payload();
+    return payload.size() < 4 || (payload.data()[3] & 0x01) == 0;
+}
+
+} // namespace
+
+/**
+ * @brief Gateway implementation
+ *
+ * Routes are fixed once the gateway starts, so lookups take no lock. The
+ * table of outstanding requests is indexed directly by the session ID the
+ * gateway assigned. All TP segments of one request share that session ID,
+ * and the segments of its response all go back through the same slot.
+ */
+class GatewayImpl {
+public:
+    explicit GatewayImpl(const GatewayConfig& config)
+        : config_(config), pending_(0x10000) {
+        config_.max_pending_requests = std::clamp<size_t>(config_.max_pending_requests, 1, 0xFFFF);
+    }
+
+    ~GatewayImpl() {
+        (void)stop();
+        for (auto& interface : interfaces_) {
+            interface->transport->set_listener(nullptr);
+        }
+    }
+
+    Result add_interface(const std::string& name, std::shared_ptr<transport::ITransport> transport,
+                         uint16_t instance_id) {
+        if (running_) {
+            return Result::INVALID_STATE;
+        }
+        if (!transport || find_interface(name) >= 0) {
+            return Result::INVALID_ARGUMENT;
+        }
+
+        auto interface = std::make_unique<Interface>();
+        interface->owner = this;
+        interface->index = static_cast<uint16_t>(interfaces_.size());
+        interface->name = name;
+        interface->instance_id = instance_id;
+        interface->transport = std::move(transport);
+        interface->transport->set_listener(interface.get());
+        interfaces_.push_back(std::move(interface));
+        return Result::SUCCESS;
+    }
+
+    Result add_route(const Route& route) {
+        if (running_) {
+            return Result::INVALID_STATE;
+        }
+        int egress = find_interface(route.egress);
+        if (egress < 0) {
+            return Result::INVALID_ARGUMENT;
+        }
+        bool added = routes_.emplace(route_key(route.service_id, route.instance_id, route.method_id),
+                                     RouteTarget{static_cast<uint16_t>(egress), route.destination}).second;
+        return added ? Result::SUCCESS : Result::INVALID_ARGUMENT;
+    }
+
+    Result start() {
+        if (running_) {
+            return Result::SUCCESS;
+        }
+        for (auto& interface : interfaces_) {
+            if (!interface->transport->is_running()) {
+                Result result = interface->transport->start();
+                if (result != Result::SUCCESS) {
+                    (void)stop_transports();
+                    return result;
+                }
+            }
+        }
+        running_ = true;
+        return Result::SUCCESS;
+    }
+
+    Result stop() {
+        if (!running_) {
+            return Result::SUCCESS;
+        }
+        running_ = false;
+        Result result = stop_transports();
+
+        std::scoped_lock lock(pending_mutex_);
+        std::fill(pending_.begin(), pending_.end(), PendingRequest{});
+        tp_sessions_.clear();
+        pending_count_ = 0;
+        return result;
+    }
+
+    bool is_running() const {
+        return running_;
+    }
+
+    size_t get_pending_requests() const {
+        std::scoped_lock lock(pending_mutex_);
+        return pending_count_;
+    }
+
+    Gateway::Statistics get_statistics() const {
+        Gateway::Statistics stats;
+        stats.forwarded_requests = forwarded_requests_.load();
+        stats.forwarded_notifications = forwarded_notifications_.load();
+        stats.routed_responses = routed_responses_.load();
+        stats.dropped_no_route = dropped_no_route_.load();
+        stats.dropped_unmatched_responses = dropped_unmatched_.load();
+        stats.dropped_pending_full = dropped_pending_full_.load();
+        stats.timed_out_requests = timed_out_.load();
+        stats.send_failures = send_failures_.load();
+        return stats;
+    }
+
+private:
+    struct Interface : public transport::ITransportListener {
+        GatewayImpl* owner{nullptr};
+        uint16_t index{0};
+        std::string name;
+        uint16_t instance_id{ANY_INSTANCE};
+        std::shared_ptr<transport::ITransport> transport;
+
+        void on_message_received(MessagePtr message, const transport::Endpoint& sender) override {
+            owner->on_message(*this, std::move(message), sender);
+        }
+        void on_connection_lost(const transport::Endpoint&) override {}
+        void on_connection_established(const transport::Endpoint&) override {}
+        void on_error(Result) override {}
+    };
+
+    struct RouteTarget {
+        uint16_t egress;
+        transport::Endpoint destination;
+    };
+
+    struct PendingRequest {
+        bool in_use{false};
+        bool segmented{false};              // Registered in tp_sessions_
+        uint16_t ingress{0};
+        uint16_t service_id{0};
+        uint16_t method_id{0};
+        RequestId original;
+        transport::Endpoint sender;
+        std::chrono::steady_clock::time_point deadline;
+    };
+
+    int find_interface(const std::string& name) const {
+        for (size_t i = 0; i < interfaces_.size(); ++i) {
+            if (interfaces_[i]->name == name) {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+
+    Result stop_transports() {
+        Result result = Result::SUCCESS;
+        for (auto& interface : interfaces_) {
+            Result stopped = interface->transport->stop();
+            if (stopped != Result::SUCCESS) {
+                result = stopped;
+            }
+        }
+        return result;
+    }
+
+    const RouteTarget* lookup(uint16_t service_id, uint16_t instance_id, uint16_t method_id) const {
+        const uint64_t candidates[] = {
+            route_key(service_id, instance_id, method_id),
+            route_key(service_id, instance_id, ANY_METHOD),
+            route_key(service_id, ANY_INSTANCE, method_id),
+            route_key(service_id, ANY_INSTANCE, ANY_METHOD),
+        };
+        for (uint64_t key : candidates) {
+            auto it = routes_.find(key);
+            if (it != routes_.end()) {
+                return &it->second;
+            }
+        }
+        return nullptr;
+    }
+
+    void on_message(const Interface& ingress, MessagePtr message, const transport::Endpoint& sender) {
+        if (!running_ || !message) {
+            return;
+        }
+
+        MessageType type = message->get_message_type();
+        if (is_response_type(type)) {
+            route_response(*message);
+            return;
+        }
+
+        const RouteTarget* route = lookup(message->get_service_id(), ingress.instance_id,
+                                          message->get_method_id());
+        if (route == nullptr) {
+            dropped_no_route_++;
+            return;
+        }
+
+        if (is_proxied_request(type) && !track_request(ingress, *message, sender)) {
+            dropped_pending_full_++;
+            return;
+        }
+
+        MessageType base_type = without_tp_flag(type);
+        if (base_type == MessageType::REQUEST || base_type == MessageType::REQUEST_NO_RETURN) {
+            forwarded_requests_++;
+        } else {
+            forwarded_notifications_++;
+        }
+        send(route->egress, *message, route->destination);
+    }
+
+    /**
+     * @brief Identifies the TP segments of one request: ingress, sender, message ID and request ID
+     */
+    using SegmentedKey = std::tuple<uint16_t, transport::Endpoint, uint32_t, uint32_t>;
+
+    static SegmentedKey segmented_key(uint16_t ingress, const transport::Endpoint& sender,
+                                      uint16_t service_id, uint16_t method_id, RequestId original) {
+        return SegmentedKey(ingress, sender, (static_cast<uint32_t>(service_id) << 16) | method_id,
+                            original.to_uint32());
+    }
+
+    /**
+     * @brief Remember where a request came from and give it a gateway session ID
+     *
+     * Later TP segments of a request reuse the session ID of its first
+     * segment, so the server can reassemble them and the single response
+     * finds its way back.
+     */
+    bool track_request(const Interface& ingress, Message& message, const transport::Endpoint& sender) {
+        auto now = std::chrono::steady_clock::now();
+        std::scoped_lock lock(pending_mutex_);
+
+        bool segmented = uses_tp(message.get_message_type());
+        SegmentedKey key;
+        if (segmented) {
+            key = segmented_key(ingress.index, sender, message.get_service_id(), message.get_method_id(),
+                                message.get_request_id());
+            auto known = tp_sessions_.find(key);
+            if (known != tp_sessions_.end()) {
+                PendingRequest& slot = pending_[known->second];
+                if (slot.deadline > now) {
+                    slot.deadline = now + config_.request_timeout;
+                    message.set_request_id(RequestId(config_.client_id, known->second));
+                    return true;
+                }
+                release(slot);
+                timed_out_++;
+            }
+        }
+
+        if (pending_count_ >= config_.max_pending_requests) {
+            expire_pending(now);
+            if (pending_count_ >= config_.max_pending_requests) {
+                return false;
+            }
+        }
+
+        // Session IDs cycle through 1..0xFFFF, skipping requests still awaiting a response
+        uint16_t session = 0;
+        for (size_t attempt = 0; attempt < 0xFFFF && session == 0; ++attempt) {
+            next_session_ = static_cast<uint16_t>(next_session_ == 0xFFFF ? 1 : next_session_ + 1);
+            PendingRequest& candidate = pending_[next_session_];
+            if (candidate.in_use && candidate.deadline <= now) {
+                release(candidate);
+                timed_out_++;
+            }
+            if (!candidate.in_use) {
+                session = next_session_;
+            }
+        }
+        if (session == 0) {
+            return false;
+        }
+
+        PendingRequest& slot = pending_[session];
+        slot.in_use = true;
+        slot.ingress = ingress.index;
+        slot.service_id = message.get_service_id();
+        slot.method_id = message.get_method_id();
+        slot.original = message.get_request_id();
+        slot.sender = sender;
+        slot.deadline = now + config_.request_timeout;
+        slot.segmented = segmented;
+        pending_count_++;
+        if (segmented) {
+            tp_sessions_[key] = session;
+        }
+
+        message.set_request_id(RequestId(config_.client_id, session));
+        return true;
+    }
+
+    /**
+     * @brief Forget requests whose response is overdue (pending_mutex_ must be held)
+     */
+    void expire_pending(std::chrono::steady_clock::time_point now) {
+        for (auto& slot : pending_) {
+            if (slot.in_use && slot.deadline <= now) {
+                release(slot);
+                timed_out_++;
+            }
+        }
+    }
+
+    void release(PendingRequest& slot) {
+        if (slot.segmented) {
+            tp_sessions_.erase(segmented_key(slot.ingress, slot.sender, slot.service_id, slot.method_id,
+                                             slot.original));
+            slot.segmented = false;
+        }
+        slot.in_use = false;
+        pending_count_--;
+    }
+
+    void route_response(Message& message) {
+        uint16_t ingress = 0;
+        transport::Endpoint destination;
+        {
+            std::scoped_lock lock(pending_mutex_);
+            PendingRequest& slot = pending_[message.get_session_id()];
+            if (message.get_client_id() != config_.client_id || !slot.in_use ||
+                slot.service_id != message.get_service_id() || slot.method_id != message.get_method_id()) {
+                dropped_unmatched_++;
+                return;
+            }
+            ingress = slot.ingress;
+            destination = slot.sender;
+            message.set_request_id(slot.original);
+            // A segmented response keeps the slot until its last segment
+            if (uses_tp(message.get_message_type()) && !is_last_segment(message)) {
+                slot.deadline = std::chrono::steady_clock::now() + config_.request_timeout;
+            } else {
+                release(slot);
+            }
+        }
+
+        routed_responses_++;
+        send(ingress, message, destination);
+    }
+
+    void send(uint16_t egress, const Message& message, const transport::Endpoint& destination) {
+        if (interfaces_[egress]->transport->send_message(message, destination) != Result::SUCCESS) {
+            send_failures_++;
+        }
+    }
+
+    GatewayConfig config_;
+    std::vector<std::unique_ptr<Interface>> interfaces_;
+    std::unordered_map<uint64_t, RouteTarget> routes_;     // Read-only once started
+    std::atomic<bool> running_{false};
+
+    std::vector<PendingRequest> pending_;                  // Indexed by gateway session ID
+    std::map<SegmentedKey, uint16_t> tp_sessions_;         // Session ID of each segmented request
+    size_t pending_count_{0};
+    uint16_t next_session_{0};
+    mutable std::mutex pending_mutex_;
+
+    std::atomic<uint64_t> forwarded_requests_{0};
+    std::atomic<uint64_t> forwarded_notifications_{0};
+    std::atomic<uint64_t> routed_responses_{0};
+    std::atomic<uint64_t> dropped_no_route_{0};
+    std::atomic<uint64_t> dropped_unmatched_{0};
+    std::atomic<uint64_t> dropped_pending_full_{0};
+    std::atomic<uint64_t> timed_out_{0};
+    std::atomic<uint64_t> send_failures_{0};
+};
+
+Gateway::Gateway(const GatewayConfig& config)
+    : impl_(std::make_unique<GatewayImpl>(config)) {
+}
+
+Gateway::~Gateway() = default;
+
+Result Gateway::add_interface(const std::string& name, std::shared_ptr<transport::ITransport> transport,
+                              uint16_t instance_id) {
+    return impl_->add_interface(name, std::move(transport), instance_id);
+}
+
+Result Gateway::add_route(const Route& route) {
+    return impl_->add_route(route);
+}
+
+Result Gateway::start() {
+    return impl_->start();
+}
+
+Result Gateway::stop() {
+    return impl_->stop();
+}
+
+bool Gateway::is_running() const {
+    return impl_->is_running();
+}
+
+size_t Gateway::get_pending_requests() const {
+    return impl_->get_pending_requests();
+}
+
+Gateway::Statistics Gateway::get_statistics() const {
+    return impl_->get_statistics();
+}
+
+} // namespace gateway
+} // namespace someip
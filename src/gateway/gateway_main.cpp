@@ -0,0 +1,210 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/**
+ * @brief Standalone SOME/IP gateway
+ *
+ * Interfaces and routes are given on the command line, e.g. forwarding
+ * service 0x1234 from a UDP network to a TCP server:
+ *
+ *   someip-gatewayd --udp front 0.0.0.0:30501 \
+ *                   --tcp-client back 10.0.0.2:30509 \
+ *                   --route 0x1234 '*' '*' back
+ */
+
+#include "gateway/gateway.h"
+#include "transport/tcp_transport.h"
+#include "transport/udp_transport.h"
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace someip;
+using namespace someip::gateway;
+
+namespace {
+
+std::atomic<bool> stop_requested{false};
+
+void signal_handler(int) {
+    stop_requested = true;
+}
+
+void print_usage(const char* program) {
+    std::cerr << "Usage: " << program << " [options]\n"
+              << "  --udp NAME ADDRESS:PORT [INSTANCE]         receive and send over UDP\n"
+              << "  --tcp-server NAME ADDRESS:PORT [INSTANCE]  accept one TCP connection\n"
+              << "  --tcp-client NAME ADDRESS:PORT [INSTANCE]  connect to a TCP server\n"
+              << "  --route SERVICE INSTANCE METHOD EGRESS [ADDRESS:PORT]\n"
+              << "                                             forward matching messages ('*' = any)\n"
+              << "  --timeout MS                               forget unanswered requests after MS\n"
+              << "IDs are decimal or 0x-prefixed hexadecimal.\n";
+}
+
+bool parse_id(const std::string& text, uint16_t wildcard, uint16_t& id) {
+    if (text == "*") {
+        id = wildcard;
+        return true;
+    }
+    char* end = nullptr;
+    unsigned long value = std::strtoul(text.c_str(), &end, 0);
+    if (text.empty() || *end != '\0' || value > 0xFFFF) {
+        return false;
+    }
+    id = static_cast<uint16_t>(value);
+    return true;
+}
+
+bool parse_endpoint(const std::string& text, transport::TransportProtocol protocol, transport::Endpoint& endpoint) {
+    size_t colon = text.rfind(':');
+    uint16_t port = 0;
+    if (colon == std::string::npos || !parse_id(text.substr(colon + 1), 0, port)) {
+        return false;
+    }
+    endpoint = transport::Endpoint(text.substr(0, colon), port, protocol);
+    return endpoint.is_valid();
+}
+
+std::shared_ptr<transport::ITransport> open_interface(const std::string& kind, const transport::Endpoint& endpoint) {
+    if (kind == "--udp") {
+        return std::make_shared<transport::UdpTransport>(endpoint);
+    }
+
+    auto tcp = std::make_shared<transport::TcpTransport>();
+    if (kind == "--tcp-server") {
+        if (tcp->initialize(endpoint) != Result::SUCCESS || tcp->enable_server_mode() != Result::SUCCESS) {
+            return nullptr;
+        }
+        return tcp;
+    }
+
+    if (tcp->initialize(transport::Endpoint("0.0.0.0", 0, transport::TransportProtocol::TCP)) != Result::SUCCESS ||
+        tcp->start() != Result::SUCCESS || tcp->connect(endpoint) != Result::SUCCESS) {
+        return nullptr;
+    }
+    return tcp;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::vector<std::string> args(argv + 1, argv + argc);
+    GatewayConfig config;
+    std::vector<std::vector<std::string>> interface_args;
+    std::vector<std::vector<std::string>> route_args;
+
+    // Routes refer to interfaces by name, so collect everything first
+    for (size_t i = 0; i < args.size();) {
+        const std::string& option = args[i];
+        size_t required = 0;
+        size_t optional = 0;
+        if (option == "--udp" || option == "--tcp-server" || option == "--tcp-client") {
+            required = 2;
+            optional = 1;
+        } else if (option == "--route") {
+            required = 4;
+            optional = 1;
+        } else if (option == "--timeout") {
+            required = 1;
+        } else {
+            print_usage(argv[0]);
+            return option == "--help" ? 0 : 1;
+        }
+
+        std::vector<std::string> values{option};
+        size_t j = i + 1;
+        while (j < args.size() && values.size() <= required + optional && args[j].rfind("--", 0) != 0) {
+            values.push_back(args[j++]);
+        }
+        if (values.size() <= required) {
+            std::cerr << option << ": missing arguments" << std::endl;
+            return 1;
+        }
+        i = j;
+
+        if (option == "--route") {
+            route_args.push_back(std::move(values));
+        } else if (option == "--timeout") {
+            config.request_timeout = std::chrono::milliseconds(std::strtoul(values[1].c_str(), nullptr, 10));
+        } else {
+            interface_args.push_back(std::move(values));
+        }
+    }
+
+    if (interface_args.empty() || route_args.empty()) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    Gateway gateway(config);
+    for (const auto& values : interface_args) {
+        auto protocol = values[0] == "--udp" ? transport::TransportProtocol::UDP : transport::TransportProtocol::TCP;
+        transport::Endpoint endpoint;
+        uint16_t instance_id = ANY_INSTANCE;
+        if (!parse_endpoint(values[2], protocol, endpoint) ||
+            (values.size() > 3 && !parse_id(values[3], ANY_INSTANCE, instance_id))) {
+            std::cerr << values[1] << ": invalid endpoint or instance" << std::endl;
+            return 1;
+        }
+
+        auto transport = open_interface(values[0], endpoint);
+        if (!transport || gateway.add_interface(values[1], transport, instance_id) != Result::SUCCESS) {
+            std::cerr << values[1] << ": cannot open " << values[2] << std::endl;
+            return 1;
+        }
+    }
+
+    for (const auto& values : route_args) {
+        Route route;
+        route.egress = values[4];
+        if (!parse_id(values[1], 0, route.service_id) ||
+            !parse_id(values[2], ANY_INSTANCE, route.instance_id) ||
+            !parse_id(values[3], ANY_METHOD, route.method_id) ||
+            (values.size() > 5 && !parse_endpoint(values[5], transport::TransportProtocol::UDP, route.destination))) {
+            std::cerr << "--route " << values[1] << ": invalid IDs or destination" << std::endl;
+            return 1;
+        }
+        if (gateway.add_route(route) != Result::SUCCESS) {
+            std::cerr << "--route " << values[1] << ": unknown interface or duplicate route" << std::endl;
+            return 1;
+        }
+    }
+
+    std::signal(SIGINT, signal_handler);
+    std::signal(SIGTERM, signal_handler);
+
+    if (gateway.start() != Result::SUCCESS) {
+        std::cerr << "Failed to start gateway" << std::endl;
+        return 1;
+    }
+    std::cout << "Gateway running with " << interface_args.size() << " interfaces and "
+              << route_args.size() << " routes" << std::endl;
+
+    while (!stop_requested) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    }
+
+    gateway.stop();
+    auto stats = gateway.get_statistics();
+    std::cout << "Forwarded " << stats.forwarded_requests << " requests, "
+              << stats.forwarded_notifications << " notifications, "
+              << stats.routed_responses << " responses; dropped "
+              << stats.dropped_no_route << " unroutable, "
+              << stats.dropped_unmatched_responses << " unmatched responses" << std::endl;
+    return 0;
+}
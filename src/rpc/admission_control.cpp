@@ -0,0 +1,156 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "rpc/admission_control.h"
+#include <algorithm>
+
+namespace someip {
+namespace rpc {
+
+AdmissionController::AdmissionController(const AdmissionConfig& config)
+    : config_(config) {
+    config_.quantum = std::max<uint32_t>(config_.quantum, 1);
+}
+
+bool AdmissionController::take_token(Bucket& bucket, const RateLimit& limit,
+                                     std::chrono::steady_clock::time_point now) {
+    if (limit.rate <= 0.0) {
+        return true;
+    }
+
+    double capacity = std::max<double>(limit.burst, 1.0);
+    if (!bucket.initialized) {
+        bucket.tokens = capacity;
+        bucket.refilled_at = now;
+        bucket.initialized = true;
+    } else {
+        std::chrono::duration<double> elapsed = now - bucket.refilled_at;
+        bucket.tokens = std::min(capacity, bucket.tokens + elapsed.count() * limit.rate);
+        bucket.refilled_at = now;
+    }
+
+    if (bucket.tokens < 1.0) {
+        return false;
+    }
+    bucket.tokens -= 1.0;
+    return true;
+}
+
+AdmissionResult AdmissionController::admit(uint16_t client_id, MethodId method_id,
+                                           uint32_t cost, Task task) {
+    std::scoped_lock lock(mutex_);
+    if (closed_) {
+        return AdmissionResult::CLOSED;
+    }
+
+    auto queued_flow = flows_.find(client_id);
+    size_t client_queued = queued_flow != flows_.end() ? queued_flow->second.requests.size() : 0;
+    if (queued_ >= config_.queue_capacity || client_queued >= config_.client_queue_capacity) {
+        rejected_++;
+        return AdmissionResult::QUEUE_FULL;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    auto method_limit = config_.method_limits.find(method_id);
+    if (method_limit != config_.method_limits.end()) {
+        uint32_t key = (static_cast<uint32_t>(client_id) << 16) | method_id;
+        if (!take_token(method_buckets_[key], method_limit->second, now)) {
+            rejected_++;
+            return AdmissionResult::RATE_LIMITED;
+        }
+    }
+    if (!take_token(client_buckets_[client_id], config_.client_limit, now)) {
+        rejected_++;
+        return AdmissionResult::RATE_LIMITED;
+    }
+
+    Flow& flow = flows_[client_id];
+    if (flow.requests.empty()) {
+        active_clients_.push_back(client_id);
+    }
+    flow.requests.push_back(Request{cost, std::move(task)});
+    queued_++;
+    queue_cv_.notify_one();
+    return AdmissionResult::ADMITTED;
+}
+
+bool AdmissionController::pop(Task& task) {
+    std::scoped_lock lock(mutex_);
+    return pop_locked(task);
+}
+
+bool AdmissionController::wait_pop(Task& task) {
+    std::unique_lock lock(mutex_);
+    queue_cv_.wait(lock, [this] { return closed_ || queued_ > 0; });
+    return !closed_ && pop_locked(task);
+}
+
+/**
+ * @brief Deficit round robin over the clients with queued requests
+ *
+ * The client at the front is served while its deficit covers the size of
+ * its next request; otherwise it is credited one quantum and moves to the
+ * back of the round.
+ */
+bool AdmissionController::pop_locked(Task& task) {
+    while (!active_clients_.empty()) {
+        uint16_t client_id = active_clients_.front();
+        Flow& flow = flows_[client_id];
+        Request& next = flow.requests.front();
+
+        if (flow.deficit < next.cost) {
+            flow.deficit += config_.quantum;
+            active_clients_.pop_front();
+            active_clients_.push_back(client_id);
+            continue;
+        }
+
+        flow.deficit -= next.cost;
+        task = std::move(next.task);
+        flow.requests.pop_front();
+        queued_--;
+        if (flow.requests.empty()) {
+            flows_.erase(client_id);
+            active_clients_.pop_front();
+        }
+        return true;
+    }
+    return false;
+}
+
+void AdmissionController::close() {
+    std::scoped_lock lock(mutex_);
+    closed_ = true;
+    flows_.clear();
+    active_clients_.clear();
+    queued_ = 0;
+    queue_cv_.notify_all();
+}
+
+void AdmissionController::reopen() {
+    std::scoped_lock lock(mutex_);
+    closed_ = false;
+}
+
+size_t AdmissionController::get_queued() const {
+    std::scoped_lock lock(mutex_);
+    return queued_;
+}
+
+uint64_t AdmissionController::get_rejected() const {
+    std::scoped_lock lock(mutex_);
+    return rejected_;
+}
+
+} // namespace rpc
+} // namespace someip
@@ -0,0 +1,265 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "rpc/load_balancer.h"
+#include <algorithm>
+
+namespace someip {
+namespace rpc {
+
+LoadBalancer::LoadBalancer(const LoadBalancerConfig& config)
+    : config_(config),
+      random_(std::random_device{}()) {
+}
+
+void LoadBalancer::set_instances(uint16_t service_id, const std::vector<transport::Endpoint>& endpoints) {
+    std::scoped_lock lock(mutex_);
+
+    if (endpoints.empty()) {
+        services_.erase(service_id);
+        return;
+    }
+
+    Service& service = services_[service_id];
+    std::vector<Instance> instances;
+    instances.reserve(endpoints.size());
+    for (const auto& endpoint : endpoints) {
+        auto existing = std::find_if(service.instances.begin(), service.instances.end(),
+            [&endpoint](const Instance& instance) { return instance.endpoint == endpoint; });
+        if (existing != service.instances.end()) {
+            instances.push_back(*existing);
+        } else {
+            instances.push_back(Instance{endpoint});
+        }
+    }
+    service.instances = std::move(instances);
+}
+
+void LoadBalancer::add_instance(uint16_t service_id, const transport::Endpoint& endpoint) {
+    std::scoped_lock lock(mutex_);
+    if (find(service_id, endpoint) == nullptr) {
+        services_[service_id].instances.push_back(Instance{endpoint});
+    }
+}
+
+bool LoadBalancer::remove_instance(uint16_t service_id, const transport::Endpoint& endpoint) {
+    std::scoped_lock lock(mutex_);
+    auto service = services_.find(service_id);
+    if (service == services_.end()) {
+        return false;
+    }
+
+    auto& instances = service->second.instances;
+    auto it = std::find_if(instances.begin(), instances.end(),
+        [&endpoint](const Instance& instance) { return instance.endpoint == endpoint; });
+    if (it == instances.end()) {
+        return false;
+    }
+
+    instances.erase(it);
+    if (instances.empty()) {
+        services_.erase(service);
+    }
+    return true;
+}
+
+std::vector<transport::Endpoint> LoadBalancer::get_instances(uint16_t service_id) const {
+    std::scoped_lock lock(mutex_);
+    std::vector<transport::Endpoint> endpoints;
+    auto service = services_.find(service_id);
+    if (service != services_.end()) {
+        for (const auto& instance : service->second.instances) {
+            endpoints.push_back(instance.endpoint);
+        }
+    }
+    return endpoints;
+}
+
+bool LoadBalancer::select(uint16_t service_id, transport::Endpoint& endpoint) {
+    std::scoped_lock lock(mutex_);
+    auto it = services_.find(service_id);
+    if (it == services_.end()) {
+        return false;
+    }
+
+    Service& service = it->second;
+    auto now = std::chrono::steady_clock::now();
+    std::vector<size_t> candidates;
+    for (size_t i = 0; i < service.instances.size(); ++i) {
+        if (service.instances[i].ejected_until <= now) {
+            candidates.push_back(i);
+        }
+    }
+    if (candidates.empty()) {
+        // Every instance is ejected: spread the load instead of failing
+        for (size_t i = 0; i < service.instances.size(); ++i) {
+            candidates.push_back(i);
+        }
+    }
+
+    Instance& chosen = service.instances[pick(service, candidates)];
+    chosen.outstanding++;
+    endpoint = chosen.endpoint;
+    return true;
+}
+
+/**
+ * @brief Apply the configured strategy to the admitted instances
+ */
+size_t LoadBalancer::pick(Service& service, const std::vector<size_t>& candidates) {
+    const auto& instances = service.instances;
+    size_t start = service.next++ % candidates.size();
+
+    switch (config_.strategy) {
+        case LoadBalancingStrategy::LEAST_OUTSTANDING: {
+            // Scan from the round-robin position so ties rotate
+            size_t best = candidates[start];
+            for (size_t n = 1; n < candidates.size(); ++n) {
+                size_t index = candidates[(start + n) % candidates.size()];
+                if (instances[index].outstanding < instances[best].outstanding) {
+                    best = index;
+                }
+            }
+            return best;
+        }
+        case LoadBalancingStrategy::LATENCY_EWMA: {
+            if (candidates.size() == 1) {
+                return candidates[0];
+            }
+            // Power of two choices
+            std::uniform_int_distribution<size_t> distribution(0, candidates.size() - 1);
+            size_t first = candidates[distribution(random_)];
+            size_t second = candidates[distribution(random_)];
+            while (second == first) {
+                second = candidates[distribution(random_)];
+            }
+            auto cost = [this, &service, &instances](size_t index) {
+                return estimate_latency(service, instances[index]) * (instances[index].outstanding + 1);
+            };
+            return cost(second) < cost(first) ? second : first;
+        }
+        case LoadBalancingStrategy::ROUND_ROBIN:
+        default:
+            return candidates[start];
+    }
+}
+
+void LoadBalancer::report_success(uint16_t service_id, const transport::Endpoint& endpoint,
+                                  std::chrono::microseconds latency) {
+    std::scoped_lock lock(mutex_);
+    Instance* instance = find(service_id, endpoint);
+    if (instance == nullptr) {
+        return;
+    }
+
+    if (instance->outstanding > 0) {
+        instance->outstanding--;
+    }
+    instance->consecutive_failures = 0;
+
+    add_latency_sample(*instance, static_cast<double>(latency.count()));
+}
+
+void LoadBalancer::report_failure(uint16_t service_id, const transport::Endpoint& endpoint,
+                                  std::chrono::microseconds waited) {
+    std::scoped_lock lock(mutex_);
+    Instance* instance = find(service_id, endpoint);
+    if (instance == nullptr) {
+        return;
+    }
+
+    if (instance->outstanding > 0) {
+        instance->outstanding--;
+    }
+
+    // The response took at least as long as the wait; penalize it so a
+    // timing-out instance cannot keep its low EWMA
+    double sample = std::max(static_cast<double>(waited.count()),
+                             estimate_latency(services_.at(service_id), *instance));
+    add_latency_sample(*instance, sample * config_.failure_latency_penalty);
+
+    if (++instance->consecutive_failures >= config_.max_consecutive_failures) {
+        instance->ejected_until = std::chrono::steady_clock::now() + config_.ejection_duration;
+        instance->consecutive_failures = 0;
+    }
+}
+
+/**
+ * @brief Latency EWMA of an instance, or the service mean while it has no samples
+ */
+double LoadBalancer::estimate_latency(const Service& service, const Instance& instance) const {
+    if (instance.latency_ewma_us > 0.0) {
+        return instance.latency_ewma_us;
+    }
+
+    double total = 0.0;
+    size_t sampled = 0;
+    for (const auto& other : service.instances) {
+        if (other.latency_ewma_us > 0.0) {
+            total += other.latency_ewma_us;
+            sampled++;
+        }
+    }
+    if (sampled == 0) {
+        return static_cast<double>(config_.latency_prior.count());
+    }
+    return total / static_cast<double>(sampled);
+}
+
+void LoadBalancer::add_latency_sample(Instance& instance, double sample_us) {
+    if (instance.latency_ewma_us == 0.0) {
+        instance.latency_ewma_us = sample_us;
+    } else {
+        instance.latency_ewma_us += config_.latency_ewma_alpha * (sample_us - instance.latency_ewma_us);
+    }
+}
+
+void LoadBalancer::release(uint16_t service_id, const transport::Endpoint& endpoint) {
+    std::scoped_lock lock(mutex_);
+    Instance* instance = find(service_id, endpoint);
+    if (instance != nullptr && instance->outstanding > 0) {
+        instance->outstanding--;
+    }
+}
+
+bool LoadBalancer::is_ejected(uint16_t service_id, const transport::Endpoint& endpoint) const {
+    std::scoped_lock lock(mutex_);
+    const Instance* instance = find(service_id, endpoint);
+    return instance != nullptr && instance->ejected_until > std::chrono::steady_clock::now();
+}
+
+uint32_t LoadBalancer::get_outstanding(uint16_t service_id, const transport::Endpoint& endpoint) const {
+    std::scoped_lock lock(mutex_);
+    const Instance* instance = find(service_id, endpoint);
+    return instance != nullptr ? instance->outstanding : 0;
+}
+
+LoadBalancer::Instance* LoadBalancer::find(uint16_t service_id, const transport::Endpoint& endpoint) {
+    auto service = services_.find(service_id);
+    if (service == services_.end()) {
+        return nullptr;
+    }
+    for (auto& instance : service->second.instances) {
+        if (instance.endpoint == endpoint) {
+            return &instance;
+        }
+    }
+    return nullptr;
+}
+
+const LoadBalancer::Instance* LoadBalancer::find(uint16_t service_id, const transport::Endpoint& endpoint) const {
+    return const_cast<LoadBalancer*>(this)->find(service_id, endpoint);
+}
+
+} // namespace rpc
+} // namespace someip
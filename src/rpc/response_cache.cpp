@@ -0,0 +1,131 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "rpc/response_cache.h"
+#include <iterator>
+
+namespace someip {
+namespace rpc {
+
+ResponseCache::ResponseCache(const ResponseCacheConfig& config)
+    : config_(config) {
+}
+
+uint64_t ResponseCache::hash(PayloadView params) noexcept {
+    uint64_t value = 0xCBF29CE484222325ULL;
+    for (uint8_t byte : params) {
+        value ^= byte;
+        value *= 0x100000001B3ULL;
+    }
+    return value;
+}
+
+bool ResponseCache::lookup(PayloadView params, Payload& response) {
+    uint64_t key = hash(params);
+    std::scoped_lock lock(mutex_);
+
+    auto entry = find(key, params);
+    if (entry == entries_.end()) {
+        misses_++;
+        return false;
+    }
+
+    if (config_.ttl.count() > 0 &&
+        std::chrono::steady_clock::now() - entry->stored_at > config_.ttl) {
+        erase(entry);
+        misses_++;
+        return false;
+    }
+
+    // Move to the front of the LRU list
+    entries_.splice(entries_.begin(), entries_, entry);
+    response = entry->response;
+    hits_++;
+    return true;
+}
+
+void ResponseCache::store(PayloadView params, Payload response, uint64_t generation) {
+    if (config_.max_entries == 0) {
+        return;
+    }
+
+    uint64_t key = hash(params);
+    std::scoped_lock lock(mutex_);
+    if (generation != generation_) {
+        return;  // Computed before an invalidation, may be stale
+    }
+
+    auto existing = find(key, params);
+    if (existing != entries_.end()) {
+        erase(existing);
+    }
+
+    entries_.push_front(Entry{key, params.to_vector(), std::move(response),
+                              std::chrono::steady_clock::now()});
+    index_.emplace(key, entries_.begin());
+
+    while (entries_.size() > config_.max_entries) {
+        erase(std::prev(entries_.end()));
+    }
+}
+
+void ResponseCache::clear() {
+    std::scoped_lock lock(mutex_);
+    entries_.clear();
+    index_.clear();
+    generation_++;
+}
+
+uint64_t ResponseCache::get_generation() const {
+    std::scoped_lock lock(mutex_);
+    return generation_;
+}
+
+size_t ResponseCache::size() const {
+    std::scoped_lock lock(mutex_);
+    return entries_.size();
+}
+
+uint64_t ResponseCache::get_hits() const {
+    std::scoped_lock lock(mutex_);
+    return hits_;
+}
+
+uint64_t ResponseCache::get_misses() const {
+    std::scoped_lock lock(mutex_);
+    return misses_;
+}
+
+ResponseCache::EntryList::iterator ResponseCache::find(uint64_t key, PayloadView params) {
+    auto range = index_.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (PayloadView(it->second->params) == params) {
+            return it->second;
+        }
+    }
+    return entries_.end();
+}
+
+void ResponseCache::erase(EntryList::iterator entry) {
+    auto range = index_.equal_range(entry->key);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == entry) {
+            index_.erase(it);
+            break;
+        }
+    }
+    entries_.erase(entry);
+}
+
+} // namespace rpc
+} // namespace someip
@@ -12,13 +12,17 @@
  ********************************************************************************/
 
 #include "rpc/rpc_client.h"
+#include "rpc/load_balancer.h"
+#include "rpc/response_cache.h"
 #include "rpc/rpc_types.h"
 #include "transport/udp_transport.h"
 #include "transport/endpoint.h"
 #include "transport/transport.h"
 #include "someip/message.h"
 #include "core/session_manager.h"
+#include <algorithm>
 #include <unordered_map>
+#include <unordered_set>
 #include <mutex>
 #include <atomic>
 #include <thread>
@@ -43,6 +47,7 @@ public:
         : client_id_(client_id),
           session_manager_(std::make_unique<SessionManager>()),
           transport_(std::make_shared<transport::UdpTransport>(transport::Endpoint("127.0.0.1", 0))),
+          server_endpoint_("127.0.0.1", 30490),
           next_call_handle_(1),
           running_(false) {
 
@@ -63,6 +68,7 @@ public:
         }
 
         running_ = true;
+        timeout_thread_ = std::thread(&RpcClientImpl::timeout_loop, this);
         return true;
     }
 
@@ -71,7 +77,14 @@ public:
             return;
         }
 
-        running_ = false;
+        {
+            std::scoped_lock lock(timeout_mutex_);
+            running_ = false;
+        }
+        timeout_cv_.notify_all();
+        if (timeout_thread_.joinable()) {
+            timeout_thread_.join();
+        }
 
         // Cancel all pending calls
         {
@@ -82,8 +95,12 @@ public:
                                        client_id_, pair.second.session_id, RpcResult::INTERNAL_ERROR);
                     pair.second.callback(response);
                 }
+                release_instance(pair.second);
+                session_manager_->remove_session(pair.second.session_id);
             }
             pending_calls_.clear();
+            calls_by_session_.clear();
+            leaders_.clear();
         }
 
         transport_->stop();
@@ -110,7 +127,7 @@ public:
         // Wait for response with timeout
         auto status = future.wait_for(std::chrono::milliseconds(timeout.response_timeout));
         if (status != std::future_status::ready) {
-            cancel_call(handle);
+            expire_call(handle);
             return {RpcResult::TIMEOUT, {}, timeout.response_timeout};
         }
 
@@ -129,40 +146,128 @@ public:
             return 0;
         }
 
-        // Create session for this call
-        uint16_t session_id = session_manager_->create_session(client_id_);
-
-        // Create request message
+        // Lookup and registration happen in one critical section, so of several
+        // identical calls arriving together exactly one becomes the leader
         MessageId msg_id(service_id, method_id);
-        RequestId req_id(client_id_, session_id);
-        Message request(msg_id, req_id, MessageType::REQUEST, ReturnCode::E_OK);
-        request.set_payload(parameters);
-
-        // Create pending call record
-        PendingCall call_info{
-            service_id, method_id, session_id,
-            std::chrono::steady_clock::now(),
-            timeout, callback
-        };
-
         RpcCallHandle handle;
+        uint16_t session_id;
+        transport::Endpoint server_endpoint;
         {
             std::scoped_lock lock(pending_calls_mutex_);
+            bool coalesce = coalesced_methods_.count(method_key(service_id, method_id)) != 0;
+            uint64_t coalesce_key = coalesce ? request_key(service_id, method_id, parameters) : 0;
+            if (coalesce) {
+                auto leader = find_leader(coalesce_key, service_id, method_id, parameters);
+                if (leader != pending_calls_.end()) {
+                    handle = next_call_handle_++;
+                    PendingCall follower = make_call(service_id, method_id, timeout, std::move(callback));
+                    follower.leader = leader->first;
+                    pending_calls_[handle] = std::move(follower);
+                    leader->second.followers.push_back(handle);
+                    return handle;
+                }
+            }
+
+            // Create session for this call (0 means every session ID is in flight)
+            session_id = session_manager_->create_session(client_id_);
+            if (session_id == 0) {
+                return 0;
+            }
+
+            PendingCall call_info = make_call(service_id, method_id, timeout, std::move(callback));
+            call_info.session_id = session_id;
+            if (coalesce) {
+                call_info.coalesce_key = coalesce_key;
+                call_info.parameters = parameters;
+            }
+
+            // Pick a service instance, or fall back to the configured server
+            call_info.endpoint = server_endpoint_;
+            if (load_balancer_ && load_balancer_->select(service_id, call_info.endpoint)) {
+                call_info.balancer = load_balancer_;
+            }
+            server_endpoint = call_info.endpoint;
+
             handle = next_call_handle_++;
             pending_calls_[handle] = std::move(call_info);
+            calls_by_session_[session_id] = handle;
+            if (coalesce) {
+                leaders_.emplace(coalesce_key, handle);
+            }
         }
 
+        // Create request message
+        RequestId req_id(client_id_, session_id);
+        Message request(msg_id, req_id, MessageType::REQUEST, ReturnCode::E_OK);
+        request.set_payload(parameters);
+
         // Send request
-        transport::Endpoint server_endpoint("127.0.0.1", 30490); // TODO: Make configurable
         if (transport_->send_message(request, server_endpoint) != Result::SUCCESS) {
             std::scoped_lock lock(pending_calls_mutex_);
-            pending_calls_.erase(handle);
+            auto it = pending_calls_.find(handle);
+            if (it != pending_calls_.end()) {
+                // Callers that attached meanwhile share the failure
+                RpcResponse response(service_id, method_id, client_id_, session_id, RpcResult::NETWORK_ERROR);
+                notify_followers(it->second, response);
+                release_instance(it->second);
+                complete_call(it);
+            }
             return 0;
         }
 
         return handle;
     }
 
+    bool send_requests_no_return(uint16_t service_id, const std::vector<NoReturnRequest>& requests) {
+        if (!running_) {
+            return false;
+        }
+
+        std::vector<Message> messages;
+        messages.reserve(requests.size());
+        for (const auto& request : requests) {
+            messages.emplace_back(MessageId(service_id, request.method_id),
+                                  RequestId(client_id_, no_return_sessions_.next()),
+                                  MessageType::REQUEST_NO_RETURN, ReturnCode::E_OK);
+            messages.back().set_payload(request.parameters);
+        }
+
+        // Balanced instances still rotate, but no outcome is ever reported
+        transport::Endpoint endpoint;
+        {
+            std::scoped_lock lock(pending_calls_mutex_);
+            endpoint = server_endpoint_;
+            if (load_balancer_ && load_balancer_->select(service_id, endpoint)) {
+                load_balancer_->release(service_id, endpoint);
+            }
+        }
+
+        if (messages.size() == 1) {
+            return transport_->send_message(messages.front(), endpoint) == Result::SUCCESS;
+        }
+        return transport_->send_messages(messages, endpoint) == Result::SUCCESS;
+    }
+
+    void set_load_balancer(std::shared_ptr<LoadBalancer> balancer) {
+        std::scoped_lock lock(pending_calls_mutex_);
+        load_balancer_ = std::move(balancer);
+    }
+
+    void set_server_endpoint(const transport::Endpoint& endpoint) {
+        std::scoped_lock lock(pending_calls_mutex_);
+        server_endpoint_ = endpoint;
+    }
+
+    bool set_request_coalescing(uint16_t service_id, MethodId method_id, bool enabled) {
+        std::scoped_lock lock(pending_calls_mutex_);
+        uint32_t key = method_key(service_id, method_id);
+        if (enabled) {
+            return coalesced_methods_.insert(key).second;
+        }
+        // Calls already in flight keep their followers
+        return coalesced_methods_.erase(key) > 0;
+    }
+
     bool cancel_call(RpcCallHandle handle) {
         std::scoped_lock lock(pending_calls_mutex_);
         auto it = pending_calls_.find(handle);
@@ -177,7 +282,33 @@ public:
             it->second.callback(response);
         }
 
-        pending_calls_.erase(it);
+        if (it->second.leader != 0) {
+            // A follower only detaches from its leader
+            auto leader = pending_calls_.find(it->second.leader);
+            if (leader != pending_calls_.end()) {
+                auto& followers = leader->second.followers;
+                followers.erase(std::remove(followers.begin(), followers.end(), handle), followers.end());
+            }
+            pending_calls_.erase(it);
+            return true;
+        }
+
+        promote_follower(it->second);
+        release_instance(it->second);
+        complete_call(it);
+        return true;
+    }
+
+    /**
+     * @brief Fail a call that was not answered in time
+     */
+    bool expire_call(RpcCallHandle handle) {
+        std::scoped_lock lock(pending_calls_mutex_);
+        auto it = pending_calls_.find(handle);
+        if (it == pending_calls_.end()) {
+            return false;
+        }
+        expire(it);
         return true;
     }
 
@@ -192,13 +323,213 @@ public:
 
 private:
     struct PendingCall {
-        uint16_t service_id;
-        MethodId method_id;
-        uint16_t session_id;
-        std::chrono::steady_clock::time_point start_time;
+        uint16_t service_id{0};
+        MethodId method_id{0};
+        uint16_t session_id{0};
+        std::chrono::steady_clock::time_point start_time;   // When the caller's timeout started
+        std::chrono::steady_clock::time_point sent_time;    // When the request went out
         RpcTimeout timeout;
         RpcCallback callback;
+
+        // Request coalescing: a leader owns the request on the wire, followers
+        // (session_id 0) wait for its response
+        RpcCallHandle leader{0};
+        std::vector<RpcCallHandle> followers;
+        uint64_t coalesce_key{0};
+        std::vector<uint8_t> parameters;    // Only kept for coalesced leaders
+
+        // Instance the request was sent to; balancer is set if it picked it
+        transport::Endpoint endpoint;
+        std::shared_ptr<LoadBalancer> balancer;
     };
+    using PendingCallMap = std::unordered_map<RpcCallHandle, PendingCall>;
+
+    static PendingCall make_call(uint16_t service_id, MethodId method_id, const RpcTimeout& timeout,
+                                 RpcCallback callback) {
+        PendingCall call;
+        call.service_id = service_id;
+        call.method_id = method_id;
+        call.start_time = std::chrono::steady_clock::now();
+        call.sent_time = call.start_time;
+        call.timeout = timeout;
+        call.callback = std::move(callback);
+        return call;
+    }
+
+    static uint32_t method_key(uint16_t service_id, MethodId method_id) {
+        return (static_cast<uint32_t>(service_id) << 16) | method_id;
+    }
+
+    static uint64_t request_key(uint16_t service_id, MethodId method_id,
+                                const std::vector<uint8_t>& parameters) {
+        return ResponseCache::hash(parameters) ^ (static_cast<uint64_t>(method_key(service_id, method_id)) << 32);
+    }
+
+    /**
+     * @brief Find an in-flight leader for identical parameters
+     * @note Requires pending_calls_mutex_
+     */
+    PendingCallMap::iterator find_leader(uint64_t key, uint16_t service_id, MethodId method_id,
+                                         const std::vector<uint8_t>& parameters) {
+        auto range = leaders_.equal_range(key);
+        for (auto it = range.first; it != range.second; ++it) {
+            auto call = pending_calls_.find(it->second);
+            if (call != pending_calls_.end() && call->second.service_id == service_id &&
+                call->second.method_id == method_id && call->second.parameters == parameters) {
+                return call;
+            }
+        }
+        return pending_calls_.end();
+    }
+
+    /**
+     * @brief Deliver a leader's response to its followers and forget them
+     * @note Requires pending_calls_mutex_
+     */
+    void notify_followers(PendingCall& leader, const RpcResponse& response) {
+        for (RpcCallHandle handle : leader.followers) {
+            auto it = pending_calls_.find(handle);
+            if (it == pending_calls_.end()) {
+                continue;
+            }
+            if (it->second.callback) {
+                it->second.callback(response);
+            }
+            pending_calls_.erase(it);
+        }
+        leader.followers.clear();
+    }
+
+    /**
+     * @brief Hand a cancelled leader's request over to its first follower
+     * @note Requires pending_calls_mutex_
+     */
+    void promote_follower(PendingCall& leader) {
+        while (!leader.followers.empty()) {
+            RpcCallHandle handle = leader.followers.front();
+            leader.followers.erase(leader.followers.begin());
+            auto it = pending_calls_.find(handle);
+            if (it == pending_calls_.end()) {
+                continue;
+            }
+
+            PendingCall& successor = it->second;
+            successor.leader = 0;
+            successor.session_id = leader.session_id;
+            successor.coalesce_key = leader.coalesce_key;
+            successor.parameters = std::move(leader.parameters);
+            successor.followers = std::move(leader.followers);
+            successor.sent_time = leader.sent_time;
+            successor.endpoint = leader.endpoint;
+            successor.balancer = std::move(leader.balancer);
+            for (RpcCallHandle follower : successor.followers) {
+                auto follower_it = pending_calls_.find(follower);
+                if (follower_it != pending_calls_.end()) {
+                    follower_it->second.leader = handle;
+                }
+            }
+            calls_by_session_[successor.session_id] = handle;
+            leaders_.emplace(successor.coalesce_key, handle);
+
+            // The session now belongs to the successor
+            leader.session_id = 0;
+            leader.followers.clear();
+            return;
+        }
+    }
+
+    /**
+     * @brief Return a leader's instance to the balancer without a verdict
+     * @note Requires pending_calls_mutex_
+     */
+    void release_instance(PendingCall& call) {
+        if (call.balancer) {
+            call.balancer->release(call.service_id, call.endpoint);
+            call.balancer.reset();
+        }
+    }
+
+    /**
+     * @brief Complete one call with TIMEOUT
+     *
+     * Other callers coalesced with it keep waiting: a follower just detaches
+     * from its leader, and a leader hands its request over to a follower.
+     *
+     * @note Requires pending_calls_mutex_
+     */
+    void expire(PendingCallMap::iterator it) {
+        PendingCall& call = it->second;
+        RpcResponse response(call.service_id, call.method_id, client_id_, call.session_id, RpcResult::TIMEOUT);
+        if (call.callback) {
+            call.callback(response);
+        }
+
+        if (call.leader != 0) {
+            auto leader = pending_calls_.find(call.leader);
+            if (leader != pending_calls_.end()) {
+                auto& followers = leader->second.followers;
+                followers.erase(std::remove(followers.begin(), followers.end(), it->first), followers.end());
+            }
+            pending_calls_.erase(it);
+            return;
+        }
+
+        promote_follower(call);
+        if (call.balancer) {
+            call.balancer->report_failure(call.service_id, call.endpoint,
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - call.sent_time));
+            call.balancer.reset();
+        }
+        complete_call(it);
+    }
+
+    /**
+     * @brief Expire calls whose response timeout has passed
+     */
+    void timeout_loop() {
+        std::unique_lock timeout_lock(timeout_mutex_);
+        while (running_) {
+            timeout_cv_.wait_for(timeout_lock, TIMEOUT_CHECK_INTERVAL, [this] { return !running_; });
+
+            auto now = std::chrono::steady_clock::now();
+            std::scoped_lock lock(pending_calls_mutex_);
+            for (auto it = pending_calls_.begin(); it != pending_calls_.end();) {
+                auto next = std::next(it);
+                if (now - it->second.start_time >= it->second.timeout.response_timeout) {
+                    expire(it);
+                    // expire() may change other entries, including next
+                    next = pending_calls_.begin();
+                }
+                it = next;
+            }
+        }
+    }
+
+    /**
+     * @brief Forget a pending call and release its session ID
+     * @note Requires pending_calls_mutex_
+     */
+    void complete_call(PendingCallMap::iterator it) {
+        if (it == pending_calls_.end()) {
+            return;
+        }
+        auto range = leaders_.equal_range(it->second.coalesce_key);
+        for (auto leader = range.first; leader != range.second; ++leader) {
+            if (leader->second == it->first) {
+                leaders_.erase(leader);
+                break;
+            }
+        }
+        if (it->second.session_id != 0) {
+            auto session_it = calls_by_session_.find(it->second.session_id);
+            if (session_it != calls_by_session_.end() && session_it->second == it->first) {
+                calls_by_session_.erase(session_it);
+                session_manager_->remove_session(it->second.session_id);
+            }
+        }
+        pending_calls_.erase(it);
+    }
 
     void on_message_received(MessagePtr message, const transport::Endpoint& sender) override {
         // Check if this is a response to one of our pending calls
@@ -209,27 +540,39 @@ private:
         std::scoped_lock lock(pending_calls_mutex_);
 
         // Find matching pending call by session ID
-        for (auto it = pending_calls_.begin(); it != pending_calls_.end(); ++it) {
-            if (it->second.session_id == message->get_session_id() &&
-                it->second.service_id == message->get_service_id() &&
-                it->second.method_id == message->get_method_id()) {
-
-                // Create response
-                RpcResult result = (message->is_success()) ? RpcResult::SUCCESS : RpcResult::INTERNAL_ERROR;
-                RpcResponse response(message->get_service_id(), message->get_method_id(),
-                                   message->get_client_id(), message->get_session_id(), result);
-                response.return_values = message->get_payload();
-
-                // Call callback
-                if (it->second.callback) {
-                    it->second.callback(response);
-                }
+        auto session_it = calls_by_session_.find(message->get_session_id());
+        if (session_it == calls_by_session_.end()) {
+            return;
+        }
 
-                // Remove pending call
-                pending_calls_.erase(it);
-                break;
-            }
+        auto it = pending_calls_.find(session_it->second);
+        if (it == pending_calls_.end() ||
+            it->second.service_id != message->get_service_id() ||
+            it->second.method_id != message->get_method_id()) {
+            return;
+        }
+
+        // Create response
+        RpcResult result = (message->is_success()) ? RpcResult::SUCCESS : RpcResult::INTERNAL_ERROR;
+        RpcResponse response(message->get_service_id(), message->get_method_id(),
+                           message->get_client_id(), message->get_session_id(), result);
+        response.return_values = message->get_payload().to_vector();
+
+        if (it->second.balancer) {
+            it->second.balancer->report_success(it->second.service_id, it->second.endpoint,
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - it->second.sent_time));
+            it->second.balancer.reset();
+        }
+
+        // Call callback
+        if (it->second.callback) {
+            it->second.callback(response);
         }
+        notify_followers(it->second, response);
+
+        // Remove pending call
+        complete_call(it);
     }
 
     void on_connection_lost(const transport::Endpoint& endpoint) override {
@@ -249,9 +592,21 @@ private:
     std::shared_ptr<transport::UdpTransport> transport_;
 
     std::unordered_map<RpcCallHandle, PendingCall> pending_calls_;
+    std::unordered_map<uint16_t, RpcCallHandle> calls_by_session_;  // Session IDs are unique while in flight
+    std::unordered_set<uint32_t> coalesced_methods_;                 // (service << 16) | method
+    std::unordered_multimap<uint64_t, RpcCallHandle> leaders_;       // Coalesced requests in flight
     mutable std::mutex pending_calls_mutex_;
     std::atomic<RpcCallHandle> next_call_handle_;
     std::atomic<bool> running_;
+
+    SessionIdAllocator no_return_sessions_;             // Fire-and-forget requests are not tracked
+    transport::Endpoint server_endpoint_;               // Guarded by pending_calls_mutex_
+    std::shared_ptr<LoadBalancer> load_balancer_;       // Guarded by pending_calls_mutex_
+
+    static constexpr std::chrono::milliseconds TIMEOUT_CHECK_INTERVAL{10};
+    std::thread timeout_thread_;
+    std::mutex timeout_mutex_;
+    std::condition_variable timeout_cv_;
 };
 
 // RpcClient implementation
@@ -282,6 +637,31 @@ RpcCallHandle RpcClient::call_method_async(uint16_t service_id, MethodId method_
     return impl_->call_method_async(service_id, method_id, parameters, callback, timeout);
 }
 
+bool RpcClient::send_request_no_return(uint16_t service_id, MethodId method_id,
+                                       const std::vector<uint8_t>& parameters) {
+    return impl_->send_requests_no_return(service_id, {NoReturnRequest{method_id, parameters}});
+}
+
+bool RpcClient::send_requests_no_return(uint16_t service_id, const std::vector<NoReturnRequest>& requests) {
+    return impl_->send_requests_no_return(service_id, requests);
+}
+
+void RpcClient::set_load_balancer(std::shared_ptr<LoadBalancer> balancer) {
+    impl_->set_load_balancer(std::move(balancer));
+}
+
+void RpcClient::set_server_endpoint(const transport::Endpoint& endpoint) {
+    impl_->set_server_endpoint(endpoint);
+}
+
+bool RpcClient::enable_request_coalescing(uint16_t service_id, MethodId method_id) {
+    return impl_->set_request_coalescing(service_id, method_id, true);
+}
+
+bool RpcClient::disable_request_coalescing(uint16_t service_id, MethodId method_id) {
+    return impl_->set_request_coalescing(service_id, method_id, false);
+}
+
 bool RpcClient::cancel_call(RpcCallHandle handle) {
     return impl_->cancel_call(handle);
 }
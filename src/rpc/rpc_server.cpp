@@ -12,15 +12,14 @@
  ********************************************************************************/
 
 #include "rpc/rpc_server.h"
+#include "rpc/dispatch_table.h"
 #include "rpc/rpc_types.h"
-#include "transport/udp_transport.h"
+#include "rpc/server_runtime.h"
 #include "transport/endpoint.h"
-#include "transport/transport.h"
 #include "someip/message.h"
 #include "common/result.h"
-#include <unordered_map>
-#include <mutex>
 #include <atomic>
+#include <thread>
 
 namespace someip {
 namespace rpc {
@@ -33,14 +32,13 @@ namespace rpc {
  * @satisfies feat_req_someip_711
  * @satisfies feat_req_someip_712
  */
-class RpcServerImpl : public transport::ITransportListener {
+class RpcServerImpl {
 public:
-    RpcServerImpl(uint16_t service_id)
+    RpcServerImpl(uint16_t service_id, std::shared_ptr<ServerRuntime> runtime)
         : service_id_(service_id),
-          transport_(std::make_shared<transport::UdpTransport>(transport::Endpoint("127.0.0.1", 30490))),
+          owns_runtime_(runtime == nullptr),
+          runtime_(runtime ? std::move(runtime) : std::make_shared<ServerRuntime>()),
           running_(false) {
-
-        transport_->set_listener(this);
     }
 
     ~RpcServerImpl() {
@@ -52,11 +50,26 @@ public:
             return true;
         }
 
-        if (transport_->start() != Result::SUCCESS) {
+        if (!runtime_->start()) {
+            return false;
+        }
+
+        // Another server may already host this service on the shared runtime
+        if (!runtime_->register_service(service_id_,
+                [this](MessagePtr message, const transport::Endpoint& sender) {
+                    on_message_received(std::move(message), sender);
+                })) {
+            if (owns_runtime_) {
+                runtime_->stop();
+            }
             return false;
         }
 
         running_ = true;
+        if (admission_) {
+            admission_->reopen();
+            worker_ = std::thread(&RpcServerImpl::worker_loop, this);
+        }
         return true;
     }
 
@@ -66,107 +79,168 @@ public:
         }
 
         running_ = false;
+        runtime_->unregister_service(service_id_);
+
+        // Drop queued requests and let the one in progress finish
+        if (admission_) {
+            admission_->close();
+            if (worker_.joinable()) {
+                worker_.join();
+            }
+        }
 
         // Clear all method handlers
-        std::scoped_lock lock(methods_mutex_);
         method_handlers_.clear();
+        response_caches_.clear();
 
-        transport_->stop();
+        if (owns_runtime_) {
+            runtime_->stop();
+        }
     }
 
     bool register_method(MethodId method_id, MethodHandler handler) {
-        std::scoped_lock lock(methods_mutex_);
+        // Fails if already registered
+        return method_handlers_.insert(method_id, std::move(handler));
+    }
+
+    bool unregister_method(MethodId method_id) {
+        response_caches_.erase(method_id);
+        return method_handlers_.erase(method_id);
+    }
+
+    bool enable_response_cache(MethodId method_id, const ResponseCacheConfig& config) {
+        return response_caches_.insert(method_id, std::make_shared<ResponseCache>(config));
+    }
+
+    bool disable_response_cache(MethodId method_id) {
+        return response_caches_.erase(method_id);
+    }
 
-        // Check if already registered
-        bool already_exists = method_handlers_.count(method_id) > 0;
-        if (!already_exists) {
-            method_handlers_[method_id] = handler;
+    void invalidate_response_cache(MethodId method_id) {
+        DispatchTable<std::shared_ptr<ResponseCache>>::Reader caches(response_caches_);
+        const auto* cache = caches.find(method_id);
+        if (cache != nullptr) {
+            (*cache)->clear();
         }
-        return !already_exists;
     }
 
-    bool unregister_method(MethodId method_id) {
-        std::scoped_lock lock(methods_mutex_);
-        return method_handlers_.erase(method_id) > 0;
+    bool enable_admission_control(const AdmissionConfig& config) {
+        if (running_) {
+            return false;
+        }
+        admission_ = std::make_unique<AdmissionController>(config);
+        return true;
     }
 
     bool is_method_registered(MethodId method_id) const {
-        std::scoped_lock lock(methods_mutex_);
-        return method_handlers_.find(method_id) != method_handlers_.end();
+        return method_handlers_.contains(method_id);
     }
 
     std::vector<MethodId> get_registered_methods() const {
-        std::scoped_lock lock(methods_mutex_);
-        std::vector<MethodId> methods;
-        methods.reserve(method_handlers_.size());
-        for (const auto& pair : method_handlers_) {
-            methods.push_back(pair.first);
-        }
-        return methods;
+        return method_handlers_.ids();
     }
 
     bool is_ready() const {
-        return running_ && transport_->is_connected();
+        return running_ && runtime_->is_running();
     }
 
     RpcServer::Statistics get_statistics() const {
         // TODO: Implement statistics tracking
-        return RpcServer::Statistics{};
+        RpcServer::Statistics statistics;
+        if (admission_) {
+            statistics.rejected_calls = static_cast<uint32_t>(admission_->get_rejected());
+        }
+        return statistics;
     }
 
 private:
-    void on_message_received(MessagePtr message, const transport::Endpoint& sender) override {
-        // Check if this is for our service and is a request
-        if (message->get_service_id() != service_id_ || !message->is_request()) {
+    void on_message_received(MessagePtr message, const transport::Endpoint& sender) {
+        // The runtime only dispatches our service; ignore anything but requests
+        if (!message->is_request()) {
             return;
         }
 
-        // Find method handler
-        MethodHandler handler;
-        {
-            std::scoped_lock lock(methods_mutex_);
-            auto it = method_handlers_.find(message->get_method_id());
-            if (it == method_handlers_.end()) {
-                // Method not found - send error response
+        if (!admission_) {
+            dispatch(message, sender);
+            return;
+        }
+
+        // Refuse quickly under overload instead of queueing without bound
+        uint32_t cost = static_cast<uint32_t>(message->get_total_size());
+        AdmissionResult verdict = admission_->admit(message->get_client_id(), message->get_method_id(), cost,
+            [this, message, sender]() { dispatch(message, sender); });
+        if (verdict != AdmissionResult::ADMITTED &&
+            message->get_message_type() != MessageType::REQUEST_NO_RETURN) {
+            send_error_response(message, sender, ReturnCode::E_NOT_READY);
+        }
+    }
+
+    void worker_loop() {
+        AdmissionController::Task task;
+        while (admission_->wait_pop(task)) {
+            task();
+        }
+    }
+
+    void dispatch(const MessagePtr& message, const transport::Endpoint& sender) {
+        // Find method handler (lock-free; the handler stays alive while pinned)
+        DispatchTable<MethodHandler>::Reader handlers(method_handlers_);
+        const MethodHandler* handler = handlers.find(message->get_method_id());
+        bool fire_and_forget = message->get_message_type() == MessageType::REQUEST_NO_RETURN;
+        if (handler == nullptr) {
+            // Method not found - send error response (never for fire-and-forget)
+            if (!fire_and_forget) {
                 send_error_response(message, sender, ReturnCode::E_UNKNOWN_METHOD);
+            }
+            return;
+        }
+
+        if (fire_and_forget) {
+            // No response is built or sent, and nothing is cached
+            std::vector<uint8_t> discarded;
+            (void)(*handler)(message->get_client_id(), message->get_session_id(),
+                             message->get_payload(), discarded);
+            return;
+        }
+
+        // Answer from the response cache without running the handler
+        DispatchTable<std::shared_ptr<ResponseCache>>::Reader caches(response_caches_);
+        const auto* cache = caches.find(message->get_method_id());
+        uint64_t cache_generation = 0;
+        if (cache != nullptr) {
+            cache_generation = (*cache)->get_generation();
+            Payload cached;
+            if ((*cache)->lookup(message->get_payload(), cached)) {
+                send_success_response(message, sender, cached);
                 return;
             }
-            handler = it->second;
         }
 
         // Process the method call
         std::vector<uint8_t> output_params;
-        RpcResult result = handler(message->get_client_id(), message->get_session_id(),
-                                  message->get_payload(), output_params);
+        RpcResult result = (*handler)(message->get_client_id(), message->get_session_id(),
+                                      message->get_payload(), output_params);
 
         // Send response
         if (result == RpcResult::SUCCESS) {
-            send_success_response(message, sender, output_params);
+            Payload return_values(std::move(output_params));
+            if (cache != nullptr) {
+                (*cache)->store(message->get_payload(), return_values, cache_generation);
+            }
+            send_success_response(message, sender, return_values);
         } else {
             send_error_response(message, sender, map_rpc_result_to_return_code(result));
         }
     }
 
-    void on_connection_lost(const transport::Endpoint& endpoint) override {
-        // TODO: Handle connection loss
-    }
-
-    void on_connection_established(const transport::Endpoint& endpoint) override {
-        // TODO: Handle connection establishment
-    }
-
-    void on_error(Result error) override {
-        // TODO: Handle transport errors
-    }
-
     void send_success_response(MessagePtr request, const transport::Endpoint& sender,
-                              const std::vector<uint8_t>& return_values) {
+                              const Payload& return_values) {
         MessageId response_msg_id(request->get_service_id(), request->get_method_id());
         Message response(response_msg_id, request->get_request_id(),
                         MessageType::RESPONSE, ReturnCode::E_OK);
         response.set_payload(return_values);
 
-        Result result = transport_->send_message(response, sender);
+        Result result = runtime_->send_message(response, sender);
         if (result != Result::SUCCESS) {
             // Log error or handle send failure
         }
@@ -177,7 +251,7 @@ private:
         Message response(response_msg_id, request->get_request_id(),
                         MessageType::ERROR, error_code);
 
-        Result result = transport_->send_message(response, sender);
+        Result result = runtime_->send_message(response, sender);
         if (result != Result::SUCCESS) {
             // Log error or handle send failure
         }
@@ -201,17 +275,25 @@ private:
     }
 
     uint16_t service_id_;
-    std::shared_ptr<transport::UdpTransport> transport_;
+    bool owns_runtime_;
+    std::shared_ptr<ServerRuntime> runtime_;
+
+    DispatchTable<MethodHandler> method_handlers_;
+    DispatchTable<std::shared_ptr<ResponseCache>> response_caches_;
 
-    std::unordered_map<MethodId, MethodHandler> method_handlers_;
-    mutable std::mutex methods_mutex_;
+    std::unique_ptr<AdmissionController> admission_;
+    std::thread worker_;
 
     std::atomic<bool> running_;
 };
 
 // RpcServer implementation
 RpcServer::RpcServer(uint16_t service_id)
-    : impl_(std::make_unique<RpcServerImpl>(service_id)) {
+    : impl_(std::make_unique<RpcServerImpl>(service_id, nullptr)) {
+}
+
+RpcServer::RpcServer(uint16_t service_id, std::shared_ptr<ServerRuntime> runtime)
+    : impl_(std::make_unique<RpcServerImpl>(service_id, std::move(runtime))) {
 }
 
 RpcServer::~RpcServer() = default;
@@ -225,13 +307,29 @@ void RpcServer::shutdown() {
 }
 
 bool RpcServer::register_method(MethodId method_id, MethodHandler handler) {
-    return impl_->register_method(method_id, handler);
+    return impl_->register_method(method_id, std::move(handler));
 }
 
 bool RpcServer::unregister_method(MethodId method_id) {
     return impl_->unregister_method(method_id);
 }
 
+bool RpcServer::enable_response_cache(MethodId method_id, const ResponseCacheConfig& config) {
+    return impl_->enable_response_cache(method_id, config);
+}
+
+bool RpcServer::disable_response_cache(MethodId method_id) {
+    return impl_->disable_response_cache(method_id);
+}
+
+void RpcServer::invalidate_response_cache(MethodId method_id) {
+    impl_->invalidate_response_cache(method_id);
+}
+
+bool RpcServer::enable_admission_control(const AdmissionConfig& config) {
+    return impl_->enable_admission_control(config);
+}
+
 bool RpcServer::is_method_registered(MethodId method_id) const {
     return impl_->is_method_registered(method_id);
 }
@@ -0,0 +1,227 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "rpc/server_runtime.h"
+#include "rpc/dispatch_table.h"
+#include "transport/udp_transport.h"
+#include <map>
+#include <mutex>
+
+namespace someip {
+namespace rpc {
+
+/**
+ * @brief Server runtime implementation
+ * @implements REQ_ARCH_001
+ */
+class ServerRuntimeImpl : public transport::ITransportListener {
+public:
+    explicit ServerRuntimeImpl(std::shared_ptr<transport::ITransport> transport)
+        : transport_(std::move(transport)) {
+        transport_->set_listener(this);
+    }
+
+    ~ServerRuntimeImpl() override {
+        stop();
+        transport_->set_listener(nullptr);
+    }
+
+    bool start() {
+        std::scoped_lock lock(state_mutex_);
+        if (transport_->is_running()) {
+            return true;
+        }
+        return transport_->start() == Result::SUCCESS;
+    }
+
+    void stop() {
+        std::scoped_lock lock(state_mutex_);
+        if (transport_->is_running()) {
+            (void)transport_->stop();
+        }
+    }
+
+    bool is_running() const {
+        return transport_->is_running();
+    }
+
+    bool register_service(uint16_t service_id, ServiceHandler handler) {
+        return services_.insert(service_id, std::move(handler));
+    }
+
+    bool unregister_service(uint16_t service_id) {
+        if (!services_.erase(service_id)) {
+            return false;
+        }
+        // Let an in-flight dispatch to this service finish before the caller
+        // tears down the state its handler refers to
+        services_.synchronize();
+        return true;
+    }
+
+    bool is_service_registered(uint16_t service_id) const {
+        return services_.contains(service_id);
+    }
+
+    std::vector<uint16_t> get_registered_services() const {
+        return services_.ids();
+    }
+
+    uint32_t add_connection_observer(ConnectionObserver observer) {
+        std::scoped_lock lock(observers_mutex_);
+        uint32_t id = next_observer_id_++;
+        observers_.emplace(id, std::move(observer));
+        return id;
+    }
+
+    void remove_connection_observer(uint32_t id) {
+        std::scoped_lock lock(observers_mutex_);
+        observers_.erase(id);
+    }
+
+    Result send_message(const Message& message, const transport::Endpoint& endpoint) {
+        return transport_->send_message(message, endpoint);
+    }
+
+    Result send_serialized(const uint8_t* data, size_t size, const transport::Endpoint& endpoint) {
+        return transport_->send_serialized(data, size, endpoint);
+    }
+
+    transport::Endpoint get_local_endpoint() const {
+        return transport_->get_local_endpoint();
+    }
+
+    std::shared_ptr<transport::ITransport> get_transport() const {
+        return transport_;
+    }
+
+private:
+    void on_message_received(MessagePtr message, const transport::Endpoint& sender) override {
+        DispatchTable<ServiceHandler>::Reader services(services_);
+        const ServiceHandler* handler = services.find(message->get_service_id());
+        if (handler != nullptr) {
+            (*handler)(std::move(message), sender);
+            return;
+        }
+
+        if (message->get_message_type() == MessageType::REQUEST) {
+            // Service not hosted here - send error response
+            MessageId response_msg_id(message->get_service_id(), message->get_method_id());
+            Message response(response_msg_id, message->get_request_id(),
+                            MessageType::ERROR, ReturnCode::E_UNKNOWN_SERVICE);
+            (void)transport_->send_message(response, sender);
+        }
+    }
+
+    // Connection events are rare, so observers are called under their mutex;
+    // this is what lets remove_connection_observer() wait for a running one
+    void on_connection_lost(const transport::Endpoint& endpoint) override {
+        std::scoped_lock lock(observers_mutex_);
+        for (const auto& entry : observers_) {
+            if (entry.second.on_connection_lost) {
+                entry.second.on_connection_lost(endpoint);
+            }
+        }
+    }
+
+    void on_connection_established(const transport::Endpoint& endpoint) override {
+        std::scoped_lock lock(observers_mutex_);
+        for (const auto& entry : observers_) {
+            if (entry.second.on_connection_established) {
+                entry.second.on_connection_established(endpoint);
+            }
+        }
+    }
+
+    void on_error(Result error) override {
+        std::scoped_lock lock(observers_mutex_);
+        for (const auto& entry : observers_) {
+            if (entry.second.on_error) {
+                entry.second.on_error(error);
+            }
+        }
+    }
+
+    std::shared_ptr<transport::ITransport> transport_;
+    DispatchTable<ServiceHandler> services_;
+    std::mutex state_mutex_;
+    std::map<uint32_t, ConnectionObserver> observers_;
+    uint32_t next_observer_id_{1};
+    std::mutex observers_mutex_;
+};
+
+// ServerRuntime implementation
+ServerRuntime::ServerRuntime(const transport::Endpoint& endpoint)
+    : impl_(std::make_unique<ServerRuntimeImpl>(std::make_shared<transport::UdpTransport>(endpoint))) {
+}
+
+ServerRuntime::ServerRuntime(std::shared_ptr<transport::ITransport> transport)
+    : impl_(std::make_unique<ServerRuntimeImpl>(std::move(transport))) {
+}
+
+ServerRuntime::~ServerRuntime() = default;
+
+bool ServerRuntime::start() {
+    return impl_->start();
+}
+
+void ServerRuntime::stop() {
+    impl_->stop();
+}
+
+bool ServerRuntime::is_running() const {
+    return impl_->is_running();
+}
+
+bool ServerRuntime::register_service(uint16_t service_id, ServiceHandler handler) {
+    return impl_->register_service(service_id, std::move(handler));
+}
+
+bool ServerRuntime::unregister_service(uint16_t service_id) {
+    return impl_->unregister_service(service_id);
+}
+
+bool ServerRuntime::is_service_registered(uint16_t service_id) const {
+    return impl_->is_service_registered(service_id);
+}
+
+std::vector<uint16_t> ServerRuntime::get_registered_services() const {
+    return impl_->get_registered_services();
+}
+
+uint32_t ServerRuntime::add_connection_observer(ConnectionObserver observer) {
+    return impl_->add_connection_observer(std::move(observer));
+}
+
+void ServerRuntime::remove_connection_observer(uint32_t id) {
+    impl_->remove_connection_observer(id);
+}
+
+Result ServerRuntime::send_message(const Message& message, const transport::Endpoint& endpoint) {
+    return impl_->send_message(message, endpoint);
+}
+
+Result ServerRuntime::send_serialized(const uint8_t* data, size_t size, const transport::Endpoint& endpoint) {
+    return impl_->send_serialized(data, size, endpoint);
+}
+
+transport::Endpoint ServerRuntime::get_local_endpoint() const {
+    return impl_->get_local_endpoint();
+}
+
+std::shared_ptr<transport::ITransport> ServerRuntime::get_transport() const {
+    return impl_->get_transport();
+}
+
+} // namespace rpc
+} // namespace someip
@@ -0,0 +1,216 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "sd/sd_cache.h"
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace someip {
+namespace sd {
+
+namespace {
+
+constexpr uint32_t CACHE_MAGIC = 0x53444331;  // "SDC1"
+constexpr uint16_t CACHE_VERSION = 1;
+
+uint64_t unix_now() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+}
+
+} // namespace
+
+struct SdCache::Header {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t record_size;
+    uint32_t capacity;
+    uint32_t reserved;
+};
+
+struct SdCache::Record {
+    uint64_t expires_at;    // Unix time in seconds, 0 = free slot
+    uint32_t ipv4_address;  // Network byte order
+    uint16_t service_id;
+    uint16_t instance_id;
+    uint16_t port;
+    uint8_t major_version;
+    uint8_t minor_version;
+    uint8_t protocol;
+    uint8_t reserved[3];
+};
+
+SdCache::~SdCache() {
+    close();
+}
+
+bool SdCache::open(const std::string& path, size_t capacity) {
+    std::scoped_lock lock(mutex_);
+    if (map_ != nullptr || capacity == 0) {
+        return false;
+    }
+
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return false;
+    }
+
+    size_t size = sizeof(Header) + capacity * sizeof(Record);
+    struct stat st{};
+    bool reset = fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) != size;
+    if (reset && (ftruncate(fd, 0) != 0 || ftruncate(fd, static_cast<off_t>(size)) != 0)) {
+        ::close(fd);
+        return false;
+    }
+
+    void* map = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (map == MAP_FAILED) {
+        ::close(fd);
+        return false;
+    }
+
+    auto* header = static_cast<Header*>(map);
+    if (header->magic != CACHE_MAGIC || header->version != CACHE_VERSION ||
+        header->record_size != sizeof(Record) || header->capacity != capacity) {
+        // New file or another layout: start empty
+        std::memset(map, 0, size);
+        header->magic = CACHE_MAGIC;
+        header->version = CACHE_VERSION;
+        header->record_size = sizeof(Record);
+        header->capacity = static_cast<uint32_t>(capacity);
+    }
+
+    fd_ = fd;
+    map_ = map;
+    map_size_ = size;
+    capacity_ = capacity;
+    return true;
+}
+
+void SdCache::close() {
+    std::scoped_lock lock(mutex_);
+    if (map_ != nullptr) {
+        msync(map_, map_size_, MS_ASYNC);
+        munmap(map_, map_size_);
+        map_ = nullptr;
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+}
+
+bool SdCache::is_open() const {
+    std::scoped_lock lock(mutex_);
+    return map_ != nullptr;
+}
+
+SdCache::Record* SdCache::records() const {
+    return reinterpret_cast<Record*>(static_cast<uint8_t*>(map_) + sizeof(Header));
+}
+
+SdCache::Record* SdCache::find(uint16_t service_id, uint16_t instance_id) const {
+    Record* record = records();
+    for (size_t i = 0; i < capacity_; ++i) {
+        if (record[i].expires_at != 0 && record[i].service_id == service_id &&
+            record[i].instance_id == instance_id) {
+            return &record[i];
+        }
+    }
+    return nullptr;
+}
+
+std::vector<ServiceInstance> SdCache::load() const {
+    std::scoped_lock lock(mutex_);
+    std::vector<ServiceInstance> result;
+    if (map_ == nullptr) {
+        return result;
+    }
+
+    uint64_t now = unix_now();
+    const Record* record = records();
+    for (size_t i = 0; i < capacity_; ++i) {
+        if (record[i].expires_at <= now) {
+            continue;  // Free or expired
+        }
+
+        ServiceInstance instance(record[i].service_id, record[i].instance_id,
+                                 record[i].major_version, record[i].minor_version);
+        char address[INET_ADDRSTRLEN] = {};
+        in_addr addr{};
+        addr.s_addr = record[i].ipv4_address;
+        if (inet_ntop(AF_INET, &addr, address, sizeof(address)) != nullptr) {
+            instance.ip_address = address;
+        }
+        instance.port = record[i].port;
+        instance.protocol = record[i].protocol;
+        instance.ttl_seconds = static_cast<uint32_t>(record[i].expires_at - now);
+        result.push_back(instance);
+    }
+    return result;
+}
+
+bool SdCache::store(const ServiceInstance& instance) {
+    std::scoped_lock lock(mutex_);
+    if (map_ == nullptr) {
+        return false;
+    }
+
+    in_addr addr{};
+    if (inet_pton(AF_INET, instance.ip_address.c_str(), &addr) != 1) {
+        return false;
+    }
+
+    Record* slot = find(instance.service_id, instance.instance_id);
+    if (slot == nullptr) {
+        // Free (or expired) slot first, otherwise the one closest to expiry
+        Record* record = records();
+        slot = &record[0];
+        for (size_t i = 0; i < capacity_; ++i) {
+            if (record[i].expires_at < slot->expires_at) {
+                slot = &record[i];
+            }
+        }
+    }
+
+    Record updated{};
+    updated.expires_at = unix_now() + std::max<uint32_t>(instance.ttl_seconds, 1);
+    updated.ipv4_address = addr.s_addr;
+    updated.service_id = instance.service_id;
+    updated.instance_id = instance.instance_id;
+    updated.port = instance.port;
+    updated.major_version = instance.major_version;
+    updated.minor_version = instance.minor_version;
+    updated.protocol = instance.protocol;
+    *slot = updated;
+    return true;
+}
+
+void SdCache::remove(uint16_t service_id, uint16_t instance_id) {
+    std::scoped_lock lock(mutex_);
+    if (map_ == nullptr) {
+        return;
+    }
+    if (Record* slot = find(service_id, instance_id)) {
+        std::memset(slot, 0, sizeof(Record));
+    }
+}
+
+} // namespace sd
+} // namespace someip
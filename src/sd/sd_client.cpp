@@ -12,7 +12,9 @@
  ********************************************************************************/
 
 #include "sd/sd_client.h"
+#include "sd/sd_cache.h"
 #include "sd/sd_message.h"
+#include "sd/static_discovery.h"
 #include "transport/udp_transport.h"
 #include "transport/endpoint.h"
 #include "transport/transport.h"
@@ -44,10 +46,18 @@ public:
         : config_(config),
           transport_(std::make_shared<transport::UdpTransport>(
               transport::Endpoint(config.unicast_address, config.unicast_port))),
+          static_mode_(!config.static_config_file.empty()),
           running_(false),
           next_request_id_(1) {
 
         transport_->set_listener(this);
+
+        // Only SD messages are handled here; drop all other traffic in the kernel
+        transport::MessageFilter sd_filter;
+        sd_filter.add_method(SOMEIP_SD_SERVICE_ID, SOMEIP_SD_METHOD_ID);
+        if (transport_->set_message_filter(sd_filter) != Result::SUCCESS) {
+            // Not critical - messages are still checked in on_message_received
+        }
     }
 
     ~SdClientImpl() {
@@ -59,17 +69,26 @@ public:
             return true;
         }
 
+        if (static_mode_ && !load_static_discovery(config_.static_config_file, static_config_)) {
+            return false;
+        }
+
         if (transport_->start() != Result::SUCCESS) {
             return false;
         }
 
-        // Join multicast group for SD messages
-        if (!join_multicast_group()) {
+        // Join multicast group for SD messages (static mode: only to verify in the background)
+        if (dynamic_sd_enabled() && !join_multicast_group()) {
             transport_->stop();
             return false;
         }
 
         running_ = true;
+        if (static_mode_) {
+            restore_static_services();
+        } else {
+            restore_cached_services();
+        }
         return true;
     }
 
@@ -87,9 +106,12 @@ public:
         }
 
         // Leave multicast group
-        leave_multicast_group();
+        if (dynamic_sd_enabled()) {
+            leave_multicast_group();
+        }
 
         transport_->stop();
+        cache_.close();
     }
 
     /**
@@ -103,6 +125,12 @@ public:
             return false;
         }
 
+        if (static_mode_ && answer_find_statically(service_id, callback)) {
+            return true;
+        }
+
+        evict_stale_cached_services();
+
         // Create find service entry
         auto find_entry = std::make_unique<ServiceEntry>(EntryType::FIND_SERVICE);
         find_entry->set_service_id(service_id);
@@ -125,6 +153,23 @@ public:
             return false;
         }
 
+        // Answer from the cache right away; the live offer confirms it later
+        std::vector<ServiceInstance> cached;
+        {
+            std::scoped_lock lock(available_services_mutex_);
+            for (const auto& service : available_services_) {
+                if (service.service_id == service_id && service.from_cache) {
+                    cached.push_back(service);
+                }
+            }
+        }
+        if (!cached.empty()) {
+            if (callback) {
+                callback(cached);
+            }
+            return true;
+        }
+
         // Store callback for responses
         uint32_t request_id = next_request_id_++;
         {
@@ -147,17 +192,30 @@ public:
                           ServiceAvailableCallback available_callback,
                           ServiceUnavailableCallback unavailable_callback) {
 
-        std::scoped_lock lock(subscriptions_mutex_);
+        ServiceAvailableCallback notify_static;
+        {
+            std::scoped_lock lock(subscriptions_mutex_);
 
-        // Check if already subscribed
-        bool already_exists = service_subscriptions_.count(service_id) > 0;
-        if (!already_exists) {
+            // Check if already subscribed
+            if (service_subscriptions_.count(service_id) > 0) {
+                return false;
+            }
+            if (static_mode_) {
+                notify_static = available_callback;
+            }
             service_subscriptions_[service_id] = {
                 std::move(available_callback),
                 std::move(unavailable_callback)
             };
         }
-        return !already_exists;
+
+        // Statically configured instances are available from the start
+        if (notify_static) {
+            for (const auto& instance : get_available_services(service_id)) {
+                notify_static(instance);
+            }
+        }
+        return true;
     }
 
     bool unsubscribe_service(uint16_t service_id) {
@@ -174,6 +232,11 @@ public:
             return false;
         }
 
+        if (static_mode_) {
+            // Membership is part of the configuration; nothing to negotiate
+            return static_config_.find_eventgroup(service_id, instance_id, eventgroup_id) != nullptr;
+        }
+
         // Create subscribe event group entry
         auto subscribe_entry = std::make_unique<EventGroupEntry>(EntryType::SUBSCRIBE_EVENTGROUP);
         subscribe_entry->set_service_id(service_id);
@@ -213,6 +276,10 @@ public:
             return false;
         }
 
+        if (static_mode_) {
+            return static_config_.find_eventgroup(service_id, instance_id, eventgroup_id) != nullptr;
+        }
+
         // Create unsubscribe event group entry (TTL = 0)
         auto unsubscribe_entry = std::make_unique<EventGroupEntry>(EntryType::STOP_SUBSCRIBE_EVENTGROUP);
         unsubscribe_entry->set_service_id(service_id);
@@ -238,8 +305,12 @@ public:
     std::vector<ServiceInstance> get_available_services(uint16_t service_id) const {
         std::scoped_lock lock(available_services_mutex_);
         std::vector<ServiceInstance> result;
+        auto now = std::chrono::steady_clock::now();
 
         for (const auto& service : available_services_) {
+            if (service.from_cache && cached_deadline_passed(service, now)) {
+                continue;  // Not confirmed in time; evicted on the next SD activity
+            }
             if (service_id == 0 || service.service_id == service_id) {
                 result.push_back(service);
             }
@@ -270,6 +341,91 @@ private:
         std::chrono::milliseconds timeout;
     };
 
+    bool dynamic_sd_enabled() const {
+        return !static_mode_ || config_.static_verification;
+    }
+
+    void restore_static_services() {
+        std::scoped_lock lock(available_services_mutex_);
+        available_services_.clear();
+        for (const auto& service : static_config_.services) {
+            available_services_.push_back(service.instance);
+        }
+    }
+
+    /**
+     * @brief Answer a find from the static configuration
+     * @return false if dynamic SD should still look for the service
+     */
+    bool answer_find_statically(uint16_t service_id, const FindServiceCallback& callback) {
+        auto found = get_available_services(service_id);
+        if (found.empty() && config_.static_verification) {
+            return false;
+        }
+        if (callback) {
+            callback(found);
+        }
+        return true;
+    }
+
+    static uint32_t instance_key(uint16_t service_id, uint16_t instance_id) {
+        return (static_cast<uint32_t>(service_id) << 16) | instance_id;
+    }
+
+    /**
+     * @brief Make the cached offers available until a live offer confirms them
+     *
+     * A cached instance that is still offered is re-announced within one
+     * cyclic offer interval, so it is evicted if no offer arrives within two
+     * intervals (or earlier, when its TTL runs out).
+     */
+    void restore_cached_services() {
+        if (config_.cache_file.empty() ||
+            (!cache_.is_open() && !cache_.open(config_.cache_file, config_.max_services))) {
+            return;
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        std::scoped_lock lock(available_services_mutex_);
+        for (auto& instance : cache_.load()) {
+            bool known = std::any_of(available_services_.begin(), available_services_.end(),
+                [&](const ServiceInstance& svc) {
+                    return svc.service_id == instance.service_id &&
+                           svc.instance_id == instance.instance_id;
+                });
+            if (known) {
+                continue;
+            }
+
+            auto confirm_within = std::min<std::chrono::steady_clock::duration>(
+                std::chrono::seconds(instance.ttl_seconds), 2 * config_.cyclic_offer);
+            cached_deadlines_[instance_key(instance.service_id, instance.instance_id)] = now + confirm_within;
+            instance.from_cache = true;
+            available_services_.push_back(instance);
+        }
+    }
+
+    bool cached_deadline_passed(const ServiceInstance& instance,
+                                std::chrono::steady_clock::time_point now) const {
+        auto deadline = cached_deadlines_.find(instance_key(instance.service_id, instance.instance_id));
+        return deadline != cached_deadlines_.end() && deadline->second <= now;
+    }
+
+    void evict_stale_cached_services() {
+        auto now = std::chrono::steady_clock::now();
+        std::scoped_lock lock(available_services_mutex_);
+        auto it = std::remove_if(available_services_.begin(), available_services_.end(),
+            [&](const ServiceInstance& svc) {
+                if (!svc.from_cache || !cached_deadline_passed(svc, now)) {
+                    return false;
+                }
+                cached_deadlines_.erase(instance_key(svc.service_id, svc.instance_id));
+                cache_.remove(svc.service_id, svc.instance_id);
+                return true;
+            });
+        available_services_.erase(it, available_services_.end());
+    }
+
     bool join_multicast_group() {
         auto udp_transport = std::dynamic_pointer_cast<transport::UdpTransport>(transport_);
         if (!udp_transport) {
@@ -293,13 +449,18 @@ private:
             return;
         }
 
+        if (!dynamic_sd_enabled()) {
+            return;
+        }
+
         // Parse SD message
         SdMessage sd_message;
-        if (!sd_message.deserialize(message->get_payload())) {
+        if (!sd_message.deserialize(message->get_payload().to_vector())) {
             return;
         }
 
         // Process SD entries
+        evict_stale_cached_services();
         process_sd_entries(sd_message);
     }
 
@@ -341,20 +502,14 @@ private:
         instance.minor_version = 0;  // Not in basic offer
         instance.ttl_seconds = entry.get_ttl();
 
-        // Extract endpoint information from options
+        // Extract endpoint information from the option referenced by index1
         const auto& options = message.get_options();
         uint8_t index1 = entry.get_index1();
-        uint8_t run1 = entry.get_index1() ? 1 : 0;  // Simple case: check if index1 is set
-
-        for (uint8_t i = 0; i < run1 && (index1 + i) < options.size(); ++i) {
-            const auto& option = options[index1 + i];
-            if (option->get_type() == OptionType::IPV4_ENDPOINT) {
-                auto* ep = static_cast<const IPv4EndpointOption*>(option.get());
-                instance.ip_address = ep->get_ipv4_address_string();
-                instance.port = ep->get_port();
-                instance.protocol = ep->get_protocol();
-                break;  // Found the endpoint option
-            }
+        if (index1 < options.size() && options[index1]->get_type() == OptionType::IPV4_ENDPOINT) {
+            auto* ep = static_cast<const IPv4EndpointOption*>(options[index1].get());
+            instance.ip_address = ep->get_ipv4_address_string();
+            instance.port = ep->get_port();
+            instance.protocol = ep->get_protocol();
         }
 
         // Update available services
@@ -369,8 +524,16 @@ private:
             if (it == available_services_.end()) {
                 available_services_.push_back(instance);
             } else {
-                *it = instance;  // Update existing
+                if (instance.ip_address.empty()) {
+                    // Offer without an endpoint option: keep the known endpoint
+                    instance.ip_address = it->ip_address;
+                    instance.port = it->port;
+                    instance.protocol = it->protocol;
+                }
+                *it = instance;  // Update existing (confirms a cached entry)
             }
+            cached_deadlines_.erase(instance_key(instance.service_id, instance.instance_id));
+            cache_.store(instance);
         }
 
         // Notify subscribers
@@ -411,6 +574,8 @@ private:
                            svc.instance_id == instance.instance_id;
                 });
             available_services_.erase(it, available_services_.end());
+            cached_deadlines_.erase(instance_key(instance.service_id, instance.instance_id));
+            cache_.remove(instance.service_id, instance.instance_id);
         }
 
         // Notify subscribers
@@ -423,11 +588,15 @@ private:
 
     SdConfig config_;
     std::shared_ptr<transport::UdpTransport> transport_;
+    bool static_mode_;
+    StaticDiscoveryConfig static_config_;
 
     std::unordered_map<uint16_t, ServiceSubscription> service_subscriptions_;
     mutable std::mutex subscriptions_mutex_;
 
     std::vector<ServiceInstance> available_services_;
+    std::unordered_map<uint32_t, std::chrono::steady_clock::time_point> cached_deadlines_;  // Unconfirmed cached instances
+    SdCache cache_;
     mutable std::mutex available_services_mutex_;
 
     std::unordered_map<uint32_t, PendingFind> pending_finds_;
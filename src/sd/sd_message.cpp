@@ -82,7 +82,8 @@ std::vector<uint8_t> SdEntry::serialize() const {
 }
 
 bool SdEntry::deserialize(const std::vector<uint8_t>& data, size_t& offset) {
-    if (offset + 16 > data.size()) {
+    // Only the common fields; derived classes check the rest of the entry
+    if (offset + 5 > data.size()) {
         return false;
     }
 
@@ -99,16 +100,16 @@ bool SdEntry::deserialize(const std::vector<uint8_t>& data, size_t& offset) {
 std::vector<uint8_t> ServiceEntry::serialize() const {
     std::vector<uint8_t> data = SdEntry::serialize();
 
-    // Override the service ID field (bytes 4-5)
-    data[4] = (service_id_ >> 8) & 0xFF;
-    data[5] = service_id_ & 0xFF;
+    // Override the service ID field (bytes 5-6)
+    data[5] = (service_id_ >> 8) & 0xFF;
+    data[6] = service_id_ & 0xFF;
 
-    // Override the instance ID field (bytes 6-7)
-    data[6] = (instance_id_ >> 8) & 0xFF;
-    data[7] = instance_id_ & 0xFF;
+    // Override the instance ID field (bytes 7-8)
+    data[7] = (instance_id_ >> 8) & 0xFF;
+    data[8] = instance_id_ & 0xFF;
 
-    // Override the major version field (byte 8)
-    data[8] = major_version_;
+    // Override the major version field (byte 9)
+    data[9] = major_version_;
 
     return data;
 }
@@ -136,18 +137,18 @@ bool ServiceEntry::deserialize(const std::vector<uint8_t>& data, size_t& offset)
 std::vector<uint8_t> EventGroupEntry::serialize() const {
     std::vector<uint8_t> data = SdEntry::serialize();
 
-    // Override the service ID field (bytes 4-5)
-    data[4] = (service_id_ >> 8) & 0xFF;
-    data[5] = service_id_ & 0xFF;
+    // Override the service ID field (bytes 5-6)
+    data[5] = (service_id_ >> 8) & 0xFF;
+    data[6] = service_id_ & 0xFF;
 
-    // Override the instance ID field (bytes 6-7)
-    data[6] = (instance_id_ >> 8) & 0xFF;
-    data[7] = instance_id_ & 0xFF;
+    // Override the instance ID field (bytes 7-8)
+    data[7] = (instance_id_ >> 8) & 0xFF;
+    data[8] = instance_id_ & 0xFF;
 
-    // Override the major version field (byte 8)
-    data[8] = major_version_;
+    // Override the major version field (byte 9)
+    data[9] = major_version_;
 
-    // Event group ID (bytes 9-10)
+    // Event group ID (bytes 14-15)
     data.push_back((eventgroup_id_ >> 8) & 0xFF);
     data.push_back(eventgroup_id_ & 0xFF);
 
@@ -13,11 +13,13 @@
 
 #include "sd/sd_server.h"
 #include "sd/sd_message.h"
+#include "sd/static_discovery.h"
 #include "transport/udp_transport.h"
 #include "transport/endpoint.h"
 #include "transport/transport.h"
 #include "someip/message.h"
 #include <unordered_map>
+#include <condition_variable>
 #include <mutex>
 #include <atomic>
 #include <thread>
@@ -45,10 +47,18 @@ public:
         : config_(config),
           transport_(std::make_shared<transport::UdpTransport>(
               transport::Endpoint(config.unicast_address, config.unicast_port))),
+          static_mode_(!config.static_config_file.empty()),
           running_(false),
           next_offer_delay_(config.initial_delay) {
 
         transport_->set_listener(this);
+
+        // Only SD messages are handled here; drop all other traffic in the kernel
+        transport::MessageFilter sd_filter;
+        sd_filter.add_method(SOMEIP_SD_SERVICE_ID, SOMEIP_SD_METHOD_ID);
+        if (transport_->set_message_filter(sd_filter) != Result::SUCCESS) {
+            // Not critical - messages are still checked in on_message_received
+        }
     }
 
     ~SdServerImpl() {
@@ -60,19 +70,31 @@ public:
             return true;
         }
 
+        StaticDiscoveryConfig static_config;
+        if (static_mode_ && !load_static_discovery(config_.static_config_file, static_config)) {
+            return false;
+        }
+
         if (transport_->start() != Result::SUCCESS) {
             return false;
         }
 
-        // Join multicast group for SD messages
-        if (!join_multicast_group()) {
-            // Continue without multicast support in constrained environments
+        if (static_mode_) {
+            load_static_subscribers(static_config);
         }
 
         running_ = true;
 
-        // Start offer timer
-        start_offer_timer();
+        // Static mode announces nothing unless verification is enabled
+        if (dynamic_sd_enabled()) {
+            // Join multicast group for SD messages
+            if (!join_multicast_group()) {
+                // Continue without multicast support in constrained environments
+            }
+
+            // Start offer timer
+            start_offer_timer();
+        }
 
         return true;
     }
@@ -82,20 +104,28 @@ public:
             return;
         }
 
-        running_ = false;
-
         // Stop offer timer
         stop_offer_timer();
 
-        // Send stop offer messages for all services
-        send_stop_offer_messages();
+        if (dynamic_sd_enabled()) {
+            // Send stop offer messages for all services
+            send_stop_offer_messages();
+
+            // Leave multicast group
+            leave_multicast_group();
+        }
 
         // Clear offered services
-        std::scoped_lock lock(offered_services_mutex_);
-        offered_services_.clear();
+        {
+            std::scoped_lock lock(offered_services_mutex_);
+            offered_services_.clear();
+        }
 
-        // Leave multicast group
-        leave_multicast_group();
+        // Subscriptions do not survive a restart; static ones are reloaded by initialize()
+        {
+            std::scoped_lock lock(subscribers_mutex_);
+            subscribers_.clear();
+        }
 
         transport_->stop();
     }
@@ -138,7 +168,9 @@ public:
         offered_services_.push_back(std::move(offered));
 
         // Send initial offer immediately
-        send_service_offer(offered_services_.back());
+        if (dynamic_sd_enabled()) {
+            send_service_offer(offered_services_.back());
+        }
 
         return true;
     }
@@ -157,7 +189,9 @@ public:
         }
 
         // Send stop offer message
-        send_service_stop_offer(*it);
+        if (dynamic_sd_enabled()) {
+            send_service_stop_offer(*it);
+        }
 
         offered_services_.erase(it);
         return true;
@@ -183,6 +217,20 @@ public:
     bool handle_eventgroup_subscription(uint16_t service_id, uint16_t instance_id,
                                        uint16_t eventgroup_id, const std::string& client_address,
                                        bool acknowledge) {
+        return answer_subscription(service_id, instance_id, eventgroup_id, client_address, acknowledge,
+                                   std::chrono::steady_clock::time_point::max());
+    }
+
+    /**
+     * @brief Record an acknowledged subscription until expires and answer it
+     */
+    bool answer_subscription(uint16_t service_id, uint16_t instance_id, uint16_t eventgroup_id,
+                             const std::string& client_address, bool acknowledge,
+                             std::chrono::steady_clock::time_point expires) {
+
+        if (acknowledge) {
+            add_subscriber(service_id, instance_id, eventgroup_id, client_address, expires);
+        }
 
         // Create subscription response
         auto response_entry = std::make_unique<EventGroupEntry>(
@@ -243,6 +291,22 @@ public:
         return result;
     }
 
+    std::vector<std::string> get_eventgroup_subscribers(uint16_t service_id, uint16_t instance_id,
+                                                        uint16_t eventgroup_id) const {
+        std::scoped_lock lock(subscribers_mutex_);
+        std::vector<std::string> endpoints;
+        auto it = subscribers_.find(eventgroup_key(service_id, instance_id, eventgroup_id));
+        if (it != subscribers_.end()) {
+            auto now = std::chrono::steady_clock::now();
+            for (const auto& subscriber : it->second) {
+                if (subscriber.expires > now) {
+                    endpoints.push_back(subscriber.endpoint);
+                }
+            }
+        }
+        return endpoints;
+    }
+
     bool is_ready() const {
         return running_ && transport_->is_connected();
     }
@@ -253,6 +317,11 @@ public:
     }
 
 private:
+    struct Subscriber {
+        std::string endpoint;                           // "ip:port"
+        std::chrono::steady_clock::time_point expires;  // Subscription TTL; max() = never
+    };
+
     struct OfferedService {
         ServiceInstance instance;
         std::string unicast_endpoint;
@@ -260,6 +329,66 @@ private:
         std::chrono::steady_clock::time_point last_offer_time;
     };
 
+    static constexpr uint32_t SUBSCRIPTION_TTL_INFINITE = 0xFFFFFF;
+
+    bool dynamic_sd_enabled() const {
+        return !static_mode_ || config_.static_verification;
+    }
+
+    static uint64_t eventgroup_key(uint16_t service_id, uint16_t instance_id, uint16_t eventgroup_id) {
+        return (static_cast<uint64_t>(service_id) << 32) | (static_cast<uint64_t>(instance_id) << 16) |
+               eventgroup_id;
+    }
+
+    /**
+     * @brief Add or renew an event group member, dropping members whose TTL has run out
+     */
+    void add_subscriber(uint16_t service_id, uint16_t instance_id, uint16_t eventgroup_id,
+                        const std::string& endpoint, std::chrono::steady_clock::time_point expires) {
+        std::scoped_lock lock(subscribers_mutex_);
+        auto& members = subscribers_[eventgroup_key(service_id, instance_id, eventgroup_id)];
+        auto now = std::chrono::steady_clock::now();
+        members.erase(std::remove_if(members.begin(), members.end(),
+            [now, &endpoint](const Subscriber& member) {
+                return member.expires <= now && member.endpoint != endpoint;
+            }), members.end());
+
+        auto it = std::find_if(members.begin(), members.end(),
+            [&endpoint](const Subscriber& member) { return member.endpoint == endpoint; });
+        if (it == members.end()) {
+            members.push_back(Subscriber{endpoint, expires});
+        } else {
+            it->expires = expires;
+        }
+    }
+
+    void remove_subscriber(uint16_t service_id, uint16_t instance_id, uint16_t eventgroup_id,
+                           const std::string& endpoint) {
+        std::scoped_lock lock(subscribers_mutex_);
+        auto group = subscribers_.find(eventgroup_key(service_id, instance_id, eventgroup_id));
+        if (group == subscribers_.end()) {
+            return;
+        }
+        auto& members = group->second;
+        members.erase(std::remove_if(members.begin(), members.end(),
+            [&endpoint](const Subscriber& member) { return member.endpoint == endpoint; }), members.end());
+        if (members.empty()) {
+            subscribers_.erase(group);
+        }
+    }
+
+    void load_static_subscribers(const StaticDiscoveryConfig& static_config) {
+        for (const auto& service : static_config.services) {
+            for (const auto& eventgroup : service.eventgroups) {
+                for (const auto& subscriber : eventgroup.subscribers) {
+                    add_subscriber(service.instance.service_id, service.instance.instance_id,
+                                   eventgroup.eventgroup_id, subscriber,
+                                   std::chrono::steady_clock::time_point::max());
+                }
+            }
+        }
+    }
+
     bool join_multicast_group() {
         auto udp_transport = std::dynamic_pointer_cast<transport::UdpTransport>(transport_);
         if (!udp_transport) {
@@ -283,12 +412,10 @@ private:
         }
 
         offer_timer_thread_ = std::thread([this]() {
-            while (running_) {
-                std::this_thread::sleep_for(next_offer_delay_);
-
-                if (!running_) {
-                    break;
-                }
+            std::unique_lock lock(timer_mutex_);
+            // The delay can grow to repetition_max; shutdown() wakes the wait
+            while (!timer_cv_.wait_for(lock, next_offer_delay_, [this] { return !running_; })) {
+                lock.unlock();
 
                 // Send periodic offers
                 send_periodic_offers();
@@ -299,11 +426,19 @@ private:
                         std::min(next_offer_delay_.count() * config_.repetition_multiplier,
                                 config_.repetition_max.count()));
                 }
+
+                lock.lock();
             }
         });
     }
 
     void stop_offer_timer() {
+        {
+            std::scoped_lock lock(timer_mutex_);
+            running_ = false;
+        }
+        timer_cv_.notify_all();
+
         if (offer_timer_thread_.joinable()) {
             offer_timer_thread_.join();
         }
@@ -413,9 +548,13 @@ private:
             return;
         }
 
+        if (!dynamic_sd_enabled()) {
+            return;
+        }
+
         // Parse SD message
         SdMessage sd_message;
-        if (!sd_message.deserialize(message->get_payload())) {
+        if (!sd_message.deserialize(message->get_payload().to_vector())) {
             return;
         }
 
@@ -490,15 +629,28 @@ private:
             }
         }
 
+        std::string client_endpoint = client_ip + ":" + std::to_string(client_port);
+
+        // A StopSubscribeEventgroup is a subscription with TTL 0; it is not answered
+        uint32_t ttl = subscription_entry.get_ttl();
+        if (ttl == 0) {
+            remove_subscriber(subscription_entry.get_service_id(), subscription_entry.get_instance_id(),
+                              subscription_entry.get_eventgroup_id(), client_endpoint);
+            return;
+        }
+
         // TODO: Validate service and event group
         // For now, acknowledge all subscription requests
-
-        handle_eventgroup_subscription(
+        auto expires = ttl == SUBSCRIPTION_TTL_INFINITE
+            ? std::chrono::steady_clock::time_point::max()
+            : std::chrono::steady_clock::now() + std::chrono::seconds(ttl);
+        answer_subscription(
             subscription_entry.get_service_id(),
             subscription_entry.get_instance_id(),
             subscription_entry.get_eventgroup_id(),
-            client_ip + ":" + std::to_string(client_port),  // Pass full endpoint
-            true  // Acknowledge
+            client_endpoint,
+            true,  // Acknowledge
+            expires
         );
     }
 
@@ -556,10 +708,17 @@ private:
     SdConfig config_;
     std::shared_ptr<transport::UdpTransport> transport_;
 
+    bool static_mode_;
+
     std::vector<OfferedService> offered_services_;
     mutable std::mutex offered_services_mutex_;
 
+    std::unordered_map<uint64_t, std::vector<Subscriber>> subscribers_;  // Members by eventgroup
+    mutable std::mutex subscribers_mutex_;
+
     std::thread offer_timer_thread_;
+    std::mutex timer_mutex_;
+    std::condition_variable timer_cv_;
     std::chrono::milliseconds next_offer_delay_;
     std::atomic<bool> running_;
 };
@@ -604,6 +763,11 @@ std::vector<ServiceInstance> SdServer::get_offered_services() const {
     return impl_->get_offered_services();
 }
 
+std::vector<std::string> SdServer::get_eventgroup_subscribers(uint16_t service_id, uint16_t instance_id,
+                                                              uint16_t eventgroup_id) const {
+    return impl_->get_eventgroup_subscribers(service_id, instance_id, eventgroup_id);
+}
+
 bool SdServer::is_ready() const {
     return impl_->is_ready();
 }
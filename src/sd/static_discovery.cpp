@@ -0,0 +1,413 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "sd/static_discovery.h"
+#include <arpa/inet.h>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+namespace someip {
+namespace sd {
+
+namespace {
+
+/**
+ * @brief Parsed JSON value (just enough JSON for configuration files)
+ */
+struct JsonValue {
+    enum class Type : uint8_t { NUL, BOOL, NUMBER, STRING, ARRAY, OBJECT };
+
+    Type type{Type::NUL};
+    bool boolean{false};
+    double number{0};
+    std::string string;
+    std::vector<JsonValue> items;        // ARRAY elements, OBJECT member values
+    std::vector<std::string> keys;       // OBJECT member names
+
+    const JsonValue* get(const std::string& key) const {
+        for (size_t i = 0; i < keys.size(); ++i) {
+            if (keys[i] == key) {
+                return &items[i];
+            }
+        }
+        return nullptr;
+    }
+};
+
+class JsonParser {
+public:
+    explicit JsonParser(const std::string& text) : text_(text) {}
+
+    bool parse(JsonValue& value) {
+        if (!parse_value(value, 0)) {
+            return false;
+        }
+        skip_whitespace();
+        return pos_ == text_.size() || fail("trailing characters");
+    }
+
+    const std::string& error() const { return error_; }
+
+private:
+    static constexpr int MAX_DEPTH = 32;
+
+    bool fail(const std::string& what) {
+        if (error_.empty()) {
+            error_ = what + " at offset " + std::to_string(pos_);
+        }
+        return false;
+    }
+
+    void skip_whitespace() {
+        while (pos_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[pos_]))) {
+            pos_++;
+        }
+    }
+
+    bool consume(char expected) {
+        skip_whitespace();
+        if (pos_ < text_.size() && text_[pos_] == expected) {
+            pos_++;
+            return true;
+        }
+        return false;
+    }
+
+    bool parse_literal(const char* literal) {
+        std::string word(literal);
+        if (text_.compare(pos_, word.size(), word) != 0) {
+            return fail("invalid literal");
+        }
+        pos_ += word.size();
+        return true;
+    }
+
+    bool parse_value(JsonValue& value, int depth) {
+        if (depth > MAX_DEPTH) {
+            return fail("nesting too deep");
+        }
+        skip_whitespace();
+        if (pos_ >= text_.size()) {
+            return fail("unexpected end of input");
+        }
+
+        char c = text_[pos_];
+        if (c == '{') {
+            return parse_object(value, depth);
+        }
+        if (c == '[') {
+            return parse_array(value, depth);
+        }
+        if (c == '"') {
+            value.type = JsonValue::Type::STRING;
+            return parse_string(value.string);
+        }
+        if (c == 't' || c == 'f') {
+            value.type = JsonValue::Type::BOOL;
+            value.boolean = c == 't';
+            return parse_literal(value.boolean ? "true" : "false");
+        }
+        if (c == 'n') {
+            value.type = JsonValue::Type::NUL;
+            return parse_literal("null");
+        }
+        return parse_number(value);
+    }
+
+    bool parse_object(JsonValue& value, int depth) {
+        value.type = JsonValue::Type::OBJECT;
+        pos_++;  // '{'
+        if (consume('}')) {
+            return true;
+        }
+        do {
+            skip_whitespace();
+            std::string key;
+            if (pos_ >= text_.size() || text_[pos_] != '"' || !parse_string(key)) {
+                return fail("expected member name");
+            }
+            if (!consume(':')) {
+                return fail("expected ':'");
+            }
+            JsonValue member;
+            if (!parse_value(member, depth + 1)) {
+                return false;
+            }
+            value.keys.push_back(std::move(key));
+            value.items.push_back(std::move(member));
+        } while (consume(','));
+        return consume('}') || fail("expected '}'");
+    }
+
+    bool parse_array(JsonValue& value, int depth) {
+        value.type = JsonValue::Type::ARRAY;
+        pos_++;  // '['
+        if (consume(']')) {
+            return true;
+        }
+        do {
+            JsonValue item;
+            if (!parse_value(item, depth + 1)) {
+                return false;
+            }
+            value.items.push_back(std::move(item));
+        } while (consume(','));
+        return consume(']') || fail("expected ']'");
+    }
+
+    bool parse_string(std::string& out) {
+        pos_++;  // opening quote
+        while (pos_ < text_.size()) {
+            char c = text_[pos_++];
+            if (c == '"') {
+                return true;
+            }
+            if (c != '\\') {
+                out.push_back(c);
+                continue;
+            }
+            if (pos_ >= text_.size()) {
+                break;
+            }
+            switch (text_[pos_++]) {
+                case '"': out.push_back('"'); break;
+                case '\\': out.push_back('\\'); break;
+                case '/': out.push_back('/'); break;
+                case 'b': out.push_back('\b'); break;
+                case 'f': out.push_back('\f'); break;
+                case 'n': out.push_back('\n'); break;
+                case 'r': out.push_back('\r'); break;
+                case 't': out.push_back('\t'); break;
+                default: return fail("unsupported escape sequence");
+            }
+        }
+        return fail("unterminated string");
+    }
+
+    bool parse_number(JsonValue& value) {
+        const char* start = text_.c_str() + pos_;
+        char* end = nullptr;
+        double number = std::strtod(start, &end);
+        if (end == start) {
+            return fail("unexpected character");
+        }
+        pos_ += static_cast<size_t>(end - start);
+        value.type = JsonValue::Type::NUMBER;
+        value.number = number;
+        return true;
+    }
+
+    const std::string& text_;
+    size_t pos_{0};
+    std::string error_;
+};
+
+/**
+ * @brief Read an unsigned integer given as a JSON number or a "0x..." / decimal string
+ */
+bool get_uint(const JsonValue* value, uint64_t max, uint64_t& out) {
+    if (value == nullptr) {
+        return false;
+    }
+    if (value->type == JsonValue::Type::NUMBER) {
+        if (value->number < 0 || value->number != std::floor(value->number) ||
+            value->number > static_cast<double>(max)) {
+            return false;
+        }
+        out = static_cast<uint64_t>(value->number);
+        return true;
+    }
+    if (value->type == JsonValue::Type::STRING && !value->string.empty() &&
+        std::isdigit(static_cast<unsigned char>(value->string[0]))) {
+        char* end = nullptr;
+        unsigned long long parsed = std::strtoull(value->string.c_str(), &end, 0);
+        if (*end != '\0' || parsed > max) {
+            return false;
+        }
+        out = parsed;
+        return true;
+    }
+    return false;
+}
+
+template <typename T>
+bool read_field(const JsonValue& object, const char* key, T& field, bool required,
+                std::string& error) {
+    const JsonValue* value = object.get(key);
+    if (value == nullptr && !required) {
+        return true;
+    }
+    uint64_t parsed = 0;
+    if (!get_uint(value, std::numeric_limits<T>::max(), parsed)) {
+        error = std::string(value == nullptr ? "missing " : "invalid ") + key;
+        return false;
+    }
+    field = static_cast<T>(parsed);
+    return true;
+}
+
+bool read_service(const JsonValue& object, StaticService& service, std::string& error) {
+    if (object.type != JsonValue::Type::OBJECT) {
+        error = "service entry is not an object";
+        return false;
+    }
+
+    ServiceInstance& instance = service.instance;
+    instance.ttl_seconds = 0xFFFFFF;  // Longest TTL an SD entry can carry
+    if (!read_field(object, "service_id", instance.service_id, true, error) ||
+        !read_field(object, "instance_id", instance.instance_id, true, error) ||
+        !read_field(object, "major_version", instance.major_version, false, error) ||
+        !read_field(object, "minor_version", instance.minor_version, false, error) ||
+        !read_field(object, "port", instance.port, true, error) ||
+        !read_field(object, "ttl", instance.ttl_seconds, false, error)) {
+        return false;
+    }
+
+    const JsonValue* address = object.get("address");
+    in_addr parsed_address{};
+    if (address == nullptr || address->type != JsonValue::Type::STRING ||
+        inet_pton(AF_INET, address->string.c_str(), &parsed_address) != 1) {
+        error = "missing or invalid address";
+        return false;
+    }
+    instance.ip_address = address->string;
+
+    const JsonValue* protocol = object.get("protocol");
+    if (protocol != nullptr) {
+        if (protocol->type == JsonValue::Type::STRING && protocol->string == "udp") {
+            instance.protocol = 0x11;
+        } else if (protocol->type == JsonValue::Type::STRING && protocol->string == "tcp") {
+            instance.protocol = 0x06;
+        } else {
+            error = "protocol must be \"udp\" or \"tcp\"";
+            return false;
+        }
+    }
+
+    const JsonValue* eventgroups = object.get("eventgroups");
+    if (eventgroups == nullptr) {
+        return true;
+    }
+    if (eventgroups->type != JsonValue::Type::ARRAY) {
+        error = "eventgroups is not an array";
+        return false;
+    }
+    for (const auto& group : eventgroups->items) {
+        StaticEventGroup eventgroup;
+        if (group.type != JsonValue::Type::OBJECT ||
+            !read_field(group, "eventgroup_id", eventgroup.eventgroup_id, true, error)) {
+            if (error.empty()) {
+                error = "eventgroup entry is not an object";
+            }
+            return false;
+        }
+        const JsonValue* subscribers = group.get("subscribers");
+        if (subscribers != nullptr) {
+            if (subscribers->type != JsonValue::Type::ARRAY) {
+                error = "subscribers is not an array";
+                return false;
+            }
+            for (const auto& subscriber : subscribers->items) {
+                if (subscriber.type != JsonValue::Type::STRING ||
+                    subscriber.string.find(':') == std::string::npos) {
+                    error = "subscriber must be an \"ip:port\" string";
+                    return false;
+                }
+                eventgroup.subscribers.push_back(subscriber.string);
+            }
+        }
+        service.eventgroups.push_back(std::move(eventgroup));
+    }
+    return true;
+}
+
+} // namespace
+
+const StaticService* StaticDiscoveryConfig::find(uint16_t service_id, uint16_t instance_id) const {
+    for (const auto& service : services) {
+        if (service.instance.service_id == service_id && service.instance.instance_id == instance_id) {
+            return &service;
+        }
+    }
+    return nullptr;
+}
+
+const StaticEventGroup* StaticDiscoveryConfig::find_eventgroup(uint16_t service_id, uint16_t instance_id,
+                                                               uint16_t eventgroup_id) const {
+    const StaticService* service = find(service_id, instance_id);
+    if (service == nullptr) {
+        return nullptr;
+    }
+    for (const auto& eventgroup : service->eventgroups) {
+        if (eventgroup.eventgroup_id == eventgroup_id) {
+            return &eventgroup;
+        }
+    }
+    return nullptr;
+}
+
+bool parse_static_discovery(const std::string& json, StaticDiscoveryConfig& config, std::string* error) {
+    std::string problem;
+    JsonValue root;
+    JsonParser parser(json);
+
+    StaticDiscoveryConfig parsed;
+    if (!parser.parse(root)) {
+        problem = parser.error();
+    } else if (root.type != JsonValue::Type::OBJECT || root.get("services") == nullptr ||
+               root.get("services")->type != JsonValue::Type::ARRAY) {
+        problem = "expected an object with a \"services\" array";
+    } else {
+        for (const auto& entry : root.get("services")->items) {
+            StaticService service;
+            if (!read_service(entry, service, problem)) {
+                problem = "service " + std::to_string(parsed.services.size()) + ": " + problem;
+                break;
+            }
+            if (parsed.find(service.instance.service_id, service.instance.instance_id) != nullptr) {
+                problem = "duplicate service instance";
+                break;
+            }
+            parsed.services.push_back(std::move(service));
+        }
+    }
+
+    if (!problem.empty()) {
+        if (error != nullptr) {
+            *error = problem;
+        }
+        return false;
+    }
+    config = std::move(parsed);
+    return true;
+}
+
+bool load_static_discovery(const std::string& path, StaticDiscoveryConfig& config, std::string* error) {
+    std::ifstream file(path);
+    if (!file) {
+        if (error != nullptr) {
+            *error = "cannot open " + path;
+        }
+        return false;
+    }
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return parse_static_discovery(contents.str(), config, error);
+}
+
+} // namespace sd
+} // namespace someip
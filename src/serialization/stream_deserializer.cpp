@@ -0,0 +1,194 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "serialization/stream_deserializer.h"
+#include <algorithm>
+#include <cstring>
+
+namespace someip {
+namespace serialization {
+
+void StreamDeserializer::append(std::vector<uint8_t>&& chunk) {
+    if (chunk.empty()) {
+        return;
+    }
+    available_ += chunk.size();
+    chunks_.push_back(std::move(chunk));
+}
+
+void StreamDeserializer::append(const uint8_t* data, size_t size) {
+    append(std::vector<uint8_t>(data, data + size));
+}
+
+const uint8_t* StreamDeserializer::contiguous(size_t size) const {
+    if (chunk_index_ >= chunks_.size()) {
+        return nullptr;
+    }
+    const auto& chunk = chunks_[chunk_index_];
+    return chunk.size() - chunk_offset_ >= size ? chunk.data() + chunk_offset_ : nullptr;
+}
+
+void StreamDeserializer::advance(size_t size) {
+    position_ += size;
+    available_ -= size;
+    chunk_offset_ += size;
+    while (chunk_index_ < chunks_.size() && chunk_offset_ >= chunks_[chunk_index_].size()) {
+        chunk_offset_ -= chunks_[chunk_index_].size();
+        ++chunk_index_;
+    }
+    drop_read_chunks();
+}
+
+void StreamDeserializer::drop_read_chunks() {
+    if (saved_) {
+        return;
+    }
+    while (chunk_index_ > 0) {
+        chunks_start_ += chunks_.front().size();
+        chunks_.pop_front();
+        --chunk_index_;
+    }
+}
+
+Result StreamDeserializer::read_bytes(uint8_t* out, size_t size) {
+    if (available_ < size) {
+        return missing();
+    }
+    while (size > 0) {
+        const auto& chunk = chunks_[chunk_index_];
+        size_t count = std::min(size, chunk.size() - chunk_offset_);
+        std::memcpy(out, chunk.data() + chunk_offset_, count);
+        out += count;
+        size -= count;
+        advance(count);
+    }
+    return Result::SUCCESS;
+}
+
+Result StreamDeserializer::skip(size_t bytes) {
+    if (available_ < bytes) {
+        return missing();
+    }
+    advance(bytes);
+    return Result::SUCCESS;
+}
+
+Result StreamDeserializer::align_to(size_t alignment) {
+    size_t padding = (alignment - (position_ % alignment)) % alignment;
+    if (available_ < padding && finished_) {
+        // Padding after the last value may be cut off
+        padding = available_;
+    }
+    return skip(padding);
+}
+
+StreamDeserializer::Checkpoint StreamDeserializer::save() {
+    saved_ = true;
+    return Checkpoint{position_};
+}
+
+void StreamDeserializer::restore(const Checkpoint& checkpoint) {
+    available_ += position_ - checkpoint.position;
+    position_ = checkpoint.position;
+    chunk_index_ = 0;
+    chunk_offset_ = position_ - chunks_start_;
+    while (chunk_index_ < chunks_.size() && chunk_offset_ >= chunks_[chunk_index_].size()) {
+        chunk_offset_ -= chunks_[chunk_index_].size();
+        ++chunk_index_;
+    }
+}
+
+void StreamDeserializer::release() {
+    saved_ = false;
+    drop_read_chunks();
+}
+
+DeserializationResult<bool> StreamDeserializer::deserialize_bool() {
+    return read_value<bool>();
+}
+
+DeserializationResult<uint8_t> StreamDeserializer::deserialize_uint8() {
+    return read_value<uint8_t>();
+}
+
+DeserializationResult<uint16_t> StreamDeserializer::deserialize_uint16() {
+    return read_value<uint16_t>();
+}
+
+DeserializationResult<uint32_t> StreamDeserializer::deserialize_uint32() {
+    return read_value<uint32_t>();
+}
+
+DeserializationResult<uint64_t> StreamDeserializer::deserialize_uint64() {
+    return read_value<uint64_t>();
+}
+
+DeserializationResult<int8_t> StreamDeserializer::deserialize_int8() {
+    return read_value<int8_t>();
+}
+
+DeserializationResult<int16_t> StreamDeserializer::deserialize_int16() {
+    return read_value<int16_t>();
+}
+
+DeserializationResult<int32_t> StreamDeserializer::deserialize_int32() {
+    return read_value<int32_t>();
+}
+
+DeserializationResult<int64_t> StreamDeserializer::deserialize_int64() {
+    return read_value<int64_t>();
+}
+
+DeserializationResult<float> StreamDeserializer::deserialize_float() {
+    return read_value<float>();
+}
+
+DeserializationResult<double> StreamDeserializer::deserialize_double() {
+    return read_value<double>();
+}
+
+DeserializationResult<std::string> StreamDeserializer::deserialize_string() {
+    if (available_ < sizeof(uint32_t)) {
+        return DeserializationResult<std::string>::error(missing());
+    }
+
+    // Peek at the length so that nothing is consumed unless the whole string has arrived
+    uint8_t length_bytes[sizeof(uint32_t)];
+    size_t peek_index = chunk_index_;
+    size_t peek_offset = chunk_offset_;
+    for (uint8_t& byte : length_bytes) {
+        while (peek_offset >= chunks_[peek_index].size()) {
+            peek_offset -= chunks_[peek_index].size();
+            ++peek_index;
+        }
+        byte = chunks_[peek_index][peek_offset++];
+    }
+    uint32_t length = 0;
+    wire::Codec<uint32_t>::decode_fixed(length_bytes, length);
+
+    size_t end = position_ + sizeof(uint32_t) + length;
+    size_t padded = wire::pad4(end);
+    size_t needed = (finished_ ? end : padded) - position_;
+    if (available_ < needed) {
+        return DeserializationResult<std::string>::error(missing());
+    }
+
+    advance(sizeof(uint32_t));
+    std::string value(length, '\0');
+    read_bytes(reinterpret_cast<uint8_t*>(value.data()), length);
+    align_to(4);
+    return DeserializationResult<std::string>::success(std::move(value));
+}
+
+} // namespace serialization
+} // namespace someip
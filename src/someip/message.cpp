@@ -189,7 +189,7 @@ std::vector<uint8_t> Message::serialize() const {
     }
 
     // Append payload
-    data.insert(data.end(), payload_.begin(), payload_.end());
+    data.insert(data.end(), payload_.data(), payload_.data() + payload_.size());
 
     return data;
 }
@@ -330,7 +330,7 @@ bool Message::deserialize(const std::vector<uint8_t>& data) {
     }
 
     // Copy payload
-    payload_.assign(data.begin() + offset, data.end());
+    payload_.assign(data.data() + offset, data.size() - offset);
 
     // Update timestamp
     update_timestamp();
@@ -459,6 +459,8 @@ bool Message::has_valid_message_type() const {
         case MessageType::TP_REQUEST:        // TP variants also valid
         case MessageType::TP_REQUEST_NO_RETURN:
         case MessageType::TP_NOTIFICATION:
+        case MessageType::TP_RESPONSE:
+        case MessageType::TP_ERROR:
             return true;
         default:
             return false;
@@ -0,0 +1,131 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "someip/payload.h"
+#include <algorithm>
+#include <cstring>
+
+namespace someip {
+
+PayloadView PayloadView::subview(size_t offset, size_t count) const noexcept {
+    if (offset >= size_) {
+        return PayloadView(data_ + size_, 0);
+    }
+    return PayloadView(data_ + offset, std::min(count, size_ - offset));
+}
+
+bool operator==(PayloadView lhs, PayloadView rhs) noexcept {
+    return lhs.size() == rhs.size() &&
+           (lhs.size() == 0 || std::memcmp(lhs.data(), rhs.data(), lhs.size()) == 0);
+}
+
+Payload::Payload(const uint8_t* data, size_t size) {
+    assign(data, size);
+}
+
+Payload::Payload(std::vector<uint8_t>&& data) {
+    assign(std::move(data));
+}
+
+Payload::Payload(const Payload& other)
+    : heap_(other.heap_),
+      size_(other.size_),
+      is_inline_(other.is_inline_) {
+    if (is_inline_) {
+        std::memcpy(inline_.data(), other.inline_.data(), size_);
+    }
+}
+
+Payload::Payload(Payload&& other) noexcept
+    : heap_(std::move(other.heap_)),
+      size_(other.size_),
+      is_inline_(other.is_inline_) {
+    if (is_inline_) {
+        std::memcpy(inline_.data(), other.inline_.data(), size_);
+    }
+    other.clear();
+}
+
+Payload& Payload::operator=(const Payload& other) {
+    if (this != &other) {
+        heap_ = other.heap_;
+        size_ = other.size_;
+        is_inline_ = other.is_inline_;
+        if (is_inline_) {
+            std::memcpy(inline_.data(), other.inline_.data(), size_);
+        }
+    }
+    return *this;
+}
+
+Payload& Payload::operator=(Payload&& other) noexcept {
+    if (this != &other) {
+        heap_ = std::move(other.heap_);
+        size_ = other.size_;
+        is_inline_ = other.is_inline_;
+        if (is_inline_) {
+            std::memcpy(inline_.data(), other.inline_.data(), size_);
+        }
+        other.clear();
+    }
+    return *this;
+}
+
+/**
+ * @brief Copy bytes into the payload, inline when they fit
+ */
+void Payload::assign(const uint8_t* data, size_t size) {
+    if (size <= INLINE_CAPACITY) {
+        if (size > 0) {
+            std::memmove(inline_.data(), data, size);
+        }
+        heap_.reset();
+        is_inline_ = true;
+    } else {
+        // Build the new buffer before releasing the old one, data may point into it
+        heap_ = std::make_shared<std::vector<uint8_t>>(data, data + size);
+        is_inline_ = false;
+    }
+    size_ = size;
+}
+
+/**
+ * @brief Take over a vector, adopting its buffer when it does not fit inline
+ */
+void Payload::assign(std::vector<uint8_t>&& data) {
+    if (data.size() <= INLINE_CAPACITY) {
+        assign(data.data(), data.size());
+        return;
+    }
+    heap_ = std::make_shared<std::vector<uint8_t>>(std::move(data));
+    size_ = heap_->size();
+    is_inline_ = false;
+}
+
+uint8_t* Payload::mutable_data() {
+    if (is_inline_) {
+        return inline_.data();
+    }
+    if (heap_.use_count() > 1) {
+        heap_ = std::make_shared<std::vector<uint8_t>>(*heap_);
+    }
+    return heap_->data();
+}
+
+void Payload::clear() noexcept {
+    heap_.reset();
+    size_ = 0;
+    is_inline_ = true;
+}
+
+} // namespace someip
@@ -35,7 +35,9 @@ std::string to_string(MessageType type) {
         {MessageType::ERROR_ACK, "ERROR_ACK"},
         {MessageType::TP_REQUEST, "TP_REQUEST"},
         {MessageType::TP_REQUEST_NO_RETURN, "TP_REQUEST_NO_RETURN"},
-        {MessageType::TP_NOTIFICATION, "TP_NOTIFICATION"}
+        {MessageType::TP_NOTIFICATION, "TP_NOTIFICATION"},
+        {MessageType::TP_RESPONSE, "TP_RESPONSE"},
+        {MessageType::TP_ERROR, "TP_ERROR"}
     };
 
     auto it = type_strings.find(type);
@@ -83,7 +85,9 @@ bool is_response(MessageType type) {
 bool uses_tp(MessageType type) {
     return type == MessageType::TP_REQUEST ||
            type == MessageType::TP_REQUEST_NO_RETURN ||
-           type == MessageType::TP_NOTIFICATION;
+           type == MessageType::TP_NOTIFICATION ||
+           type == MessageType::TP_RESPONSE ||
+           type == MessageType::TP_ERROR;
 }
 
 MessageType get_ack_type(MessageType type) {
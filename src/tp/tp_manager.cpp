@@ -189,6 +189,10 @@ void TpManager::set_message_callback(TpMessageCallback callback) {
     message_callback_ = std::move(callback);
 }
 
+void TpManager::set_stream_callback(TpStreamCallback callback) {
+    reassembler_->set_stream_callback(std::move(callback));
+}
+
 void TpManager::process_timeouts() {
     std::scoped_lock lock(transfers_mutex_);
 
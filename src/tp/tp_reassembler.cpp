@@ -38,6 +38,7 @@ TpReassembler::TpReassembler(const TpConfig& config)
 TpReassembler::~TpReassembler() {
     std::scoped_lock lock(buffers_mutex_);
     reassembly_buffers_.clear();
+    streams_.clear();
 }
 
 /**
@@ -86,6 +87,10 @@ bool TpReassembler::process_segment(const TpSegment& segment, std::vector<uint8_
 
     std::scoped_lock lock(buffers_mutex_);
 
+    if (stream_callback_) {
+        return stream_segment(segment);
+    }
+
     TpReassemblyBuffer* buffer = find_or_create_buffer(segment);
     if (!buffer) {
         return false;
@@ -239,15 +244,113 @@ bool TpReassembler::add_segment_to_buffer(TpReassemblyBuffer& buffer, const TpSe
     return true;
 }
 
+/**
+ * @brief Pass a segment's data on in message order
+ */
+bool TpReassembler::stream_segment(const TpSegment& segment) {
+    size_t header_overhead = 4;  // TP header only for consecutive/last segments
+    if (segment.header.message_type == TpMessageType::FIRST_SEGMENT) {
+        header_overhead = 16 + 4;  // SOME/IP header + TP header
+    } else if (segment.header.message_type == TpMessageType::SINGLE_MESSAGE) {
+        header_overhead = 16;  // SOME/IP header only
+    }
+    auto data_begin = segment.payload.begin() + std::min(header_overhead, segment.payload.size());
+
+    auto it = streams_.find(segment.header.sequence_number);
+    if (it == streams_.end()) {
+        if (segment.header.message_type != TpMessageType::FIRST_SEGMENT &&
+            segment.header.message_type != TpMessageType::SINGLE_MESSAGE) {
+            return false;  // Consecutive/last segment without first segment
+        }
+        it = streams_.emplace(segment.header.sequence_number,
+                              TpStreamState(segment.header.sequence_number, segment.header.message_length)).first;
+    }
+    TpStreamState& stream = it->second;
+
+    // Offsets are 16 bits wide, so compare them modulo 2^16; segments up to
+    // half that range behind the delivered bytes are duplicates
+    auto distance = static_cast<uint16_t>(segment.header.segment_offset - static_cast<uint16_t>(stream.delivered));
+    if (distance >= 0x8000) {
+        return true;
+    }
+    auto size = static_cast<size_t>(segment.payload.end() - data_begin);
+    if (stream.total_length - stream.delivered < distance + size) {
+        abort_stream(it, TpResult::INVALID_SEGMENT);  // Segment exceeds message bounds
+        return false;
+    }
+    if (distance > 0) {
+        if (stream.pending.count(segment.header.segment_offset) == 0) {
+            if (stream.pending_bytes + size > get_config_copy().max_stream_pending) {
+                abort_stream(it, TpResult::RESOURCE_EXHAUSTED);
+                return false;
+            }
+            stream.pending_bytes += size;
+            stream.pending.emplace(segment.header.segment_offset,
+                                   std::vector<uint8_t>(data_begin, segment.payload.end()));
+        }
+        return true;
+    }
+
+    std::vector<uint8_t> data(data_begin, segment.payload.end());
+    while (true) {
+        if (stream.total_length - stream.delivered < data.size()) {
+            abort_stream(it, TpResult::INVALID_SEGMENT);  // Held segment overlaps the message end
+            return false;
+        }
+        stream.delivered += static_cast<uint32_t>(data.size());
+        bool last = stream.delivered == stream.total_length;
+        if (!data.empty() || last) {
+            stream_callback_(stream.message_id, TpResult::SUCCESS, std::move(data), last);
+        }
+        if (last) {
+            streams_.erase(it);
+            return true;
+        }
+
+        auto next = stream.pending.find(static_cast<uint16_t>(stream.delivered));
+        if (next == stream.pending.end()) {
+            return true;
+        }
+        data = std::move(next->second);
+        stream.pending_bytes -= data.size();
+        stream.pending.erase(next);
+    }
+}
+
+/**
+ * @brief Drop a stream and report it abandoned
+ */
+void TpReassembler::abort_stream(std::unordered_map<uint32_t, TpStreamState>::iterator it, TpResult result) {
+    uint32_t message_id = it->first;
+    streams_.erase(it);
+    stream_callback_(message_id, result, {}, true);
+}
+
+void TpReassembler::set_stream_callback(TpStreamCallback callback) {
+    std::scoped_lock lock(buffers_mutex_);
+    stream_callback_ = std::move(callback);
+}
+
 bool TpReassembler::is_reassembling(uint32_t message_id) const {
     std::scoped_lock lock(buffers_mutex_);
-    return reassembly_buffers_.find(message_id) != reassembly_buffers_.end();
+    return reassembly_buffers_.find(message_id) != reassembly_buffers_.end() ||
+           streams_.find(message_id) != streams_.end();
 }
 
 bool TpReassembler::get_reassembly_progress(uint32_t message_id, uint32_t& received_bytes, uint32_t& total_bytes) const {
     const auto config = get_config_copy();
 
     std::scoped_lock lock(buffers_mutex_);
+    auto stream = streams_.find(message_id);
+    if (stream != streams_.end()) {
+        total_bytes = stream->second.total_length;
+        received_bytes = stream->second.delivered;
+        for (const auto& [offset, data] : stream->second.pending) {
+            received_bytes += static_cast<uint32_t>(data.size());
+        }
+        return true;
+    }
+
     auto it = reassembly_buffers_.find(message_id);
 
     if (it == reassembly_buffers_.end()) {
@@ -276,6 +379,7 @@ bool TpReassembler::get_reassembly_progress(uint32_t message_id, uint32_t& recei
 void TpReassembler::cancel_reassembly(uint32_t message_id) {
     std::scoped_lock lock(buffers_mutex_);
     reassembly_buffers_.erase(message_id);
+    streams_.erase(message_id);
 }
 
 void TpReassembler::process_timeouts() {
@@ -288,7 +392,7 @@ void TpReassembler::process_timeouts() {
 
 size_t TpReassembler::get_active_reassemblies() const {
     std::scoped_lock lock(buffers_mutex_);
-    return reassembly_buffers_.size();
+    return reassembly_buffers_.size() + streams_.size();
 }
 
 void TpReassembler::update_config(const TpConfig& config) {
@@ -313,6 +417,17 @@ void TpReassembler::cleanup_timed_out_buffers(const TpConfig& config) {
             ++it;
         }
     }
+
+    for (auto it = streams_.begin(); it != streams_.end(); ) {
+        if (now - it->second.start_time > config.reassembly_timeout) {
+            if (stream_callback_) {
+                stream_callback_(it->first, TpResult::REASSEMBLY_TIMEOUT, {}, true);
+            }
+            it = streams_.erase(it);
+        } else {
+            ++it;
+        }
+    }
 }
 
 TpConfig TpReassembler::get_config_copy() const {
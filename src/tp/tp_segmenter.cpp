@@ -49,7 +49,7 @@ TpSegmenter::~TpSegmenter() = default;
  */
 TpResult TpSegmenter::segment_message(const Message& message, std::vector<TpSegment>& segments) {
     // Get the message payload (without headers - TP handles payload only)
-    const std::vector<uint8_t>& payload = message.get_payload();
+    PayloadView payload = message.get_payload();
 
     if (payload.size() > config_.max_message_size) {
         return TpResult::MESSAGE_TOO_LARGE;
@@ -91,7 +91,7 @@ TpResult TpSegmenter::segment_message(const Message& message, std::vector<TpSegm
  * @implements REQ_TP_001_E02, REQ_TP_001_E03, REQ_TP_013_E01, REQ_TP_015_E01
  */
 TpResult TpSegmenter::create_multi_segments(const Message& message,
-                                          const std::vector<uint8_t>& payload,
+                                          PayloadView payload,
                                           std::vector<TpSegment>& segments) {
 
     uint32_t total_length = static_cast<uint32_t>(payload.size());
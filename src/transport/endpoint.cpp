@@ -134,8 +134,8 @@ size_t Endpoint::Hash::operator()(const Endpoint& endpoint) const {
 }
 
 bool Endpoint::is_valid_ipv4(const std::string& address) const {
-    // Basic IPv4 validation regex
-    std::regex ipv4_pattern(R"(^(\d{1,3})\.(\d{1,3})\.(\d{1,3})\.(\d{1,3})$)");
+    // Basic IPv4 validation regex (compiled once; endpoints are validated on every send)
+    static const std::regex ipv4_pattern(R"(^(\d{1,3})\.(\d{1,3})\.(\d{1,3})\.(\d{1,3})$)");
     std::smatch match;
 
     if (!std::regex_match(address, match, ipv4_pattern)) {
@@ -160,7 +160,7 @@ bool Endpoint::is_valid_ipv6(const std::string& address) const {
     }
 
     // Check for valid IPv6 characters and structure
-    std::regex ipv6_pattern(R"(^([0-9a-fA-F]{1,4}:){7}[0-9a-fA-F]{1,4}$|^::([0-9a-fA-F]{1,4}:){0,6}[0-9a-fA-F]{1,4}$|^([0-9a-fA-F]{1,4}:){1,7}:$|^::$)");
+    static const std::regex ipv6_pattern(R"(^([0-9a-fA-F]{1,4}:){7}[0-9a-fA-F]{1,4}$|^::([0-9a-fA-F]{1,4}:){0,6}[0-9a-fA-F]{1,4}$|^([0-9a-fA-F]{1,4}:){1,7}:$|^::$)");
 
     return std::regex_match(address, ipv6_pattern);
 }
@@ -0,0 +1,308 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "transport/impaired_transport.h"
+#include <algorithm>
+
+namespace someip {
+namespace transport {
+
+namespace {
+
+constexpr size_t SOMEIP_HEADER_SIZE = 8;  // Message ID and length; the length field covers the rest
+
+// Inbound decisions use their own stream so outbound traffic does not shift them
+constexpr uint64_t INBOUND_SEED_OFFSET = 0x9E3779B97F4A7C15ULL;
+
+bool chance(std::mt19937_64& random, double probability) {
+    if (probability <= 0.0) {
+        return false;
+    }
+    return std::uniform_real_distribution<double>(0.0, 1.0)(random) < probability;
+}
+
+} // namespace
+
+void ImpairedTransport::InboundListener::on_message_received(MessagePtr message, const Endpoint& sender) {
+    owner_.on_inbound(std::move(message), sender);
+}
+
+void ImpairedTransport::InboundListener::on_connection_lost(const Endpoint& endpoint) {
+    ITransportListener* listener = owner_.listener_.load();
+    if (listener != nullptr) {
+        listener->on_connection_lost(endpoint);
+    }
+}
+
+void ImpairedTransport::InboundListener::on_connection_established(const Endpoint& endpoint) {
+    ITransportListener* listener = owner_.listener_.load();
+    if (listener != nullptr) {
+        listener->on_connection_established(endpoint);
+    }
+}
+
+void ImpairedTransport::InboundListener::on_error(Result error) {
+    ITransportListener* listener = owner_.listener_.load();
+    if (listener != nullptr) {
+        listener->on_error(error);
+    }
+}
+
+ImpairedTransport::ImpairedTransport(std::shared_ptr<ITransport> transport, const ImpairedTransportConfig& config)
+    : transport_(std::move(transport)), inbound_listener_(*this) {
+    outbound_.profile = config.outbound;
+    outbound_.random.seed(config.seed);
+    inbound_.profile = config.inbound;
+    inbound_.random.seed(config.seed + INBOUND_SEED_OFFSET);
+    transport_->set_listener(&inbound_listener_);
+}
+
+ImpairedTransport::~ImpairedTransport() {
+    (void)stop();
+    transport_->set_listener(nullptr);
+}
+
+void ImpairedTransport::set_outbound_profile(const ImpairmentProfile& profile) {
+    std::scoped_lock lock(mutex_);
+    outbound_.profile = profile;
+    outbound_.in_loss_burst = false;
+}
+
+void ImpairedTransport::set_inbound_profile(const ImpairmentProfile& profile) {
+    std::scoped_lock lock(mutex_);
+    inbound_.profile = profile;
+    inbound_.in_loss_burst = false;
+}
+
+ImpairmentStatistics ImpairedTransport::get_outbound_statistics() const {
+    std::scoped_lock lock(mutex_);
+    return outbound_.statistics;
+}
+
+ImpairmentStatistics ImpairedTransport::get_inbound_statistics() const {
+    std::scoped_lock lock(mutex_);
+    return inbound_.statistics;
+}
+
+std::vector<ImpairedTransport::Clock::time_point> ImpairedTransport::impair(Direction& direction, size_t size,
+                                                                            Clock::time_point now) {
+    const ImpairmentProfile& profile = direction.profile;
+    std::vector<Clock::time_point> releases;
+
+    // A burst goes on with probability 1 - 1/burst_length; otherwise a new one may start
+    double burst_continues = 1.0 - 1.0 / std::max(profile.burst_length, 1.0);
+    direction.in_loss_burst = (direction.in_loss_burst && chance(direction.random, burst_continues)) ||
+                              chance(direction.random, profile.loss);
+    if (direction.in_loss_burst) {
+        direction.statistics.lost++;
+        return releases;
+    }
+
+    size_t copies = 1;
+    if (chance(direction.random, profile.duplicate)) {
+        copies = 2;
+        direction.statistics.duplicated++;
+    }
+
+    for (size_t copy = 0; copy < copies; ++copy) {
+        if (in_flight_.size() + releases.size() >= profile.queue_limit) {
+            direction.statistics.overflowed++;
+            continue;
+        }
+
+        Clock::time_point departure = now;
+        if (profile.rate_bps > 0) {
+            auto transmission = std::chrono::nanoseconds(
+                static_cast<int64_t>(static_cast<double>(size) * 8e9 / static_cast<double>(profile.rate_bps)));
+            departure = std::max(now, direction.link_free) + transmission;
+            direction.link_free = departure;
+        }
+
+        if (chance(direction.random, profile.reorder)) {
+            direction.statistics.reordered++;
+            releases.push_back(departure);
+        } else {
+            releases.push_back(sample_arrival(direction, departure));
+        }
+    }
+    return releases;
+}
+
+ImpairedTransport::Clock::time_point ImpairedTransport::sample_arrival(Direction& direction,
+                                                                       Clock::time_point departure) {
+    const ImpairmentProfile& profile = direction.profile;
+    double delay_us = static_cast<double>(profile.delay.count());
+    if (profile.jitter.count() > 0) {
+        double jitter_us = static_cast<double>(profile.jitter.count());
+        if (profile.distribution == DelayDistribution::NORMAL) {
+            delay_us = std::normal_distribution<double>(delay_us, jitter_us)(direction.random);
+        } else {
+            delay_us += std::uniform_real_distribution<double>(-jitter_us, jitter_us)(direction.random);
+        }
+    }
+    return departure + std::chrono::microseconds(static_cast<int64_t>(std::max(delay_us, 0.0)));
+}
+
+Result ImpairedTransport::send_message(const Message& message, const Endpoint& endpoint) {
+    std::unique_lock lock(mutex_);
+    if (!scheduling_) {
+        // Not started: nothing would release delayed messages
+        lock.unlock();
+        return transport_->send_message(message, endpoint);
+    }
+
+    auto now = Clock::now();
+    auto releases = impair(outbound_, SOMEIP_HEADER_SIZE + message.get_length(), now);
+    if (releases.size() == 1 && releases[0] <= now && in_flight_.empty()) {
+        // Nothing to wait for and nothing to overtake: send on the caller's thread
+        outbound_.statistics.delivered++;
+        lock.unlock();
+        return transport_->send_message(message, endpoint);
+    }
+
+    if (!releases.empty()) {
+        auto copy = std::make_shared<Message>(message);
+        for (auto due : releases) {
+            in_flight_.push(InFlight{due, next_sequence_++, false, copy, endpoint});
+        }
+        schedule_cv_.notify_one();
+    }
+    return Result::SUCCESS;
+}
+
+void ImpairedTransport::on_inbound(MessagePtr message, const Endpoint& sender) {
+    std::unique_lock lock(mutex_);
+    if (!scheduling_) {
+        lock.unlock();
+        ITransportListener* listener = listener_.load();
+        if (listener != nullptr) {
+            listener->on_message_received(std::move(message), sender);
+        }
+        return;
+    }
+
+    auto now = Clock::now();
+    auto releases = impair(inbound_, SOMEIP_HEADER_SIZE + message->get_length(), now);
+    if (releases.size() == 1 && releases[0] <= now && in_flight_.empty()) {
+        inbound_.statistics.delivered++;
+        lock.unlock();
+        release(InFlight{now, 0, true, std::move(message), sender});
+        return;
+    }
+
+    for (auto due : releases) {
+        in_flight_.push(InFlight{due, next_sequence_++, true, message, sender});
+    }
+    if (!releases.empty()) {
+        schedule_cv_.notify_one();
+    }
+}
+
+void ImpairedTransport::release(const InFlight& event) {
+    ITransportListener* listener = listener_.load();
+    if (event.inbound) {
+        if (listener != nullptr) {
+            listener->on_message_received(event.message, event.endpoint);
+        }
+        return;
+    }
+
+    Result result = transport_->send_message(*event.message, event.endpoint);
+    if (result != Result::SUCCESS && listener != nullptr) {
+        listener->on_error(result);
+    }
+}
+
+void ImpairedTransport::schedule_loop() {
+    std::unique_lock lock(mutex_);
+    while (scheduling_) {
+        if (in_flight_.empty()) {
+            schedule_cv_.wait(lock, [this] { return !scheduling_ || !in_flight_.empty(); });
+            continue;
+        }
+
+        auto due = in_flight_.top().due;
+        if (due > Clock::now()) {
+            // Woken early when a message due sooner is queued
+            schedule_cv_.wait_until(lock, due);
+            continue;
+        }
+
+        InFlight event = in_flight_.top();
+        in_flight_.pop();
+        (event.inbound ? inbound_ : outbound_).statistics.delivered++;
+        lock.unlock();
+        release(event);
+        lock.lock();
+    }
+
+    // Whatever is still in flight is lost with the link
+    in_flight_ = decltype(in_flight_)();
+}
+
+MessagePtr ImpairedTransport::receive_message() {
+    return transport_->receive_message();
+}
+
+Result ImpairedTransport::connect(const Endpoint& endpoint) {
+    return transport_->connect(endpoint);
+}
+
+Result ImpairedTransport::disconnect() {
+    return transport_->disconnect();
+}
+
+bool ImpairedTransport::is_connected() const {
+    return transport_->is_connected();
+}
+
+Endpoint ImpairedTransport::get_local_endpoint() const {
+    return transport_->get_local_endpoint();
+}
+
+void ImpairedTransport::set_listener(ITransportListener* listener) {
+    listener_ = listener;
+}
+
+Result ImpairedTransport::start() {
+    Result result = transport_->start();
+    if (result != Result::SUCCESS) {
+        return result;
+    }
+
+    std::scoped_lock lock(mutex_);
+    if (!scheduling_) {
+        scheduling_ = true;
+        schedule_thread_ = std::thread(&ImpairedTransport::schedule_loop, this);
+    }
+    return Result::SUCCESS;
+}
+
+Result ImpairedTransport::stop() {
+    {
+        std::scoped_lock lock(mutex_);
+        scheduling_ = false;
+        schedule_cv_.notify_all();
+    }
+    if (schedule_thread_.joinable()) {
+        schedule_thread_.join();
+    }
+    return transport_->stop();
+}
+
+bool ImpairedTransport::is_running() const {
+    return transport_->is_running();
+}
+
+} // namespace transport
+} // namespace someip
@@ -0,0 +1,352 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "transport/inprocess_transport.h"
+#include <condition_variable>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace someip {
+namespace transport {
+
+/**
+ * @brief Receive queue of one in-process endpoint
+ *
+ * A bounded multi-producer/multi-consumer ring (D. Vyukov's design): each
+ * cell carries a sequence number telling producers and consumers whose turn
+ * it is, so push and pop are a CAS on a position counter and no lock is
+ * taken. The consumer sleeps on a condition variable only when the ring is
+ * empty; producers take the wait mutex only when it is asleep.
+ */
+class InProcessMailbox {
+public:
+    explicit InProcessMailbox(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        mask_ = size - 1;
+        cells_ = std::make_unique<Cell[]>(size);
+        for (size_t i = 0; i < size; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool push(MessagePtr message, const Endpoint& sender) {
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // Full
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->message = std::move(message);
+        cell->sender = sender;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+
+        // Pairs with the fence in wait(): either the consumer sees this
+        // message or this producer sees the consumer asleep
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleeping_.load(std::memory_order_relaxed)) {
+            std::scoped_lock lock(wait_mutex_);
+            wait_cv_.notify_one();
+        }
+        return true;
+    }
+
+    bool pop(MessagePtr& message, Endpoint& sender) {
+        size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // Empty
+            } else {
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+        message = std::move(cell->message);
+        sender = std::move(cell->sender);
+        cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Block until a message may be available or running turns false
+     */
+    void wait(const std::atomic<bool>& running) {
+        std::unique_lock lock(wait_mutex_);
+        sleeping_.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        wait_cv_.wait(lock, [&] { return !running || !empty(); });
+        sleeping_.store(false, std::memory_order_relaxed);
+    }
+
+    void wake() {
+        std::scoped_lock lock(wait_mutex_);
+        wait_cv_.notify_all();
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence{0};
+        MessagePtr message;
+        Endpoint sender;
+    };
+
+    bool empty() const {
+        return enqueue_pos_.load(std::memory_order_relaxed) == dequeue_pos_.load(std::memory_order_relaxed);
+    }
+
+    std::unique_ptr<Cell[]> cells_;
+    size_t mask_{0};
+    alignas(64) std::atomic<size_t> enqueue_pos_{0};
+    alignas(64) std::atomic<size_t> dequeue_pos_{0};
+    alignas(64) std::atomic<bool> sleeping_{false};
+    std::mutex wait_mutex_;
+    std::condition_variable wait_cv_;
+};
+
+namespace {
+
+constexpr uint16_t FIRST_DYNAMIC_PORT = 49152;
+
+struct AddressPortHash {
+    size_t operator()(const Endpoint& endpoint) const {
+        return std::hash<std::string>()(endpoint.get_address()) * 31 + endpoint.get_port();
+    }
+};
+
+struct AddressPortEqual {
+    bool operator()(const Endpoint& a, const Endpoint& b) const {
+        return a.get_port() == b.get_port() && a.get_address() == b.get_address();
+    }
+};
+
+/**
+ * @brief Process-wide table of started in-process endpoints
+ *
+ * Senders hold the shared lock while pushing, so a mailbox cannot be
+ * unregistered and destroyed under them.
+ */
+class Registry {
+public:
+    static Registry& instance() {
+        static Registry registry;
+        return registry;
+    }
+
+    /**
+     * @brief Register a mailbox; a port of 0 is replaced by an unused one
+     */
+    bool add(Endpoint& endpoint, InProcessMailbox* mailbox) {
+        std::unique_lock lock(mutex_);
+        if (endpoint.get_port() == 0) {
+            Endpoint candidate = endpoint;
+            for (uint32_t attempt = 0; attempt <= 0xFFFFu - FIRST_DYNAMIC_PORT; ++attempt) {
+                candidate.set_port(next_port_);
+                next_port_ = next_port_ == 0xFFFF ? FIRST_DYNAMIC_PORT : static_cast<uint16_t>(next_port_ + 1);
+                if (mailboxes_.find(candidate) == mailboxes_.end()) {
+                    endpoint = candidate;
+                    break;
+                }
+            }
+            if (endpoint.get_port() == 0) {
+                return false;
+            }
+        }
+        return mailboxes_.emplace(endpoint, mailbox).second;
+    }
+
+    void remove(const Endpoint& endpoint) {
+        std::unique_lock lock(mutex_);
+        mailboxes_.erase(endpoint);
+    }
+
+    Result deliver(const Endpoint& destination, MessagePtr message, const Endpoint& sender) const {
+        std::shared_lock lock(mutex_);
+        auto it = mailboxes_.find(destination);
+        if (it == mailboxes_.end()) {
+            return Result::NOT_CONNECTED;
+        }
+        return it->second->push(std::move(message), sender) ? Result::SUCCESS : Result::BUFFER_OVERFLOW;
+    }
+
+private:
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<Endpoint, InProcessMailbox*, AddressPortHash, AddressPortEqual> mailboxes_;
+    uint16_t next_port_{FIRST_DYNAMIC_PORT};
+};
+
+} // namespace
+
+InProcessTransport::InProcessTransport(const Endpoint& local_endpoint, const InProcessTransportConfig& config)
+    : local_endpoint_(local_endpoint), requested_endpoint_(local_endpoint), config_(config) {
+}
+
+InProcessTransport::~InProcessTransport() {
+    // NOLINTNEXTLINE(clang-analyzer-optin.cplusplus.VirtualCall) - intentional cleanup
+    (void)stop();
+}
+
+Result InProcessTransport::send_message(const Message& message, const Endpoint& endpoint) {
+    if (!running_) {
+        return Result::NOT_CONNECTED;
+    }
+    if (config_.verify_serialization) {
+        return send_verified(message, endpoint);  // The round trip makes the copy
+    }
+    return Registry::instance().deliver(endpoint, std::make_shared<Message>(message), local_endpoint_);
+}
+
+Result InProcessTransport::send_message(MessagePtr message, const Endpoint& endpoint) {
+    if (!message) {
+        return Result::INVALID_ARGUMENT;
+    }
+    if (!running_) {
+        return Result::NOT_CONNECTED;
+    }
+    if (config_.verify_serialization) {
+        return send_verified(*message, endpoint);
+    }
+    return Registry::instance().deliver(endpoint, std::move(message), local_endpoint_);
+}
+
+Result InProcessTransport::send_verified(const Message& message, const Endpoint& endpoint) {
+    auto copy = std::make_shared<Message>();
+    if (!copy->deserialize(message.serialize())) {
+        return Result::INVALID_MESSAGE;
+    }
+    return Registry::instance().deliver(endpoint, std::move(copy), local_endpoint_);
+}
+
+Result InProcessTransport::send_serialized(const uint8_t* data, size_t size, const Endpoint& endpoint) {
+    if (!running_) {
+        return Result::NOT_CONNECTED;
+    }
+    auto message = std::make_shared<Message>();
+    if (!message->deserialize(std::vector<uint8_t>(data, data + size))) {
+        return Result::INVALID_MESSAGE;
+    }
+    return Registry::instance().deliver(endpoint, std::move(message), local_endpoint_);
+}
+
+MessagePtr InProcessTransport::receive_message() {
+    std::scoped_lock lock(receive_mutex_);
+    if (receive_queue_.empty()) {
+        return nullptr;
+    }
+    MessagePtr message = std::move(receive_queue_.front());
+    receive_queue_.pop();
+    return message;
+}
+
+Result InProcessTransport::connect(const Endpoint& endpoint) {
+    // Connectionless, like UDP
+    return endpoint.is_valid() ? Result::SUCCESS : Result::INVALID_ENDPOINT;
+}
+
+Result InProcessTransport::disconnect() {
+    return Result::SUCCESS;
+}
+
+bool InProcessTransport::is_connected() const {
+    return is_running();
+}
+
+Endpoint InProcessTransport::get_local_endpoint() const {
+    return local_endpoint_;
+}
+
+void InProcessTransport::set_listener(ITransportListener* listener) {
+    listener_ = listener;
+}
+
+Result InProcessTransport::start() {
+    std::scoped_lock lock(lifecycle_mutex_);
+    if (running_) {
+        return Result::SUCCESS;
+    }
+
+    auto mailbox = std::make_unique<InProcessMailbox>(config_.queue_capacity);
+    Endpoint endpoint = requested_endpoint_;
+    if (!Registry::instance().add(endpoint, mailbox.get())) {
+        return Result::NETWORK_ERROR;  // Endpoint in use, as a failed bind would be
+    }
+
+    local_endpoint_ = endpoint;
+    mailbox_ = std::move(mailbox);
+    running_ = true;
+    delivery_thread_ = std::thread(&InProcessTransport::delivery_loop, this);
+    return Result::SUCCESS;
+}
+
+Result InProcessTransport::stop() {
+    std::scoped_lock lock(lifecycle_mutex_);
+    if (!running_) {
+        return Result::SUCCESS;
+    }
+
+    // Unregister first: once remove() returns, no sender is still pushing
+    Registry::instance().remove(local_endpoint_);
+    running_ = false;
+    mailbox_->wake();
+    if (delivery_thread_.joinable()) {
+        delivery_thread_.join();
+    }
+    mailbox_.reset();  // Undelivered messages are dropped
+    return Result::SUCCESS;
+}
+
+bool InProcessTransport::is_running() const {
+    return running_;
+}
+
+void InProcessTransport::delivery_loop() {
+    MessagePtr message;
+    Endpoint sender;
+    while (running_) {
+        if (!mailbox_->pop(message, sender)) {
+            mailbox_->wait(running_);
+            continue;
+        }
+
+        ITransportListener* listener = listener_.load();
+        if (listener != nullptr) {
+            listener->on_message_received(std::move(message), sender);
+        } else {
+            std::scoped_lock lock(receive_mutex_);
+            receive_queue_.push(std::move(message));
+        }
+        message.reset();
+    }
+}
+
+} // namespace transport
+} // namespace someip
@@ -0,0 +1,140 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "transport/message_filter.h"
+#include <algorithm>
+
+namespace someip {
+namespace transport {
+
+namespace {
+
+// Classic BPF opcodes (values from linux/filter.h, which is not portable)
+constexpr uint16_t BPF_LD_H_ABS = 0x28;
+constexpr uint16_t BPF_JMP_JEQ_K = 0x15;
+constexpr uint16_t BPF_RET_K = 0x06;
+
+constexpr uint32_t UDP_HEADER_SIZE = 8;
+constexpr uint32_t SERVICE_ID_OFFSET = UDP_HEADER_SIZE;
+constexpr uint32_t METHOD_ID_OFFSET = UDP_HEADER_SIZE + 2;
+constexpr uint32_t ACCEPT = 0xFFFFFFFF;
+constexpr uint32_t DROP = 0;
+
+constexpr size_t MAX_PROGRAM_SIZE = 4096;   // BPF_MAXINSNS
+constexpr size_t METHODS_PER_BLOCK = 100;   // Keeps block skips below the 8-bit jump limit
+
+BpfInstruction load_half(uint32_t offset) {
+    return BpfInstruction{BPF_LD_H_ABS, 0, 0, offset};
+}
+
+BpfInstruction jump_eq(uint32_t value, uint8_t jt, uint8_t jf) {
+    return BpfInstruction{BPF_JMP_JEQ_K, jt, jf, value};
+}
+
+BpfInstruction ret(uint32_t value) {
+    return BpfInstruction{BPF_RET_K, 0, 0, value};
+}
+
+} // namespace
+
+bool MessageFilter::matches(uint16_t service_id, uint16_t method_id) const {
+    if (service_ids.count(service_id) != 0) {
+        return true;
+    }
+    auto it = methods.find(service_id);
+    return it != methods.end() && it->second.count(method_id) != 0;
+}
+
+/**
+ * @brief Compile message IDs into a socket filter
+ *
+ * Each accepted ID is a compare followed by an inline accept, so no jump
+ * ever spans more than one block regardless of the number of IDs:
+ *
+ *   ld  [8]                    ; service ID
+ *   jeq #svc, 0, 1 ; ret #-1   ; per service
+ *   jeq #svc, 0, n             ; per block of methods of one service
+ *   ld  [10]                   ;   method ID
+ *   jeq #m, 0, 1 ; ret #-1     ;   per method
+ *   ld  [8]                    ;   restore service ID
+ *   ret #0
+ */
+Result compile_message_filter(const MessageFilter& filter, std::vector<BpfInstruction>& program) {
+    program.clear();
+    program.push_back(load_half(SERVICE_ID_OFFSET));
+
+    for (uint16_t service_id : filter.service_ids) {
+        program.push_back(jump_eq(service_id, 0, 1));
+        program.push_back(ret(ACCEPT));
+    }
+
+    for (const auto& [service_id, method_ids] : filter.methods) {
+        if (filter.service_ids.count(service_id) != 0 || method_ids.empty()) {
+            continue;
+        }
+
+        std::vector<uint16_t> ids(method_ids.begin(), method_ids.end());
+        for (size_t first = 0; first < ids.size(); first += METHODS_PER_BLOCK) {
+            size_t count = std::min(METHODS_PER_BLOCK, ids.size() - first);
+            program.push_back(jump_eq(service_id, 0, static_cast<uint8_t>(2 * count + 2)));
+            program.push_back(load_half(METHOD_ID_OFFSET));
+            for (size_t i = first; i < first + count; ++i) {
+                program.push_back(jump_eq(ids[i], 0, 1));
+                program.push_back(ret(ACCEPT));
+            }
+            program.push_back(load_half(SERVICE_ID_OFFSET));
+        }
+    }
+
+    program.push_back(ret(DROP));
+
+    if (program.size() > MAX_PROGRAM_SIZE) {
+        program.clear();
+        return Result::RESOURCE_EXHAUSTED;
+    }
+    return Result::SUCCESS;
+}
+
+bool run_message_filter(const std::vector<BpfInstruction>& program,
+                        const std::vector<uint8_t>& udp_payload) {
+    uint32_t accumulator = 0;
+    size_t pc = 0;
+
+    while (pc < program.size()) {
+        const BpfInstruction& insn = program[pc];
+        switch (insn.code) {
+            case BPF_LD_H_ABS: {
+                // Offsets are relative to the UDP header; out of bounds drops
+                if (insn.k < UDP_HEADER_SIZE || insn.k - UDP_HEADER_SIZE + 2 > udp_payload.size()) {
+                    return false;
+                }
+                size_t offset = insn.k - UDP_HEADER_SIZE;
+                accumulator = (static_cast<uint32_t>(udp_payload[offset]) << 8) | udp_payload[offset + 1];
+                ++pc;
+                break;
+            }
+            case BPF_JMP_JEQ_K:
+                pc += 1 + (accumulator == insn.k ? insn.jt : insn.jf);
+                break;
+            case BPF_RET_K:
+                return insn.k != 0;
+            default:
+                return false;
+        }
+    }
+
+    return false;
+}
+
+} // namespace transport
+} // namespace someip
@@ -0,0 +1,214 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "transport/priority_transport.h"
+#include "transport/udp_transport.h"
+#include <algorithm>
+
+namespace someip {
+namespace transport {
+
+PriorityTransport::PriorityTransport(std::shared_ptr<ITransport> transport,
+                                     const PriorityTransportConfig& config)
+    : transport_(std::move(transport)),
+      udp_(dynamic_cast<UdpTransport*>(transport_.get())),
+      config_(config) {
+    if (config_.classes.empty()) {
+        config_.classes.emplace_back();
+    }
+    if (config_.default_class >= config_.classes.size()) {
+        config_.default_class = static_cast<uint8_t>(config_.classes.size() - 1);
+    }
+    queues_.resize(config_.classes.size());
+    weighted_credit_ = std::max<uint32_t>(config_.classes[0].weight, 1);
+}
+
+PriorityTransport::~PriorityTransport() {
+    (void)stop();
+}
+
+Result PriorityTransport::set_traffic_class(uint16_t service_id, uint8_t traffic_class) {
+    if (traffic_class >= queues_.size()) {
+        return Result::INVALID_ARGUMENT;
+    }
+
+    std::scoped_lock lock(classes_mutex_);
+    service_classes_[service_id] = traffic_class;
+    return Result::SUCCESS;
+}
+
+Result PriorityTransport::set_traffic_class(uint16_t service_id, uint16_t method_id, uint8_t traffic_class) {
+    if (traffic_class >= queues_.size()) {
+        return Result::INVALID_ARGUMENT;
+    }
+
+    std::scoped_lock lock(classes_mutex_);
+    classes_[(static_cast<uint32_t>(service_id) << 16) | method_id] = traffic_class;
+    return Result::SUCCESS;
+}
+
+uint8_t PriorityTransport::classify(const Message& message) const {
+    std::scoped_lock lock(classes_mutex_);
+    auto method = classes_.find(message.get_message_id().to_uint32());
+    if (method != classes_.end()) {
+        return method->second;
+    }
+    auto service = service_classes_.find(message.get_service_id());
+    if (service != service_classes_.end()) {
+        return service->second;
+    }
+    return config_.default_class;
+}
+
+Result PriorityTransport::send_message(const Message& message, const Endpoint& endpoint) {
+    return send_message(message, endpoint, classify(message));
+}
+
+Result PriorityTransport::send_message(const Message& message, const Endpoint& endpoint,
+                                       uint8_t traffic_class) {
+    if (traffic_class >= queues_.size()) {
+        return Result::INVALID_ARGUMENT;
+    }
+
+    std::unique_lock lock(queue_mutex_);
+    if (!sending_) {
+        // Not started: nothing would drain the queue
+        lock.unlock();
+        return transport_->send_message(message, endpoint);
+    }
+
+    auto& queue = queues_[traffic_class];
+    if (queue.size() >= config_.classes[traffic_class].queue_capacity) {
+        return Result::RESOURCE_EXHAUSTED;
+    }
+    queue.push_back(QueuedMessage{message, endpoint});
+    queued_++;
+    queue_cv_.notify_one();
+    return Result::SUCCESS;
+}
+
+size_t PriorityTransport::get_queued(uint8_t traffic_class) const {
+    std::scoped_lock lock(queue_mutex_);
+    return traffic_class < queues_.size() ? queues_[traffic_class].size() : 0;
+}
+
+/**
+ * @brief Choose the class of the next message (queue_mutex_ must be held, queued_ > 0)
+ */
+uint8_t PriorityTransport::pick_class() {
+    if (config_.policy == SchedulingPolicy::STRICT_PRIORITY) {
+        for (size_t i = 0; i < queues_.size(); ++i) {
+            if (!queues_[i].empty()) {
+                return static_cast<uint8_t>(i);
+            }
+        }
+    }
+
+    // Weighted round robin: a class sends up to its weight, then yields
+    for (;;) {
+        if (!queues_[weighted_class_].empty() && weighted_credit_ > 0) {
+            weighted_credit_--;
+            return weighted_class_;
+        }
+        weighted_class_ = static_cast<uint8_t>((weighted_class_ + 1) % queues_.size());
+        weighted_credit_ = std::max<uint32_t>(config_.classes[weighted_class_].weight, 1);
+    }
+}
+
+void PriorityTransport::send_loop() {
+    for (;;) {
+        std::unique_lock lock(queue_mutex_);
+        queue_cv_.wait(lock, [this] { return queued_ > 0 || !sending_; });
+        if (queued_ == 0) {
+            return;  // Stopped and drained
+        }
+
+        uint8_t traffic_class = pick_class();
+        QueuedMessage next = std::move(queues_[traffic_class].front());
+        queues_[traffic_class].pop_front();
+        queued_--;
+        lock.unlock();
+
+        Result result;
+        if (udp_ != nullptr) {
+            // Marked per datagram, so plain sends on the same socket keep its marking
+            const auto& marking = config_.classes[traffic_class];
+            result = udp_->send_message(next.message, next.endpoint, marking.socket_priority, marking.dscp);
+        } else {
+            result = transport_->send_message(next.message, next.endpoint);
+        }
+        ITransportListener* listener = listener_.load();
+        if (result != Result::SUCCESS && listener != nullptr) {
+            listener->on_error(result);
+        }
+    }
+}
+
+MessagePtr PriorityTransport::receive_message() {
+    return transport_->receive_message();
+}
+
+Result PriorityTransport::connect(const Endpoint& endpoint) {
+    return transport_->connect(endpoint);
+}
+
+Result PriorityTransport::disconnect() {
+    return transport_->disconnect();
+}
+
+bool PriorityTransport::is_connected() const {
+    return transport_->is_connected();
+}
+
+Endpoint PriorityTransport::get_local_endpoint() const {
+    return transport_->get_local_endpoint();
+}
+
+void PriorityTransport::set_listener(ITransportListener* listener) {
+    listener_ = listener;
+    transport_->set_listener(listener);
+}
+
+Result PriorityTransport::start() {
+    Result result = transport_->start();
+    if (result != Result::SUCCESS) {
+        return result;
+    }
+
+    std::scoped_lock lock(queue_mutex_);
+    if (!sending_) {
+        sending_ = true;
+        send_thread_ = std::thread(&PriorityTransport::send_loop, this);
+    }
+    return Result::SUCCESS;
+}
+
+Result PriorityTransport::stop() {
+    {
+        std::scoped_lock lock(queue_mutex_);
+        sending_ = false;
+        queue_cv_.notify_all();
+    }
+    // The sender drains the queues before it exits
+    if (send_thread_.joinable()) {
+        send_thread_.join();
+    }
+    return transport_->stop();
+}
+
+bool PriorityTransport::is_running() const {
+    return transport_->is_running();
+}
+
+} // namespace transport
+} // namespace someip
@@ -0,0 +1,111 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "transport/recording_transport.h"
+
+namespace someip {
+namespace transport {
+
+void RecordingTransport::InboundListener::on_message_received(MessagePtr message, const Endpoint& sender) {
+    owner_.recorder_->record(TrafficDirection::RECEIVED, *message, sender);
+    ITransportListener* listener = owner_.listener_.load();
+    if (listener != nullptr) {
+        listener->on_message_received(std::move(message), sender);
+    }
+}
+
+void RecordingTransport::InboundListener::on_connection_lost(const Endpoint& endpoint) {
+    ITransportListener* listener = owner_.listener_.load();
+    if (listener != nullptr) {
+        listener->on_connection_lost(endpoint);
+    }
+}
+
+void RecordingTransport::InboundListener::on_connection_established(const Endpoint& endpoint) {
+    ITransportListener* listener = owner_.listener_.load();
+    if (listener != nullptr) {
+        listener->on_connection_established(endpoint);
+    }
+}
+
+void RecordingTransport::InboundListener::on_error(Result error) {
+    ITransportListener* listener = owner_.listener_.load();
+    if (listener != nullptr) {
+        listener->on_error(error);
+    }
+}
+
+RecordingTransport::RecordingTransport(std::shared_ptr<ITransport> transport,
+                                       std::shared_ptr<TrafficRecorder> recorder)
+    : transport_(std::move(transport)), recorder_(std::move(recorder)), inbound_listener_(*this) {
+    transport_->set_listener(&inbound_listener_);
+}
+
+RecordingTransport::~RecordingTransport() {
+    transport_->set_listener(nullptr);
+}
+
+Result RecordingTransport::send_message(const Message& message, const Endpoint& endpoint) {
+    Result result = transport_->send_message(message, endpoint);
+    if (result == Result::SUCCESS) {
+        recorder_->record(TrafficDirection::SENT, message, endpoint);
+    }
+    return result;
+}
+
+Result RecordingTransport::send_serialized(const uint8_t* data, size_t size, const Endpoint& endpoint) {
+    Result result = transport_->send_serialized(data, size, endpoint);
+    if (result == Result::SUCCESS) {
+        recorder_->record(TrafficDirection::SENT, data, size, endpoint);
+    }
+    return result;
+}
+
+MessagePtr RecordingTransport::receive_message() {
+    return transport_->receive_message();
+}
+
+Result RecordingTransport::connect(const Endpoint& endpoint) {
+    return transport_->connect(endpoint);
+}
+
+Result RecordingTransport::disconnect() {
+    return transport_->disconnect();
+}
+
+bool RecordingTransport::is_connected() const {
+    return transport_->is_connected();
+}
+
+Endpoint RecordingTransport::get_local_endpoint() const {
+    return transport_->get_local_endpoint();
+}
+
+void RecordingTransport::set_listener(ITransportListener* listener) {
+    listener_ = listener;
+}
+
+Result RecordingTransport::start() {
+    return transport_->start();
+}
+
+Result RecordingTransport::stop() {
+    return transport_->stop();
+}
+
+bool RecordingTransport::is_running() const {
+    return transport_->is_running();
+}
+
+} // namespace transport
+} // namespace someip
@@ -157,13 +157,18 @@ Result TcpTransport::stop() {
         return Result::SUCCESS;
     }
 
-    running_ = false;
+    {
+        std::scoped_lock lock(stop_mutex_);
+        running_ = false;
+    }
+    stop_cv_.notify_all();
 
     // Close connections
     disconnect_internal();
 
-    // Close listen socket if in server mode
+    // Close listen socket if in server mode; shutdown() wakes a blocked accept()
     if (server_mode_ && listen_socket_fd_ != -1) {
+        ::shutdown(listen_socket_fd_, SHUT_RDWR);
         close(listen_socket_fd_);
         listen_socket_fd_ = -1;
     }
@@ -405,7 +410,7 @@ void TcpTransport::receive_loop() {
                 // Check connection limit before accepting
                 if (active_connections_.load() >= config_.max_connections) {
                     // Too many connections, wait a bit before checking again
-                    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                    wait_for_stop(std::chrono::milliseconds(100));
                     continue;
                 }
 
@@ -431,7 +436,7 @@ void TcpTransport::receive_loop() {
         }
 
         if (!is_connected()) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            wait_for_stop(std::chrono::milliseconds(100));
             continue;
         }
 
@@ -461,10 +466,19 @@ void TcpTransport::receive_loop() {
             }
         }
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        wait_for_stop(std::chrono::milliseconds(10));
     }
 }
 
+/**
+ * @brief Sleep for up to timeout, returning early once stop() is called
+ * @return true if the transport is stopping
+ */
+bool TcpTransport::wait_for_stop(std::chrono::milliseconds timeout) {
+    std::unique_lock lock(stop_mutex_);
+    return stop_cv_.wait_for(lock, timeout, [this] { return !running_; });
+}
+
 void TcpTransport::connection_monitor_loop() {
     while (running_) {
         if (is_connected()) {
@@ -478,7 +492,9 @@ void TcpTransport::connection_monitor_loop() {
             }
         }
 
-        std::this_thread::sleep_for(std::chrono::seconds(30));
+        if (wait_for_stop(std::chrono::seconds(30))) {
+            break;
+        }
     }
 }
 
@@ -0,0 +1,472 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "transport/traffic_recorder.h"
+#include <arpa/inet.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+namespace someip {
+namespace transport {
+
+namespace {
+
+constexpr uint32_t SEGMENT_MAGIC = 0x53545231;  // "STR1"
+constexpr uint16_t SEGMENT_VERSION = 1;
+constexpr size_t SEGMENT_NUMBER_DIGITS = 6;
+constexpr size_t HEADER_REGION = 4096;          // Header padded to a page
+
+/**
+ * @brief Segment header; record_count and data_used are published last
+ */
+struct SegmentHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t header_size;
+    uint32_t index_entry_size;
+    uint32_t record_header_size;
+    uint64_t index_capacity;
+    uint64_t data_capacity;
+    uint64_t index_offset;
+    uint64_t data_offset;
+    std::atomic<uint64_t> record_count;
+    std::atomic<uint64_t> data_used;
+};
+
+struct IndexEntry {
+    uint64_t timestamp_ns;
+    uint32_t data_offset;       // Of the record header, from the start of the data region
+    uint32_t message_id;
+};
+
+struct RecordHeader {
+    uint64_t timestamp_ns;
+    uint32_t frame_size;
+    uint8_t direction;
+    uint8_t protocol;           // TransportProtocol of the peer
+    uint8_t family;             // 4, 6, or 0 if the address could not be parsed
+    uint8_t reserved;
+    uint16_t port;
+    uint8_t reserved2[6];
+    uint8_t address[16];
+};
+
+static_assert(sizeof(SegmentHeader) <= HEADER_REGION, "segment header must fit its region");
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "segment counters are shared through the mapping");
+static_assert(sizeof(RecordHeader) % 8 == 0, "records are 8-byte aligned");
+
+// Smallest record the index is sized for: a header and a bare SOME/IP header
+constexpr size_t MIN_RECORD_SIZE = sizeof(RecordHeader) + 16;
+
+size_t align8(size_t size) {
+    return (size + 7) & ~static_cast<size_t>(7);
+}
+
+uint64_t unix_now_ns() {
+    timespec now{};
+    clock_gettime(CLOCK_REALTIME, &now);
+    return static_cast<uint64_t>(now.tv_sec) * 1000000000ULL + static_cast<uint64_t>(now.tv_nsec);
+}
+
+void write_be32(uint8_t* out, uint32_t value) {
+    value = htonl(value);
+    std::memcpy(out, &value, sizeof(value));
+}
+
+/**
+ * @brief Parse a segment file name of the form <base>.<digits>
+ */
+bool parse_segment_number(const std::string& name, const std::string& base, uint64_t& number) {
+    if (name.size() != base.size() + 1 + SEGMENT_NUMBER_DIGITS || name.compare(0, base.size(), base) != 0 ||
+        name[base.size()] != '.') {
+        return false;
+    }
+    number = 0;
+    for (size_t i = base.size() + 1; i < name.size(); ++i) {
+        if (name[i] < '0' || name[i] > '9') {
+            return false;
+        }
+        number = number * 10 + static_cast<uint64_t>(name[i] - '0');
+    }
+    return true;
+}
+
+std::string segment_name(const std::string& path, uint64_t number) {
+    char suffix[16];
+    std::snprintf(suffix, sizeof(suffix), ".%06llu", static_cast<unsigned long long>(number));
+    return path + suffix;
+}
+
+std::vector<uint64_t> existing_segments(const std::string& path) {
+    size_t slash = path.rfind('/');
+    std::string directory = slash == std::string::npos ? "." : path.substr(0, slash == 0 ? 1 : slash);
+    std::string base = slash == std::string::npos ? path : path.substr(slash + 1);
+
+    std::vector<uint64_t> numbers;
+    DIR* dir = opendir(directory.c_str());
+    if (dir == nullptr) {
+        return numbers;
+    }
+    while (const dirent* entry = readdir(dir)) {
+        uint64_t number = 0;
+        if (parse_segment_number(entry->d_name, base, number)) {
+            numbers.push_back(number);
+        }
+    }
+    closedir(dir);
+    std::sort(numbers.begin(), numbers.end());
+    return numbers;
+}
+
+const SegmentHeader* segment_header(const uint8_t* map) {
+    return reinterpret_cast<const SegmentHeader*>(map);
+}
+
+} // namespace
+
+TrafficRecorder::~TrafficRecorder() {
+    close();
+}
+
+bool TrafficRecorder::open(const TrafficRecorderConfig& config) {
+    std::scoped_lock lock(mutex_);
+    if (map_ != nullptr || config.path.empty() || config.segment_size < MIN_RECORD_SIZE ||
+        config.segment_size > UINT32_MAX) {
+        return false;
+    }
+
+    config_ = config;
+    auto existing = existing_segments(config_.path);
+    segment_number_ = existing.empty() ? 0 : existing.back() + 1;
+    last_timestamp_ = 0;
+    return open_segment();
+}
+
+void TrafficRecorder::close() {
+    std::scoped_lock lock(mutex_);
+    close_segment();
+}
+
+bool TrafficRecorder::is_open() const {
+    std::scoped_lock lock(mutex_);
+    return map_ != nullptr;
+}
+
+std::string TrafficRecorder::get_segment_path() const {
+    std::scoped_lock lock(mutex_);
+    return segment_path_;
+}
+
+bool TrafficRecorder::open_segment() {
+    std::string path = segment_name(config_.path, segment_number_);
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return false;
+    }
+
+    // The file is sparse: index and data pages take disk space as they are written
+    index_capacity_ = config_.segment_size / MIN_RECORD_SIZE;
+    data_capacity_ = config_.segment_size;
+    size_t index_size = align8(index_capacity_ * sizeof(IndexEntry));
+    size_t size = HEADER_REGION + index_size + data_capacity_;
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        ::close(fd);
+        return false;
+    }
+
+    void* map = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (map == MAP_FAILED) {
+        ::close(fd);
+        return false;
+    }
+
+    auto* header = new (map) SegmentHeader{};
+    header->magic = SEGMENT_MAGIC;
+    header->version = SEGMENT_VERSION;
+    header->header_size = sizeof(SegmentHeader);
+    header->index_entry_size = sizeof(IndexEntry);
+    header->record_header_size = sizeof(RecordHeader);
+    header->index_capacity = index_capacity_;
+    header->data_capacity = data_capacity_;
+    header->index_offset = HEADER_REGION;
+    header->data_offset = HEADER_REGION + index_size;
+    header->record_count.store(0, std::memory_order_release);
+    header->data_used.store(0, std::memory_order_release);
+
+    fd_ = fd;
+    map_ = static_cast<uint8_t*>(map);
+    map_size_ = size;
+    record_count_ = 0;
+    data_used_ = 0;
+    segment_path_ = path;
+
+    if (config_.max_segments > 0) {
+        auto existing = existing_segments(config_.path);
+        for (size_t i = 0; i + config_.max_segments < existing.size(); ++i) {
+            (void)::unlink(segment_name(config_.path, existing[i]).c_str());
+        }
+    }
+    return true;
+}
+
+void TrafficRecorder::close_segment() {
+    if (map_ != nullptr) {
+        msync(map_, map_size_, MS_ASYNC);
+        munmap(map_, map_size_);
+        map_ = nullptr;
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+}
+
+uint8_t* TrafficRecorder::reserve(TrafficDirection direction, uint32_t message_id, size_t frame_size,
+                                  const Endpoint& peer) {
+    size_t record_size = align8(sizeof(RecordHeader) + frame_size);
+    if (map_ == nullptr || record_size > data_capacity_) {
+        return nullptr;
+    }
+    if (record_count_ == index_capacity_ || data_used_ + record_size > data_capacity_) {
+        close_segment();
+        segment_number_++;
+        if (!open_segment()) {
+            return nullptr;
+        }
+    }
+
+    const auto* header = segment_header(map_);
+    uint64_t timestamp = std::max(unix_now_ns(), last_timestamp_);
+    last_timestamp_ = timestamp;
+
+    auto* record = reinterpret_cast<RecordHeader*>(map_ + header->data_offset + data_used_);
+    record->timestamp_ns = timestamp;
+    record->frame_size = static_cast<uint32_t>(frame_size);
+    record->direction = static_cast<uint8_t>(direction);
+    record->protocol = static_cast<uint8_t>(peer.get_protocol());
+    record->port = peer.get_port();
+    if (inet_pton(AF_INET, peer.get_address().c_str(), record->address) == 1) {
+        record->family = 4;
+    } else if (inet_pton(AF_INET6, peer.get_address().c_str(), record->address) == 1) {
+        record->family = 6;
+    } else {
+        record->family = 0;
+    }
+
+    auto* entry = reinterpret_cast<IndexEntry*>(map_ + header->index_offset) + record_count_;
+    entry->timestamp_ns = timestamp;
+    entry->data_offset = static_cast<uint32_t>(data_used_);
+    entry->message_id = message_id;
+
+    return reinterpret_cast<uint8_t*>(record + 1);
+}
+
+void TrafficRecorder::commit(size_t frame_size) {
+    auto* header = reinterpret_cast<SegmentHeader*>(map_);
+    data_used_ += align8(sizeof(RecordHeader) + frame_size);
+    record_count_++;
+    header->data_used.store(data_used_, std::memory_order_release);
+    header->record_count.store(record_count_, std::memory_order_release);
+    recorded_.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool TrafficRecorder::record(TrafficDirection direction, const Message& message, const Endpoint& peer) {
+    if (message.has_e2e_header()) {
+        // Rare: let the message lay out its E2E header
+        std::vector<uint8_t> frame = message.serialize();
+        return record(direction, frame.data(), frame.size(), peer);
+    }
+
+    const size_t header_size = Message::get_header_size();
+    PayloadView payload = message.get_payload();
+    size_t frame_size = header_size + payload.size();
+
+    std::scoped_lock lock(mutex_);
+    uint8_t* out = reserve(direction, message.get_message_id().to_uint32(), frame_size, peer);
+    if (out == nullptr) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // Lay out the header as Message::serialize() does, without allocating
+    write_be32(out, message.get_message_id().to_uint32());
+    write_be32(out + 4, message.get_length());
+    write_be32(out + 8, message.get_request_id().to_uint32());
+    out[12] = message.get_protocol_version();
+    out[13] = message.get_interface_version();
+    out[14] = static_cast<uint8_t>(message.get_message_type());
+    out[15] = static_cast<uint8_t>(message.get_return_code());
+    if (payload.size() > 0) {
+        std::memcpy(out + header_size, payload.data(), payload.size());
+    }
+    commit(frame_size);
+    return true;
+}
+
+bool TrafficRecorder::record(TrafficDirection direction, const uint8_t* frame, size_t size, const Endpoint& peer) {
+    uint32_t message_id = 0;
+    if (size >= 4) {
+        std::memcpy(&message_id, frame, sizeof(message_id));
+        message_id = ntohl(message_id);
+    }
+
+    std::scoped_lock lock(mutex_);
+    uint8_t* out = reserve(direction, message_id, size, peer);
+    if (out == nullptr) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    std::memcpy(out, frame, size);
+    commit(size);
+    return true;
+}
+
+bool TrafficRecord::to_message(Message& message) const {
+    return frame != nullptr && message.deserialize(std::vector<uint8_t>(frame, frame + size));
+}
+
+TrafficLogReader::~TrafficLogReader() {
+    close();
+}
+
+bool TrafficLogReader::open(const std::string& segment_path) {
+    close();
+    int fd = ::open(segment_path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st{};
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < HEADER_REGION) {
+        ::close(fd);
+        return false;
+    }
+    size_t size = static_cast<size_t>(st.st_size);
+    void* map = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);  // The mapping keeps the file
+    if (map == MAP_FAILED) {
+        return false;
+    }
+
+    // Written so that corrupt offsets and capacities cannot overflow the checks
+    const auto* header = static_cast<const SegmentHeader*>(map);
+    bool valid = header->magic == SEGMENT_MAGIC && header->version == SEGMENT_VERSION &&
+                 header->index_entry_size == sizeof(IndexEntry) &&
+                 header->record_header_size == sizeof(RecordHeader) &&
+                 header->index_offset <= header->data_offset &&
+                 header->index_capacity <= (header->data_offset - header->index_offset) / sizeof(IndexEntry) &&
+                 header->data_offset <= size && header->data_capacity <= size - header->data_offset;
+    if (!valid) {
+        munmap(map, size);
+        return false;
+    }
+
+    map_ = static_cast<const uint8_t*>(map);
+    map_size_ = size;
+    return true;
+}
+
+void TrafficLogReader::close() {
+    if (map_ != nullptr) {
+        munmap(const_cast<uint8_t*>(map_), map_size_);
+        map_ = nullptr;
+        map_size_ = 0;
+    }
+}
+
+size_t TrafficLogReader::size() const {
+    if (map_ == nullptr) {
+        return 0;
+    }
+    // Never trust the count beyond the index of a damaged segment
+    const auto* header = segment_header(map_);
+    uint64_t count = header->record_count.load(std::memory_order_acquire);
+    return static_cast<size_t>(std::min(count, header->index_capacity));
+}
+
+bool TrafficLogReader::read(size_t index, TrafficRecord& record) const {
+    if (index >= size()) {
+        return false;
+    }
+
+    const auto* header = segment_header(map_);
+    const auto* entry = reinterpret_cast<const IndexEntry*>(map_ + header->index_offset) + index;
+    if (entry->data_offset + sizeof(RecordHeader) > header->data_capacity) {
+        return false;
+    }
+    const auto* stored = reinterpret_cast<const RecordHeader*>(map_ + header->data_offset + entry->data_offset);
+    if (entry->data_offset + sizeof(RecordHeader) + stored->frame_size > header->data_capacity) {
+        return false;
+    }
+
+    record.timestamp_ns = stored->timestamp_ns;
+    record.direction = static_cast<TrafficDirection>(stored->direction);
+    record.message_id = entry->message_id;
+    record.frame = reinterpret_cast<const uint8_t*>(stored + 1);
+    record.size = stored->frame_size;
+
+    char address[INET6_ADDRSTRLEN] = {};
+    int family = stored->family == 4 ? AF_INET : stored->family == 6 ? AF_INET6 : AF_UNSPEC;
+    if (family == AF_UNSPEC || inet_ntop(family, stored->address, address, sizeof(address)) == nullptr) {
+        address[0] = '\0';
+    }
+    record.peer = Endpoint(address, stored->port, static_cast<TransportProtocol>(stored->protocol));
+    return true;
+}
+
+size_t TrafficLogReader::seek(uint64_t timestamp_ns) const {
+    size_t count = size();
+    if (count == 0) {
+        return 0;
+    }
+    const auto* header = segment_header(map_);
+    const auto* entries = reinterpret_cast<const IndexEntry*>(map_ + header->index_offset);
+    const auto* found = std::lower_bound(entries, entries + count, timestamp_ns,
+                                         [](const IndexEntry& entry, uint64_t time) {
+                                             return entry.timestamp_ns < time;
+                                         });
+    return static_cast<size_t>(found - entries);
+}
+
+size_t TrafficLogReader::find_next(size_t from, uint16_t service_id) const {
+    size_t count = size();
+    if (map_ == nullptr) {
+        return count;
+    }
+    const auto* header = segment_header(map_);
+    const auto* entries = reinterpret_cast<const IndexEntry*>(map_ + header->index_offset);
+    for (size_t i = from; i < count; ++i) {
+        if ((entries[i].message_id >> 16) == service_id) {
+            return i;
+        }
+    }
+    return count;
+}
+
+std::vector<std::string> TrafficLogReader::list_segments(const std::string& path) {
+    std::vector<std::string> paths;
+    for (uint64_t number : existing_segments(path)) {
+        paths.push_back(segment_name(path, number));
+    }
+    return paths;
+}
+
+} // namespace transport
+} // namespace someip
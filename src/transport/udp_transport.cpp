@@ -18,12 +18,21 @@
 #include <arpa/inet.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <algorithm>
+#include <cerrno>
 #include <cstring>
 #include <iostream>
+#ifdef __linux__
+#include <linux/filter.h>
+#endif
 
 namespace someip {
 namespace transport {
 
+namespace {
+constexpr size_t SOMEIP_HEADER_SIZE = 16;   // Message ID, length, request ID, versions, type, code
+} // namespace
+
 /**
  * @brief UDP Transport constructor
  * @implements REQ_TRANSPORT_001
@@ -64,17 +73,115 @@ Result UdpTransport::send_message(const Message& message, const Endpoint& endpoi
     // Serialize message
     std::vector<uint8_t> data = message.serialize();
 
-    if (data.size() > MAX_UDP_PAYLOAD) {
+    Result result = check_message_size(data.size());
+    if (result != Result::SUCCESS) {
+        return result;
+    }
+
+    return send_data(data, endpoint);
+}
+
+Result UdpTransport::send_message(const Message& message, const Endpoint& endpoint,
+                                  int socket_priority, uint8_t dscp) {
+    if (socket_priority < 0 || dscp > 63) {
+        return Result::INVALID_ARGUMENT;
+    }
+
+    if (!is_running()) {
+        return Result::NOT_CONNECTED;
+    }
+
+    if (!endpoint.is_valid()) {
+        return Result::INVALID_ENDPOINT;
+    }
+
+    std::vector<uint8_t> data = message.serialize();
+
+    Result result = check_message_size(data.size());
+    if (result != Result::SUCCESS) {
+        return result;
+    }
+
+    return send_data(data.data(), data.size(), endpoint, socket_priority, dscp);
+}
+
+/**
+ * @brief Size check shared by send_message() and send_messages()
+ */
+Result UdpTransport::check_message_size(size_t size) const {
+    if (size > MAX_UDP_PAYLOAD) {
         return Result::BUFFER_OVERFLOW;
     }
 
     // Check against SOME/IP recommended max size (1400 bytes to avoid IP fragmentation)
-    if (config_.max_message_size > 0 && data.size() > config_.max_message_size) {
+    if (config_.max_message_size > 0 && size > config_.max_message_size) {
         // Log warning but allow sending - use TP for large messages
         // In production, this should trigger SOME/IP-TP segmentation
     }
 
-    return send_data(data, endpoint);
+    return Result::SUCCESS;
+}
+
+Result UdpTransport::send_serialized(const uint8_t* data, size_t size, const Endpoint& endpoint) {
+    if (!is_running()) {
+        return Result::NOT_CONNECTED;
+    }
+
+    if (!endpoint.is_valid()) {
+        return Result::INVALID_ENDPOINT;
+    }
+
+    if (size < SOMEIP_HEADER_SIZE) {
+        return Result::INVALID_MESSAGE;
+    }
+
+    if (size > MAX_UDP_PAYLOAD) {
+        return Result::BUFFER_OVERFLOW;
+    }
+
+    return send_data(data, size, endpoint);
+}
+
+Result UdpTransport::send_messages(const std::vector<Message>& messages, const Endpoint& endpoint) {
+    if (!is_running()) {
+        return Result::NOT_CONNECTED;
+    }
+
+    if (!endpoint.is_valid()) {
+        return Result::INVALID_ENDPOINT;
+    }
+
+    // Check the whole batch first so that a size error sends nothing
+    std::vector<std::vector<uint8_t>> serialized;
+    serialized.reserve(messages.size());
+    for (const auto& message : messages) {
+        serialized.push_back(message.serialize());
+        Result result = check_message_size(serialized.back().size());
+        if (result != Result::SUCCESS) {
+            return result;
+        }
+    }
+
+    const size_t limit = config_.max_message_size > 0
+        ? std::min(config_.max_message_size, MAX_UDP_PAYLOAD) : MAX_UDP_PAYLOAD;
+    std::vector<uint8_t> datagram;
+    datagram.reserve(limit);
+
+    for (const auto& data : serialized) {
+        if (!datagram.empty() && datagram.size() + data.size() > limit) {
+            Result result = send_data(datagram, endpoint);
+            if (result != Result::SUCCESS) {
+                return result;
+            }
+            datagram.clear();
+        }
+        datagram.insert(datagram.end(), data.begin(), data.end());
+    }
+
+    if (!datagram.empty()) {
+        return send_data(datagram, endpoint);
+    }
+    return Result::SUCCESS;
 }
 
 MessagePtr UdpTransport::receive_message() {
@@ -237,6 +344,87 @@ Result UdpTransport::leave_multicast_group(const std::string& multicast_address)
     return Result::SUCCESS;
 }
 
+Result UdpTransport::set_message_filter(const MessageFilter& filter) {
+    std::vector<BpfInstruction> program;
+    Result result = compile_message_filter(filter, program);
+    if (result != Result::SUCCESS) {
+        return result;
+    }
+
+    std::scoped_lock lock(socket_mutex_);
+    filter_program_ = std::move(program);
+    return socket_fd_ >= 0 ? apply_message_filter() : Result::SUCCESS;
+}
+
+Result UdpTransport::clear_message_filter() {
+    std::scoped_lock lock(socket_mutex_);
+    filter_program_.reset();
+    return socket_fd_ >= 0 ? apply_message_filter() : Result::SUCCESS;
+}
+
+Result UdpTransport::set_traffic_marking(int socket_priority, uint8_t dscp) {
+    if (socket_priority < 0 || dscp > 63) {
+        return Result::INVALID_ARGUMENT;
+    }
+
+    std::scoped_lock lock(socket_mutex_);
+    if (socket_fd_ < 0) {
+        config_.socket_priority = socket_priority;
+        config_.dscp = dscp;
+        return Result::SUCCESS;
+    }
+    if (socket_priority == applied_priority_ && dscp == applied_dscp_) {
+        return Result::SUCCESS;
+    }
+    return apply_traffic_marking(socket_priority, dscp);
+}
+
+/**
+ * @brief Set SO_PRIORITY and IP_TOS on the socket (socket_mutex_ must be held)
+ */
+Result UdpTransport::apply_traffic_marking(int socket_priority, uint8_t dscp) {
+#ifdef SO_PRIORITY
+    if (setsockopt(socket_fd_, SOL_SOCKET, SO_PRIORITY, &socket_priority, sizeof(socket_priority)) < 0) {
+        return Result::NETWORK_ERROR;
+    }
+#endif
+    // DSCP occupies the upper six bits of the TOS byte; keep ECN clear
+    int tos = dscp << 2;
+    if (setsockopt(socket_fd_, IPPROTO_IP, IP_TOS, &tos, sizeof(tos)) < 0) {
+        return Result::NETWORK_ERROR;
+    }
+    applied_priority_ = socket_priority;
+    applied_dscp_ = dscp;
+    return Result::SUCCESS;
+}
+
+/**
+ * @brief Attach or detach the socket filter (socket_mutex_ must be held)
+ */
+Result UdpTransport::apply_message_filter() {
+#ifdef __linux__
+    if (!filter_program_) {
+        int dummy = 0;
+        if (setsockopt(socket_fd_, SOL_SOCKET, SO_DETACH_FILTER, &dummy, sizeof(dummy)) < 0 &&
+            errno != ENOENT) {
+            return Result::NETWORK_ERROR;
+        }
+        return Result::SUCCESS;
+    }
+
+    static_assert(sizeof(BpfInstruction) == sizeof(sock_filter), "BPF instruction layout mismatch");
+    sock_fprog fprog{};
+    fprog.len = static_cast<unsigned short>(filter_program_->size());
+    fprog.filter = reinterpret_cast<sock_filter*>(filter_program_->data());
+    if (setsockopt(socket_fd_, SOL_SOCKET, SO_ATTACH_FILTER, &fprog, sizeof(fprog)) < 0) {
+        return Result::NETWORK_ERROR;
+    }
+    return Result::SUCCESS;
+#else
+    return filter_program_ ? Result::NOT_IMPLEMENTED : Result::SUCCESS;
+#endif
+}
+
 Result UdpTransport::create_socket() {
     std::scoped_lock lock(socket_mutex_);
 
@@ -284,6 +472,13 @@ Result UdpTransport::create_socket() {
         // Not critical - continue with default buffer size
     }
 
+    // Traffic marking (non-critical - priorities above 6 need CAP_NET_ADMIN)
+    applied_priority_ = 0;
+    applied_dscp_ = 0;
+    if (config_.socket_priority != 0 || config_.dscp != 0) {
+        (void)apply_traffic_marking(config_.socket_priority, config_.dscp);
+    }
+
     // Set blocking/non-blocking mode
     if (!config_.blocking) {
         int flags = fcntl(socket_fd_, F_GETFL, 0);
@@ -294,6 +489,13 @@ Result UdpTransport::create_socket() {
         }
     }
 
+    // Attach before bind so no unfiltered datagram can be queued
+    if (filter_program_ && apply_message_filter() != Result::SUCCESS) {
+        close(socket_fd_);
+        socket_fd_ = -1;
+        return Result::NETWORK_ERROR;
+    }
+
     return Result::SUCCESS;
 }
 
@@ -341,12 +543,30 @@ void UdpTransport::receive_loop() {
 
     while (running_) {
         Endpoint sender;
+        buffer.resize(config_.receive_buffer_size);  // receive_data() shrinks it to the datagram
         Result result = receive_data(buffer, sender);
 
         if (result == Result::SUCCESS) {
-            // Try to deserialize message
-            MessagePtr message = std::make_shared<Message>();
-            if (message->deserialize(buffer)) {  // Deserialize from the received buffer
+            // A datagram may carry several messages back to back
+            size_t offset = 0;
+            while (buffer.size() - offset >= SOMEIP_HEADER_SIZE) {
+                uint32_t length_be;
+                std::memcpy(&length_be, buffer.data() + offset + 4, sizeof(length_be));
+                size_t message_size = 8 + static_cast<size_t>(ntohl(length_be));
+                if (message_size > buffer.size() - offset) {
+                    break;  // Truncated trailing message
+                }
+
+                MessagePtr message = std::make_shared<Message>();
+                bool valid = (offset == 0 && message_size == buffer.size())
+                    ? message->deserialize(buffer)  // Common case: one message per datagram
+                    : message->deserialize(std::vector<uint8_t>(buffer.begin() + offset,
+                                                                buffer.begin() + offset + message_size));
+                offset += message_size;
+                if (!valid) {
+                    continue;
+                }
+
                 // Add to queue
                 {
                     std::scoped_lock lock(queue_mutex_);
@@ -382,6 +602,10 @@ void UdpTransport::receive_loop() {
 }
 
 Result UdpTransport::send_data(const std::vector<uint8_t>& data, const Endpoint& endpoint) {
+    return send_data(data.data(), data.size(), endpoint);
+}
+
+Result UdpTransport::send_data(const uint8_t* data, size_t size, const Endpoint& endpoint) {
     std::scoped_lock lock(socket_mutex_);
 
     if (socket_fd_ < 0) {
@@ -389,14 +613,80 @@ Result UdpTransport::send_data(const std::vector<uint8_t>& data, const Endpoint&
     }
 
     sockaddr_in dest_addr = create_sockaddr(endpoint);
-    ssize_t sent = sendto(socket_fd_, data.data(), data.size(), 0,
+    ssize_t sent = sendto(socket_fd_, data, size, 0,
                          reinterpret_cast<sockaddr*>(&dest_addr), sizeof(dest_addr));
 
     if (sent < 0) {
         return Result::NETWORK_ERROR;
     }
 
-    if (static_cast<size_t>(sent) != data.size()) {
+    if (static_cast<size_t>(sent) != size) {
+        return Result::BUFFER_OVERFLOW;
+    }
+
+    return Result::SUCCESS;
+}
+
+/**
+ * @brief Send a datagram with IP_TOS (and SO_PRIORITY) control data
+ */
+Result UdpTransport::send_data(const uint8_t* data, size_t size, const Endpoint& endpoint,
+                               int socket_priority, uint8_t dscp) {
+    std::scoped_lock lock(socket_mutex_);
+
+    if (socket_fd_ < 0) {
+        return Result::NOT_CONNECTED;
+    }
+
+    sockaddr_in dest_addr = create_sockaddr(endpoint);
+    iovec iov{const_cast<uint8_t*>(data), size};
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int)) * 2] = {};
+
+    msghdr msg{};
+    msg.msg_name = &dest_addr;
+    msg.msg_namelen = sizeof(dest_addr);
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    // DSCP occupies the upper six bits of the TOS byte; keep ECN clear
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = IPPROTO_IP;
+    cmsg->cmsg_type = IP_TOS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+    int tos = dscp << 2;
+    std::memcpy(CMSG_DATA(cmsg), &tos, sizeof(tos));
+    msg.msg_controllen = CMSG_SPACE(sizeof(int));
+
+#ifdef SO_PRIORITY
+    if (priority_cmsg_) {
+        cmsg = reinterpret_cast<cmsghdr*>(control + CMSG_SPACE(sizeof(int)));
+        cmsg->cmsg_level = SOL_SOCKET;
+        cmsg->cmsg_type = SO_PRIORITY;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+        std::memcpy(CMSG_DATA(cmsg), &socket_priority, sizeof(socket_priority));
+        msg.msg_controllen += CMSG_SPACE(sizeof(int));
+    }
+#else
+    (void)socket_priority;
+#endif
+
+    ssize_t sent = sendmsg(socket_fd_, &msg, 0);
+#ifdef SO_PRIORITY
+    if (sent < 0 && errno == EINVAL && priority_cmsg_) {
+        // Older kernels reject SO_PRIORITY control data; mark with DSCP only
+        msg.msg_controllen = CMSG_SPACE(sizeof(int));
+        sent = sendmsg(socket_fd_, &msg, 0);
+        priority_cmsg_ = sent < 0;
+    }
+#endif
+
+    if (sent < 0) {
+        return Result::NETWORK_ERROR;
+    }
+
+    if (static_cast<size_t>(sent) != size) {
         return Result::BUFFER_OVERFLOW;
     }
 
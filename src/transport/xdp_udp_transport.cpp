@@ -0,0 +1,1035 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "transport/xdp_udp_transport.h"
+#include "common/result.h"
+#include <linux/bpf.h>
+#include <linux/if_link.h>
+#include <linux/if_xdp.h>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <poll.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#ifndef AF_XDP
+#define AF_XDP 44
+#endif
+
+#ifndef SOL_XDP
+#define SOL_XDP 283
+#endif
+
+namespace someip {
+namespace transport {
+
+namespace {
+
+constexpr size_t ETH_HEADER_SIZE = 14;
+constexpr size_t IPV4_HEADER_SIZE = 20;
+constexpr size_t UDP_HEADER_SIZE = 8;
+constexpr uint16_t ETHERTYPE_IPV4 = 0x0800;
+constexpr uint8_t IPV4_DEFAULT_TTL = 64;
+constexpr uint32_t RX_BATCH_SIZE = 64;
+
+/**
+ * @brief One of the four AF_XDP descriptor rings mapped from the kernel
+ *
+ * For producer rings (fill, TX) cached_cons holds the consumer index plus the
+ * ring size so that cached_cons - cached_prod is the number of free entries.
+ */
+struct XskRing {
+    uint32_t* producer{nullptr};
+    uint32_t* consumer{nullptr};
+    void* descs{nullptr};
+    uint32_t mask{0};
+    uint32_t size{0};
+    uint32_t cached_prod{0};
+    uint32_t cached_cons{0};
+    void* map{MAP_FAILED};
+    size_t map_size{0};
+};
+
+uint32_t load_acquire(const uint32_t* index) {
+    return __atomic_load_n(index, __ATOMIC_ACQUIRE);
+}
+
+void store_release(uint32_t* index, uint32_t value) {
+    __atomic_store_n(index, value, __ATOMIC_RELEASE);
+}
+
+uint32_t producer_free(XskRing& ring, uint32_t wanted) {
+    uint32_t free_entries = ring.cached_cons - ring.cached_prod;
+    if (free_entries >= wanted) {
+        return free_entries;
+    }
+    ring.cached_cons = load_acquire(ring.consumer) + ring.size;
+    return ring.cached_cons - ring.cached_prod;
+}
+
+uint32_t consumer_available(XskRing& ring) {
+    ring.cached_prod = load_acquire(ring.producer);
+    return ring.cached_prod - ring.cached_cons;
+}
+
+uint64_t* addr_entry(XskRing& ring, uint32_t index) {
+    return static_cast<uint64_t*>(ring.descs) + (index & ring.mask);
+}
+
+xdp_desc* desc_entry(XskRing& ring, uint32_t index) {
+    return static_cast<xdp_desc*>(ring.descs) + (index & ring.mask);
+}
+
+bool map_ring(int fd, XskRing& ring, const xdp_ring_offset& offsets, uint32_t size,
+              size_t entry_size, off_t page_offset) {
+    ring.map_size = offsets.desc + size * entry_size;
+    ring.map = mmap(nullptr, ring.map_size, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, fd, page_offset);
+    if (ring.map == MAP_FAILED) {
+        return false;
+    }
+
+    auto* base = static_cast<uint8_t*>(ring.map);
+    ring.producer = reinterpret_cast<uint32_t*>(base + offsets.producer);
+    ring.consumer = reinterpret_cast<uint32_t*>(base + offsets.consumer);
+    ring.descs = base + offsets.desc;
+    ring.size = size;
+    ring.mask = size - 1;
+    ring.cached_prod = load_acquire(ring.producer);
+    ring.cached_cons = load_acquire(ring.consumer);
+    return true;
+}
+
+void unmap_ring(XskRing& ring) {
+    if (ring.map != MAP_FAILED) {
+        munmap(ring.map, ring.map_size);
+        ring.map = MAP_FAILED;
+    }
+}
+
+bool is_power_of_two(uint32_t value) {
+    return value != 0 && (value & (value - 1)) == 0;
+}
+
+void put_u16(uint8_t* out, uint16_t value) {
+    out[0] = static_cast<uint8_t>(value >> 8);
+    out[1] = static_cast<uint8_t>(value);
+}
+
+void put_u32(uint8_t* out, uint32_t value) {
+    out[0] = static_cast<uint8_t>(value >> 24);
+    out[1] = static_cast<uint8_t>(value >> 16);
+    out[2] = static_cast<uint8_t>(value >> 8);
+    out[3] = static_cast<uint8_t>(value);
+}
+
+uint16_t get_u16(const uint8_t* in) {
+    return static_cast<uint16_t>((in[0] << 8) | in[1]);
+}
+
+uint32_t get_u32(const uint8_t* in) {
+    return (static_cast<uint32_t>(in[0]) << 24) | (static_cast<uint32_t>(in[1]) << 16) |
+           (static_cast<uint32_t>(in[2]) << 8) | static_cast<uint32_t>(in[3]);
+}
+
+/**
+ * @brief Accumulate the one's complement sum of big-endian 16-bit words
+ */
+uint32_t checksum_add(uint32_t sum, const uint8_t* data, size_t length) {
+    size_t i = 0;
+    for (; i + 1 < length; i += 2) {
+        sum += get_u16(data + i);
+    }
+    if (i < length) {
+        sum += static_cast<uint32_t>(data[i]) << 8;
+    }
+    return sum;
+}
+
+uint16_t checksum_fold(uint32_t sum) {
+    while (sum >> 16) {
+        sum = (sum & 0xFFFF) + (sum >> 16);
+    }
+    return static_cast<uint16_t>(~sum);
+}
+
+uint32_t udp_pseudo_header_sum(uint32_t src_ip, uint32_t dst_ip, uint16_t udp_length) {
+    return (src_ip >> 16) + (src_ip & 0xFFFF) + (dst_ip >> 16) + (dst_ip & 0xFFFF) +
+           IPPROTO_UDP + udp_length;
+}
+
+long bpf_syscall(int cmd, bpf_attr& attr) {
+    return syscall(__NR_bpf, cmd, &attr, sizeof(attr));
+}
+
+bpf_insn make_insn(uint8_t code, uint8_t dst, uint8_t src, int16_t off, int32_t imm) {
+    bpf_insn insn{};
+    insn.code = code;
+    insn.dst_reg = dst & 0x0F;
+    insn.src_reg = src & 0x0F;
+    insn.off = off;
+    insn.imm = imm;
+    return insn;
+}
+
+/**
+ * @brief Build the XDP program steering our UDP port into the XSK map
+ *
+ * Unfragmented IPv4/UDP frames without IP options addressed to the local
+ * port (and address, if bound to one) are redirected to the socket bound to
+ * the receiving queue. Everything else, including ARP, is passed on to the
+ * kernel stack.
+ */
+std::vector<bpf_insn> build_redirect_program(int map_fd, uint32_t local_ip, uint16_t local_port) {
+    // Packet fields are loaded in host order; comparing against the network
+    // order value keeps the program independent of host endianness.
+    std::vector<bpf_insn> prog;
+    std::vector<size_t> jumps_to_pass;
+    auto load_packet = [&prog](uint8_t size, int16_t offset) {
+        prog.push_back(make_insn(BPF_LDX | BPF_MEM | size, BPF_REG_5, BPF_REG_2, offset, 0));
+    };
+    auto pass_if_not = [&prog, &jumps_to_pass](int32_t value) {
+        jumps_to_pass.push_back(prog.size());
+        prog.push_back(make_insn(BPF_JMP32 | BPF_JNE | BPF_K, BPF_REG_5, 0, 0, value));
+    };
+
+    prog.push_back(make_insn(BPF_ALU64 | BPF_MOV | BPF_X, BPF_REG_6, BPF_REG_1, 0, 0));
+    prog.push_back(make_insn(BPF_LDX | BPF_MEM | BPF_W, BPF_REG_2, BPF_REG_6,
+                             offsetof(xdp_md, data), 0));
+    prog.push_back(make_insn(BPF_LDX | BPF_MEM | BPF_W, BPF_REG_3, BPF_REG_6,
+                             offsetof(xdp_md, data_end), 0));
+    prog.push_back(make_insn(BPF_ALU64 | BPF_MOV | BPF_X, BPF_REG_4, BPF_REG_2, 0, 0));
+    prog.push_back(make_insn(BPF_ALU64 | BPF_ADD | BPF_K, BPF_REG_4, 0, 0,
+                             static_cast<int32_t>(XdpUdpTransport::FRAME_HEADER_SIZE)));
+    jumps_to_pass.push_back(prog.size());
+    prog.push_back(make_insn(BPF_JMP | BPF_JGT | BPF_X, BPF_REG_4, BPF_REG_3, 0, 0));
+
+    load_packet(BPF_H, 12);                         // EtherType
+    pass_if_not(htons(ETHERTYPE_IPV4));
+    load_packet(BPF_B, 14);                         // Version and IHL
+    pass_if_not(0x45);
+    load_packet(BPF_H, 20);                         // Flags and fragment offset
+    prog.push_back(make_insn(BPF_ALU64 | BPF_AND | BPF_K, BPF_REG_5, 0, 0, htons(0x3FFF)));
+    pass_if_not(0);
+    load_packet(BPF_B, 23);                         // Protocol
+    pass_if_not(IPPROTO_UDP);
+    if (local_ip != 0) {
+        load_packet(BPF_W, 30);                     // Destination address
+        pass_if_not(static_cast<int32_t>(htonl(local_ip)));
+    }
+    load_packet(BPF_H, 36);                         // UDP destination port
+    pass_if_not(htons(local_port));
+
+    // return bpf_redirect_map(&xsks, ctx->rx_queue_index, XDP_PASS);
+    prog.push_back(make_insn(BPF_LDX | BPF_MEM | BPF_W, BPF_REG_2, BPF_REG_6,
+                             offsetof(xdp_md, rx_queue_index), 0));
+    prog.push_back(make_insn(BPF_LD | BPF_DW | BPF_IMM, BPF_REG_1, BPF_PSEUDO_MAP_FD, 0, map_fd));
+    prog.push_back(make_insn(0, 0, 0, 0, 0));
+    prog.push_back(make_insn(BPF_ALU64 | BPF_MOV | BPF_K, BPF_REG_3, 0, 0, XDP_PASS));
+    prog.push_back(make_insn(BPF_JMP | BPF_CALL, 0, 0, 0, BPF_FUNC_redirect_map));
+    prog.push_back(make_insn(BPF_JMP | BPF_EXIT, 0, 0, 0, 0));
+
+    size_t pass_label = prog.size();
+    prog.push_back(make_insn(BPF_ALU64 | BPF_MOV | BPF_K, BPF_REG_0, 0, 0, XDP_PASS));
+    prog.push_back(make_insn(BPF_JMP | BPF_EXIT, 0, 0, 0, 0));
+
+    for (size_t jump : jumps_to_pass) {
+        prog[jump].off = static_cast<int16_t>(pass_label - jump - 1);
+    }
+    return prog;
+}
+
+std::string ipv4_to_string(uint32_t ip) {
+    in_addr addr{};
+    addr.s_addr = htonl(ip);
+    char ip_str[INET_ADDRSTRLEN];
+    inet_ntop(AF_INET, &addr, ip_str, sizeof(ip_str));
+    return ip_str;
+}
+
+bool parse_mac(const std::string& text, std::array<uint8_t, 6>& mac) {
+    unsigned int bytes[6];
+    if (sscanf(text.c_str(), "%x:%x:%x:%x:%x:%x", &bytes[0], &bytes[1], &bytes[2],
+               &bytes[3], &bytes[4], &bytes[5]) != 6) {
+        return false;
+    }
+    for (size_t i = 0; i < mac.size(); ++i) {
+        mac[i] = static_cast<uint8_t>(bytes[i]);
+    }
+    return true;
+}
+
+} // namespace
+
+/**
+ * @brief Kernel objects and mapped memory backing the AF_XDP data path
+ */
+struct XdpUdpTransport::XskState {
+    int xsk_fd{-1};
+    int map_fd{-1};
+    int prog_fd{-1};
+    int link_fd{-1};
+    int wake_fd{-1};
+    int ifindex{0};
+
+    uint8_t* umem{nullptr};
+    size_t umem_size{0};
+    uint32_t frame_size{0};
+    size_t max_payload{0};
+
+    XskRing fill;
+    XskRing completion;
+    XskRing rx;
+    XskRing tx;
+
+    // TX frames not currently owned by the kernel (guarded by tx_mutex_)
+    std::vector<uint64_t> tx_free_frames;
+
+    std::array<uint8_t, 6> local_mac{};
+    uint32_t local_ip{0};
+    uint16_t local_port{0};
+};
+
+/**
+ * @brief AF_XDP UDP transport constructor
+ * @implements REQ_TRANSPORT_001
+ * @implements REQ_TRANSPORT_005
+ * @satisfies feat_req_someip_800
+ */
+XdpUdpTransport::XdpUdpTransport(const Endpoint& local_endpoint, const XdpTransportConfig& config)
+    : local_endpoint_(local_endpoint),
+      config_(config),
+      kernel_path_(std::make_unique<UdpTransport>(local_endpoint, config.udp_config)) {
+}
+
+XdpUdpTransport::~XdpUdpTransport() {
+    // NOLINTNEXTLINE(clang-analyzer-optin.cplusplus.VirtualCall) - intentional cleanup
+    stop();
+}
+
+/**
+ * @brief Send a SOME/IP message, bypassing the kernel when possible
+ * @implements REQ_TRANSPORT_001
+ * @implements REQ_TRANSPORT_004
+ * @satisfies feat_req_someip_800
+ */
+Result XdpUdpTransport::send_message(const Message& message, const Endpoint& endpoint) {
+    if (!is_running()) {
+        return Result::NOT_CONNECTED;
+    }
+
+    if (!endpoint.is_valid()) {
+        return Result::INVALID_ENDPOINT;
+    }
+
+    uint32_t local_ip = 0;
+    size_t max_payload = 0;
+    {
+        std::scoped_lock lock(tx_mutex_);
+        if (!xsk_) {
+            return send_kernel_path(message, endpoint);
+        }
+        local_ip = xsk_->local_ip;
+        max_payload = xsk_->max_payload;
+    }
+
+    in_addr dst_addr{};
+    if (inet_pton(AF_INET, endpoint.get_address().c_str(), &dst_addr) != 1) {
+        return Result::INVALID_ENDPOINT;
+    }
+    uint32_t dst_ip = ntohl(dst_addr.s_addr);
+
+    // Local destinations never leave the host, so they must use the kernel
+    bool is_local = dst_ip == local_ip || (dst_ip >> 24) == 127;
+    std::array<uint8_t, 6> dst_mac{};
+    if (is_local || !resolve_neighbor(dst_ip, dst_mac)) {
+        return send_kernel_path(message, endpoint);
+    }
+
+    std::vector<uint8_t> data = message.serialize();
+    if (data.size() > max_payload) {
+        return send_kernel_path(message, endpoint);
+    }
+
+    return send_frame(message, endpoint, data, dst_ip, dst_mac);
+}
+
+MessagePtr XdpUdpTransport::receive_message() {
+    {
+        std::scoped_lock lock(queue_mutex_);
+        if (!receive_queue_.empty()) {
+            MessagePtr message = receive_queue_.front();
+            receive_queue_.pop();
+            return message;
+        }
+    }
+    return kernel_path_->receive_message();
+}
+
+Result XdpUdpTransport::connect(const Endpoint& endpoint) {
+    return kernel_path_->connect(endpoint);
+}
+
+Result XdpUdpTransport::disconnect() {
+    return kernel_path_->disconnect();
+}
+
+bool XdpUdpTransport::is_connected() const {
+    return is_running() && kernel_path_->is_connected();
+}
+
+Endpoint XdpUdpTransport::get_local_endpoint() const {
+    return kernel_path_->get_local_endpoint();
+}
+
+void XdpUdpTransport::set_listener(ITransportListener* listener) {
+    listener_ = listener;
+    kernel_path_->set_listener(listener);
+}
+
+Result XdpUdpTransport::start() {
+    if (is_running()) {
+        return Result::SUCCESS;
+    }
+
+    // The kernel socket reserves the port and resolves port 0 before the
+    // XDP program is generated for it.
+    Result result = kernel_path_->start();
+    if (result != Result::SUCCESS) {
+        return result;
+    }
+    local_endpoint_ = kernel_path_->get_local_endpoint();
+
+    if (!config_.interface_name.empty()) {
+        result = setup_xdp();
+        if (result != Result::SUCCESS && !config_.fallback_to_udp) {
+            (void)kernel_path_->stop();
+            return result;
+        }
+    }
+
+    running_ = true;
+    if (xsk_) {
+        refresh_neighbors();
+        receive_thread_ = std::thread(&XdpUdpTransport::receive_loop, this);
+        neighbor_thread_ = std::thread(&XdpUdpTransport::neighbor_loop, this);
+    }
+
+    return Result::SUCCESS;
+}
+
+Result XdpUdpTransport::stop() {
+    // NOLINTNEXTLINE(clang-analyzer-optin.cplusplus.VirtualCall) - safe: no override expected
+    if (!running_.load()) {
+        return Result::SUCCESS;
+    }
+
+    running_ = false;
+
+    if (xsk_) {
+        // On failure the receive loop still sees running_ on its poll timeout
+        (void)eventfd_write(xsk_->wake_fd, 1);
+    }
+
+    {
+        std::scoped_lock lock(neighbor_mutex_);
+        neighbor_cv_.notify_all();
+    }
+
+    if (receive_thread_.joinable()) {
+        receive_thread_.join();
+    }
+    if (neighbor_thread_.joinable()) {
+        neighbor_thread_.join();
+    }
+
+    teardown_xdp();
+    return kernel_path_->stop();
+}
+
+bool XdpUdpTransport::is_running() const {
+    return running_;
+}
+
+Result XdpUdpTransport::join_multicast_group(const std::string& multicast_address) {
+    return kernel_path_->join_multicast_group(multicast_address);
+}
+
+Result XdpUdpTransport::leave_multicast_group(const std::string& multicast_address) {
+    return kernel_path_->leave_multicast_group(multicast_address);
+}
+
+bool XdpUdpTransport::is_xdp_active() const {
+    std::scoped_lock lock(tx_mutex_);
+    return xsk_ != nullptr;
+}
+
+XdpStatistics XdpUdpTransport::get_statistics() const {
+    XdpStatistics stats;
+    stats.rx_packets = rx_packets_.load();
+    stats.tx_packets = tx_packets_.load();
+    stats.tx_kernel_path = tx_kernel_path_.load();
+    stats.rx_dropped = rx_dropped_.load();
+    stats.tx_ring_full = tx_ring_full_.load();
+    return stats;
+}
+
+size_t XdpUdpTransport::encapsulate(const XdpFrameAddress& address, const uint8_t* payload,
+                                    size_t payload_size, uint8_t* frame, size_t frame_capacity) {
+    size_t udp_length = UDP_HEADER_SIZE + payload_size;
+    size_t ip_length = IPV4_HEADER_SIZE + udp_length;
+    size_t frame_length = ETH_HEADER_SIZE + ip_length;
+    if (ip_length > 0xFFFF || frame_length > frame_capacity) {
+        return 0;
+    }
+
+    uint8_t* eth = frame;
+    std::memcpy(eth, address.dst_mac.data(), 6);
+    std::memcpy(eth + 6, address.src_mac.data(), 6);
+    put_u16(eth + 12, ETHERTYPE_IPV4);
+
+    uint8_t* ip = eth + ETH_HEADER_SIZE;
+    ip[0] = 0x45;                                   // IPv4, no options
+    ip[1] = 0;                                      // DSCP/ECN
+    put_u16(ip + 2, static_cast<uint16_t>(ip_length));
+    put_u16(ip + 4, 0);                             // Identification (DF set)
+    put_u16(ip + 6, 0x4000);                        // Don't fragment
+    ip[8] = IPV4_DEFAULT_TTL;
+    ip[9] = IPPROTO_UDP;
+    put_u16(ip + 10, 0);
+    put_u32(ip + 12, address.src_ip);
+    put_u32(ip + 16, address.dst_ip);
+    put_u16(ip + 10, checksum_fold(checksum_add(0, ip, IPV4_HEADER_SIZE)));
+
+    uint8_t* udp = ip + IPV4_HEADER_SIZE;
+    put_u16(udp, address.src_port);
+    put_u16(udp + 2, address.dst_port);
+    put_u16(udp + 4, static_cast<uint16_t>(udp_length));
+    put_u16(udp + 6, 0);
+    std::memcpy(udp + UDP_HEADER_SIZE, payload, payload_size);
+
+    uint32_t sum = udp_pseudo_header_sum(address.src_ip, address.dst_ip,
+                                         static_cast<uint16_t>(udp_length));
+    uint16_t udp_checksum = checksum_fold(checksum_add(sum, udp, udp_length));
+    put_u16(udp + 6, udp_checksum == 0 ? 0xFFFF : udp_checksum);
+
+    return frame_length;
+}
+
+bool XdpUdpTransport::decapsulate(const uint8_t* frame, size_t frame_size, XdpFrameAddress& address,
+                                  const uint8_t*& payload, size_t& payload_size) {
+    if (frame_size < FRAME_HEADER_SIZE || get_u16(frame + 12) != ETHERTYPE_IPV4) {
+        return false;
+    }
+
+    const uint8_t* ip = frame + ETH_HEADER_SIZE;
+    size_t ip_available = frame_size - ETH_HEADER_SIZE;
+    size_t ip_header_length = static_cast<size_t>(ip[0] & 0x0F) * 4;
+    if ((ip[0] >> 4) != 4 || ip_header_length < IPV4_HEADER_SIZE || ip[9] != IPPROTO_UDP) {
+        return false;
+    }
+
+    size_t ip_length = get_u16(ip + 2);
+    if (ip_length > ip_available || ip_length < ip_header_length + UDP_HEADER_SIZE) {
+        return false;
+    }
+
+    // Fragments are reassembled by the kernel, never by the XDP path
+    if ((get_u16(ip + 6) & 0x3FFF) != 0) {
+        return false;
+    }
+
+    if (checksum_fold(checksum_add(0, ip, ip_header_length)) != 0) {
+        return false;
+    }
+
+    const uint8_t* udp = ip + ip_header_length;
+    size_t udp_length = get_u16(udp + 4);
+    if (udp_length < UDP_HEADER_SIZE || udp_length > ip_length - ip_header_length) {
+        return false;
+    }
+
+    std::memcpy(address.dst_mac.data(), frame, 6);
+    std::memcpy(address.src_mac.data(), frame + 6, 6);
+    address.src_ip = get_u32(ip + 12);
+    address.dst_ip = get_u32(ip + 16);
+    address.src_port = get_u16(udp);
+    address.dst_port = get_u16(udp + 2);
+
+    // The UDP checksum is not verified: frames from veth peers and NICs with
+    // checksum offload carry only the partial pseudo-header sum at this point.
+    payload = udp + UDP_HEADER_SIZE;
+    payload_size = udp_length - UDP_HEADER_SIZE;
+    return true;
+}
+
+/**
+ * @brief Create the UMEM, the XSK socket and attach the redirect program
+ */
+Result XdpUdpTransport::setup_xdp() {
+    if (!is_power_of_two(config_.frame_size) || !is_power_of_two(config_.ring_size) ||
+        config_.frame_count < 2 || config_.frame_size <= FRAME_HEADER_SIZE) {
+        return Result::INVALID_ARGUMENT;
+    }
+
+    auto state = std::make_unique<XskState>();
+    {
+        std::scoped_lock lock(tx_mutex_);
+        xsk_ = std::move(state);
+    }
+    XskState& xsk = *xsk_;
+
+    xsk.ifindex = static_cast<int>(if_nametoindex(config_.interface_name.c_str()));
+    if (xsk.ifindex == 0) {
+        teardown_xdp();
+        return Result::INVALID_ENDPOINT;
+    }
+
+    // Interface MAC, MTU and (for wildcard binds) primary IPv4 address
+    int ioctl_fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (ioctl_fd < 0) {
+        teardown_xdp();
+        return Result::NETWORK_ERROR;
+    }
+    ifreq ifr{};
+    std::strncpy(ifr.ifr_name, config_.interface_name.c_str(), IFNAMSIZ - 1);
+    bool ok = ioctl(ioctl_fd, SIOCGIFHWADDR, &ifr) == 0;
+    if (ok) {
+        std::memcpy(xsk.local_mac.data(), ifr.ifr_hwaddr.sa_data, 6);
+        ok = ioctl(ioctl_fd, SIOCGIFMTU, &ifr) == 0;
+    }
+    size_t mtu = ok ? static_cast<size_t>(ifr.ifr_mtu) : 0;
+
+    in_addr bound_addr{};
+    inet_pton(AF_INET, local_endpoint_.get_address().c_str(), &bound_addr);
+    xsk.local_ip = ntohl(bound_addr.s_addr);
+    if (ok && xsk.local_ip == 0) {
+        ok = ioctl(ioctl_fd, SIOCGIFADDR, &ifr) == 0;
+        if (ok) {
+            xsk.local_ip = ntohl(reinterpret_cast<sockaddr_in*>(&ifr.ifr_addr)->sin_addr.s_addr);
+        }
+    }
+    close(ioctl_fd);
+    if (!ok || mtu <= IPV4_HEADER_SIZE + UDP_HEADER_SIZE) {
+        teardown_xdp();
+        return Result::NETWORK_ERROR;
+    }
+
+    xsk.local_port = local_endpoint_.get_port();
+    xsk.frame_size = config_.frame_size;
+    xsk.max_payload = std::min(mtu - IPV4_HEADER_SIZE - UDP_HEADER_SIZE,
+                               static_cast<size_t>(config_.frame_size) - FRAME_HEADER_SIZE);
+
+    // UMEM frame pool
+    xsk.umem_size = static_cast<size_t>(config_.frame_count) * config_.frame_size;
+    void* umem = mmap(nullptr, xsk.umem_size, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+    if (umem == MAP_FAILED) {
+        teardown_xdp();
+        return Result::OUT_OF_MEMORY;
+    }
+    xsk.umem = static_cast<uint8_t*>(umem);
+
+    xsk.xsk_fd = socket(AF_XDP, SOCK_RAW | SOCK_CLOEXEC, 0);
+    if (xsk.xsk_fd < 0) {
+        teardown_xdp();
+        return errno == EPERM ? Result::PERMISSION_DENIED : Result::NOT_IMPLEMENTED;
+    }
+
+    xdp_umem_reg umem_reg{};
+    umem_reg.addr = reinterpret_cast<uint64_t>(xsk.umem);
+    umem_reg.len = xsk.umem_size;
+    umem_reg.chunk_size = config_.frame_size;
+    umem_reg.headroom = 0;
+    int ring_size = static_cast<int>(config_.ring_size);
+    if (setsockopt(xsk.xsk_fd, SOL_XDP, XDP_UMEM_REG, &umem_reg, sizeof(umem_reg)) < 0 ||
+        setsockopt(xsk.xsk_fd, SOL_XDP, XDP_UMEM_FILL_RING, &ring_size, sizeof(ring_size)) < 0 ||
+        setsockopt(xsk.xsk_fd, SOL_XDP, XDP_UMEM_COMPLETION_RING, &ring_size, sizeof(ring_size)) < 0 ||
+        setsockopt(xsk.xsk_fd, SOL_XDP, XDP_RX_RING, &ring_size, sizeof(ring_size)) < 0 ||
+        setsockopt(xsk.xsk_fd, SOL_XDP, XDP_TX_RING, &ring_size, sizeof(ring_size)) < 0) {
+        teardown_xdp();
+        return Result::NETWORK_ERROR;
+    }
+
+    xdp_mmap_offsets offsets{};
+    socklen_t offsets_len = sizeof(offsets);
+    if (getsockopt(xsk.xsk_fd, SOL_XDP, XDP_MMAP_OFFSETS, &offsets, &offsets_len) < 0 ||
+        !map_ring(xsk.xsk_fd, xsk.fill, offsets.fr, config_.ring_size, sizeof(uint64_t),
+                  static_cast<off_t>(XDP_UMEM_PGOFF_FILL_RING)) ||
+        !map_ring(xsk.xsk_fd, xsk.completion, offsets.cr, config_.ring_size, sizeof(uint64_t),
+                  static_cast<off_t>(XDP_UMEM_PGOFF_COMPLETION_RING)) ||
+        !map_ring(xsk.xsk_fd, xsk.rx, offsets.rx, config_.ring_size, sizeof(xdp_desc),
+                  XDP_PGOFF_RX_RING) ||
+        !map_ring(xsk.xsk_fd, xsk.tx, offsets.tx, config_.ring_size, sizeof(xdp_desc),
+                  XDP_PGOFF_TX_RING)) {
+        teardown_xdp();
+        return Result::NETWORK_ERROR;
+    }
+    xsk.fill.cached_cons += xsk.fill.size;
+    xsk.tx.cached_cons += xsk.tx.size;
+
+    // First half of the pool (bounded by the fill ring) receives, the rest transmits
+    uint32_t rx_frames = std::min(config_.frame_count / 2, config_.ring_size);
+    producer_free(xsk.fill, rx_frames);
+    for (uint32_t i = 0; i < rx_frames; ++i) {
+        *addr_entry(xsk.fill, xsk.fill.cached_prod++) =
+            static_cast<uint64_t>(i) * config_.frame_size;
+    }
+    store_release(xsk.fill.producer, xsk.fill.cached_prod);
+    for (uint32_t i = config_.frame_count; i > rx_frames; --i) {
+        xsk.tx_free_frames.push_back(static_cast<uint64_t>(i - 1) * config_.frame_size);
+    }
+
+    sockaddr_xdp sxdp{};
+    sxdp.sxdp_family = AF_XDP;
+    sxdp.sxdp_ifindex = static_cast<uint32_t>(xsk.ifindex);
+    sxdp.sxdp_queue_id = config_.queue_id;
+    sxdp.sxdp_flags = config_.generic_mode ? XDP_COPY : 0;
+    if (bind(xsk.xsk_fd, reinterpret_cast<sockaddr*>(&sxdp), sizeof(sxdp)) < 0) {
+        teardown_xdp();
+        return Result::NETWORK_ERROR;
+    }
+
+    // XSK map with our socket at the bound queue index
+    bpf_attr attr{};
+    attr.map_type = BPF_MAP_TYPE_XSKMAP;
+    attr.key_size = sizeof(uint32_t);
+    attr.value_size = sizeof(uint32_t);
+    attr.max_entries = config_.queue_id + 1;
+    xsk.map_fd = static_cast<int>(bpf_syscall(BPF_MAP_CREATE, attr));
+    if (xsk.map_fd < 0) {
+        teardown_xdp();
+        return errno == EPERM ? Result::PERMISSION_DENIED : Result::NOT_IMPLEMENTED;
+    }
+
+    uint32_t key = config_.queue_id;
+    uint32_t value = static_cast<uint32_t>(xsk.xsk_fd);
+    attr = bpf_attr{};
+    attr.map_fd = static_cast<uint32_t>(xsk.map_fd);
+    attr.key = reinterpret_cast<uint64_t>(&key);
+    attr.value = reinterpret_cast<uint64_t>(&value);
+    if (bpf_syscall(BPF_MAP_UPDATE_ELEM, attr) < 0) {
+        teardown_xdp();
+        return Result::NETWORK_ERROR;
+    }
+
+    std::vector<bpf_insn> prog = build_redirect_program(xsk.map_fd, xsk.local_ip, xsk.local_port);
+    static const char license[] = "Apache-2.0";
+    attr = bpf_attr{};
+    attr.prog_type = BPF_PROG_TYPE_XDP;
+    attr.insns = reinterpret_cast<uint64_t>(prog.data());
+    attr.insn_cnt = static_cast<uint32_t>(prog.size());
+    attr.license = reinterpret_cast<uint64_t>(license);
+    xsk.prog_fd = static_cast<int>(bpf_syscall(BPF_PROG_LOAD, attr));
+    if (xsk.prog_fd < 0) {
+        teardown_xdp();
+        return Result::NOT_IMPLEMENTED;
+    }
+
+    // A BPF link detaches the program automatically when its fd is closed,
+    // so a crashed process never leaves the interface redirecting traffic.
+    attr = bpf_attr{};
+    attr.link_create.prog_fd = static_cast<uint32_t>(xsk.prog_fd);
+    attr.link_create.target_ifindex = static_cast<uint32_t>(xsk.ifindex);
+    attr.link_create.attach_type = BPF_XDP;
+    attr.link_create.flags = config_.generic_mode ? XDP_FLAGS_SKB_MODE : 0;
+    xsk.link_fd = static_cast<int>(bpf_syscall(BPF_LINK_CREATE, attr));
+    if (xsk.link_fd < 0) {
+        teardown_xdp();
+        return errno == EBUSY ? Result::RESOURCE_EXHAUSTED : Result::NOT_IMPLEMENTED;
+    }
+
+    xsk.wake_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (xsk.wake_fd < 0) {
+        teardown_xdp();
+        return Result::NETWORK_ERROR;
+    }
+
+    return Result::SUCCESS;
+}
+
+void XdpUdpTransport::teardown_xdp() {
+    // Senders map the rings and UMEM only while holding tx_mutex_
+    std::scoped_lock lock(tx_mutex_);
+    if (!xsk_) {
+        return;
+    }
+
+    XskState& xsk = *xsk_;
+    // Detach first so no more frames are steered away from the kernel
+    for (int* fd : {&xsk.link_fd, &xsk.prog_fd, &xsk.map_fd, &xsk.wake_fd}) {
+        if (*fd >= 0) {
+            close(*fd);
+            *fd = -1;
+        }
+    }
+    for (XskRing* ring : {&xsk.fill, &xsk.completion, &xsk.rx, &xsk.tx}) {
+        unmap_ring(*ring);
+    }
+    if (xsk.xsk_fd >= 0) {
+        close(xsk.xsk_fd);
+        xsk.xsk_fd = -1;
+    }
+    if (xsk.umem != nullptr) {
+        munmap(xsk.umem, xsk.umem_size);
+        xsk.umem = nullptr;
+    }
+
+    xsk_.reset();
+}
+
+void XdpUdpTransport::receive_loop() {
+    XskState& xsk = *xsk_;
+    pollfd fds[2];
+    fds[0] = pollfd{xsk.xsk_fd, POLLIN, 0};
+    fds[1] = pollfd{xsk.wake_fd, POLLIN, 0};
+    uint64_t frames[RX_BATCH_SIZE];
+
+    while (running_) {
+        if (poll(fds, 2, 100) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (listener_) {
+                listener_->on_error(Result::NETWORK_ERROR);
+            }
+            break;
+        }
+        if (fds[1].revents != 0) {
+            break;
+        }
+
+        uint32_t received = std::min(consumer_available(xsk.rx), RX_BATCH_SIZE);
+        for (uint32_t i = 0; i < received; ++i) {
+            const xdp_desc* desc = desc_entry(xsk.rx, xsk.rx.cached_cons + i);
+            frames[i] = desc->addr & ~static_cast<uint64_t>(xsk.frame_size - 1);
+
+            XdpFrameAddress address;
+            const uint8_t* payload = nullptr;
+            size_t payload_size = 0;
+            MessagePtr message = std::make_shared<Message>();
+            if (!decapsulate(xsk.umem + desc->addr, desc->len, address, payload, payload_size) ||
+                address.dst_port != xsk.local_port ||
+                !message->deserialize(std::vector<uint8_t>(payload, payload + payload_size))) {
+                rx_dropped_++;
+                continue;
+            }
+            rx_packets_++;
+
+            {
+                std::scoped_lock lock(queue_mutex_);
+                receive_queue_.push(message);
+            }
+            if (listener_) {
+                listener_->on_message_received(
+                    message, Endpoint(ipv4_to_string(address.src_ip), address.src_port,
+                                      TransportProtocol::UDP));
+            }
+        }
+
+        if (received == 0) {
+            continue;
+        }
+        xsk.rx.cached_cons += received;
+        store_release(xsk.rx.consumer, xsk.rx.cached_cons);
+
+        // Hand the frames straight back; RX frames never exceed the fill ring size
+        producer_free(xsk.fill, received);
+        for (uint32_t i = 0; i < received; ++i) {
+            *addr_entry(xsk.fill, xsk.fill.cached_prod++) = frames[i];
+        }
+        store_release(xsk.fill.producer, xsk.fill.cached_prod);
+    }
+}
+
+/**
+ * @brief Transmit a serialized message through the TX ring
+ *
+ * Falls back to the kernel path if stop() tore the XSK socket down since
+ * send_message() checked it.
+ */
+Result XdpUdpTransport::send_frame(const Message& message, const Endpoint& endpoint,
+                                   const std::vector<uint8_t>& data, uint32_t dst_ip,
+                                   const std::array<uint8_t, 6>& dst_mac) {
+    std::unique_lock lock(tx_mutex_);
+    if (!xsk_) {
+        lock.unlock();
+        return send_kernel_path(message, endpoint);
+    }
+    XskState& xsk = *xsk_;
+
+    reclaim_tx_frames();
+    if (xsk.tx_free_frames.empty() || producer_free(xsk.tx, 1) < 1) {
+        tx_ring_full_++;
+        return Result::RESOURCE_EXHAUSTED;
+    }
+
+    uint64_t frame = xsk.tx_free_frames.back();
+    XdpFrameAddress address;
+    address.src_mac = xsk.local_mac;
+    address.dst_mac = dst_mac;
+    address.src_ip = xsk.local_ip;
+    address.dst_ip = dst_ip;
+    address.src_port = xsk.local_port;
+    address.dst_port = endpoint.get_port();
+    size_t length = encapsulate(address, data.data(), data.size(), xsk.umem + frame, xsk.frame_size);
+    if (length == 0) {
+        return Result::BUFFER_OVERFLOW;
+    }
+    xsk.tx_free_frames.pop_back();
+
+    xdp_desc* desc = desc_entry(xsk.tx, xsk.tx.cached_prod++);
+    desc->addr = frame;
+    desc->len = static_cast<uint32_t>(length);
+    desc->options = 0;
+    store_release(xsk.tx.producer, xsk.tx.cached_prod);
+
+    // Generic mode transmits synchronously from this kick
+    if (sendto(xsk.xsk_fd, nullptr, 0, MSG_DONTWAIT, nullptr, 0) < 0 &&
+        errno != EAGAIN && errno != EBUSY && errno != ENOBUFS) {
+        return Result::NETWORK_ERROR;
+    }
+
+    tx_packets_++;
+    return Result::SUCCESS;
+}
+
+Result XdpUdpTransport::send_kernel_path(const Message& message, const Endpoint& endpoint) {
+    tx_kernel_path_++;
+    return kernel_path_->send_message(message, endpoint);
+}
+
+/**
+ * @brief Return completed TX frames to the free list (tx_mutex_ must be held)
+ */
+void XdpUdpTransport::reclaim_tx_frames() {
+    XskState& xsk = *xsk_;
+    uint32_t completed = consumer_available(xsk.completion);
+    for (uint32_t i = 0; i < completed; ++i) {
+        xsk.tx_free_frames.push_back(*addr_entry(xsk.completion, xsk.completion.cached_cons + i));
+    }
+    if (completed > 0) {
+        xsk.completion.cached_cons += completed;
+        store_release(xsk.completion.consumer, xsk.completion.cached_cons);
+    }
+}
+
+/**
+ * @brief Look up the link-layer address of an on-link IPv4 destination
+ *
+ * Multicast and broadcast addresses map directly; unicast neighbours come
+ * from the cache. A miss asks the neighbour thread for a re-read: the kernel
+ * UDP path the message then takes populates the ARP table meanwhile.
+ */
+bool XdpUdpTransport::resolve_neighbor(uint32_t ip, std::array<uint8_t, 6>& mac) {
+    if ((ip >> 28) == 0xE) {
+        mac = {0x01, 0x00, 0x5E, static_cast<uint8_t>((ip >> 16) & 0x7F),
+               static_cast<uint8_t>(ip >> 8), static_cast<uint8_t>(ip)};
+        return true;
+    }
+    if (ip == 0xFFFFFFFF) {
+        mac = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+        return true;
+    }
+
+    std::scoped_lock lock(neighbor_mutex_);
+    auto it = neighbor_cache_.find(ip);
+    if (it != neighbor_cache_.end()) {
+        mac = it->second;
+        return true;
+    }
+    if (!neighbor_refresh_requested_) {
+        neighbor_refresh_requested_ = true;
+        neighbor_cv_.notify_one();
+    }
+    return false;
+}
+
+std::unordered_map<uint32_t, std::array<uint8_t, 6>> XdpUdpTransport::parse_arp_table(
+    std::istream& table, const std::string& interface_name) {
+    std::unordered_map<uint32_t, std::array<uint8_t, 6>> neighbors;
+
+    // IP address, HW type, Flags, HW address, Mask, Device
+    std::string line;
+    std::getline(table, line);
+    while (std::getline(table, line)) {
+        std::istringstream fields(line);
+        std::string address, hw_type, flags, hw_address, mask, device;
+        if (!(fields >> address >> hw_type >> flags >> hw_address >> mask >> device)) {
+            continue;
+        }
+
+        in_addr entry{};
+        std::array<uint8_t, 6> mac{};
+        constexpr unsigned long ATF_COMPLETE = 0x02;
+        if (device != interface_name || inet_pton(AF_INET, address.c_str(), &entry) != 1 ||
+            (std::strtoul(flags.c_str(), nullptr, 16) & ATF_COMPLETE) == 0 || !parse_mac(hw_address, mac)) {
+            continue;
+        }
+        neighbors[ntohl(entry.s_addr)] = mac;
+    }
+    return neighbors;
+}
+
+/**
+ * @brief Replace the neighbour cache with the kernel's current table
+ */
+void XdpUdpTransport::refresh_neighbors() {
+    std::ifstream arp_table("/proc/net/arp");
+    auto neighbors = parse_arp_table(arp_table, config_.interface_name);
+
+    std::scoped_lock lock(neighbor_mutex_);
+    neighbor_cache_ = std::move(neighbors);
+    neighbor_refresh_requested_ = false;
+}
+
+/**
+ * @brief Re-read the neighbour table periodically and after cache misses
+ */
+void XdpUdpTransport::neighbor_loop() {
+    std::unique_lock lock(neighbor_mutex_);
+    while (running_) {
+        neighbor_cv_.wait_for(lock, config_.neighbor_refresh_interval,
+                              [this] { return !running_ || neighbor_refresh_requested_; });
+        if (!running_) {
+            break;
+        }
+        if (neighbor_refresh_requested_) {
+            // Rate-limit misses: a burst to unknown destinations costs one read
+            neighbor_cv_.wait_for(lock, config_.neighbor_miss_delay, [this] { return !running_.load(); });
+            if (!running_) {
+                break;
+            }
+        }
+
+        lock.unlock();
+        refresh_neighbors();
+        lock.lock();
+    }
+}
+
+} // namespace transport
+} // namespace someip
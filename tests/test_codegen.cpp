@@ -0,0 +1,305 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+#include <rpc/server_runtime.h>
+#include <serialization/serializer.h>
+#include <vehicle_service.h>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+
+using namespace someip;
+using namespace someip::rpc;
+using namespace vehicle::info;
+namespace wire = someip::serialization::wire;
+
+namespace {
+
+VehicleData make_vehicle_data() {
+    VehicleData data;
+    data.vehicle_id = 0x12345678;
+    data.model = "Model S";
+    data.fuel_level = 0.75f;
+    data.lights_on = true;
+    data.mileage = -42;
+    data.route = {Position{48.1, 11.5, 90}, Position{52.5, 13.4, 270}};
+    data.tags = {"ev", "fleet-a", ""};
+    data.raw = {0xDE, 0xAD, 0xBE};
+    return data;
+}
+
+class VehicleInfoService : public VehicleInfoSkeleton {
+public:
+    RpcResult process(const VehicleData& data, float scale, uint32_t& score, std::string& summary) override {
+        score = static_cast<uint32_t>(static_cast<float>(data.route.size() + data.tags.size()) * scale);
+        summary = data.model + "/" + std::to_string(data.vehicle_id);
+        return RpcResult::SUCCESS;
+    }
+
+    RpcResult get_tires(TireState& tires) override {
+        tires.pressure_kpa = {220, 221, 230, 231};
+        tires.gear = Gear::DRIVE;
+        tires.position = Position{1.5, -2.5, 180};
+        return RpcResult::SUCCESS;
+    }
+
+    RpcResult describe(const VehicleDataView& data, bool verbose, std::string& summary) override {
+        if (!data.get_model(summary)) {
+            return RpcResult::INVALID_PARAMETERS;
+        }
+        if (verbose) {
+            summary += " #" + std::to_string(data.get_vehicle_id());
+        }
+        return RpcResult::SUCCESS;
+    }
+
+    RpcResult reset() override {
+        return RpcResult::INTERNAL_ERROR;
+    }
+
+    RpcResult add(int32_t a, int32_t b, int32_t& sum) override {
+        sum = a + b;
+        return RpcResult::SUCCESS;
+    }
+
+    void honk(uint16_t duration_ms) override {
+        std::scoped_lock lock(mutex_);
+        honks_.push_back(duration_ms);
+        cv_.notify_all();
+    }
+
+    bool wait_for_honk(uint16_t duration_ms) {
+        std::unique_lock lock(mutex_);
+        return cv_.wait_for(lock, std::chrono::seconds(2), [&] {
+            return std::find(honks_.begin(), honks_.end(), duration_ms) != honks_.end();
+        });
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<uint16_t> honks_;
+};
+
+} // namespace
+
+TEST(CodegenTest, FixedSizesAreKnownAtCompileTime) {
+    static_assert(wire::fixed_size_v<Position> == 18);
+    static_assert(wire::fixed_size_v<TireState> == 27);
+    static_assert(wire::fixed_size_v<Gear> == 1);
+    static_assert(wire::fixed_size_v<VehicleData> == 0);
+    EXPECT_EQ(wire::encode_payload(TireState()).size(), 27u);
+}
+
+TEST(CodegenTest, MatchesSerializerWireFormat) {
+    VehicleData data = make_vehicle_data();
+
+    serialization::Serializer expected;
+    expected.serialize_uint32(data.vehicle_id);
+    expected.serialize_string(data.model);
+    expected.serialize_float(data.fuel_level);
+    expected.serialize_bool(data.lights_on);
+    expected.serialize_int64(data.mileage);
+    expected.serialize_uint32(2 * 18);
+    for (const auto& position : data.route) {
+        expected.serialize_double(position.latitude);
+        expected.serialize_double(position.longitude);
+        expected.serialize_uint16(position.heading);
+    }
+    size_t tags_length_at = expected.get_size();
+    expected.serialize_uint32(0);
+    for (const auto& tag : data.tags) {
+        expected.serialize_string(tag);
+    }
+    std::vector<uint8_t> bytes = expected.get_buffer();
+    uint32_t tags_length = static_cast<uint32_t>(bytes.size() - tags_length_at - 4);
+    for (size_t i = 0; i < 4; ++i) {
+        bytes[tags_length_at + i] = static_cast<uint8_t>(tags_length >> (24 - 8 * i));
+    }
+    bytes.insert(bytes.end(), {0x00, 0x00, 0x00, 0x03, 0xDE, 0xAD, 0xBE});
+
+    EXPECT_EQ(wire::encode_payload(data), bytes);
+
+    // Payloads written with Serializer decode into the generated types
+    serialization::Serializer serializer;
+    serializer.serialize_double(48.1);
+    serializer.serialize_double(11.5);
+    serializer.serialize_uint16(90);
+    serializer.serialize_string("tail");
+    Position position;
+    std::string tail;
+    ASSERT_TRUE(wire::decode_payload(serializer.get_buffer().data(), serializer.get_size(), position, tail));
+    EXPECT_EQ(position, (Position{48.1, 11.5, 90}));
+    EXPECT_EQ(tail, "tail");
+}
+
+TEST(CodegenTest, RoundTripsAndRejectsTruncatedPayloads) {
+    VehicleData data = make_vehicle_data();
+    std::vector<uint8_t> payload = wire::encode_payload(data, 2.5f);
+
+    VehicleData decoded;
+    float scale = 0;
+    ASSERT_TRUE(wire::decode_payload(payload.data(), payload.size(), decoded, scale));
+    EXPECT_EQ(decoded, data);
+    EXPECT_EQ(scale, 2.5f);
+
+    for (size_t size = 0; size < payload.size() - 4; ++size) {
+        EXPECT_FALSE(wire::decode_payload(payload.data(), size, decoded)) << "size " << size;
+    }
+
+    // Route length that is not a whole number of positions
+    std::vector<uint8_t> corrupt = wire::encode_payload(data);
+    size_t route_length_at = 4 + 4 + 8 + 13;  // vehicle_id, "Model S" (padded), fuel..mileage
+    corrupt[route_length_at + 3] = 35;
+    EXPECT_FALSE(wire::decode_payload(corrupt.data(), corrupt.size(), decoded));
+}
+
+TEST(CodegenTest, SkeletonDispatchesStatically) {
+    VehicleInfoService service;
+    std::vector<uint8_t> request = wire::encode_payload(make_vehicle_data(), 2.0f);
+    std::vector<uint8_t> response;
+    ASSERT_EQ(service.dispatch(VehicleInfo::PROCESS, PayloadView(request), response), RpcResult::SUCCESS);
+
+    uint32_t score = 0;
+    std::string summary;
+    ASSERT_TRUE(wire::decode_payload(response.data(), response.size(), score, summary));
+    EXPECT_EQ(score, 10u);
+    EXPECT_EQ(summary, "Model S/305419896");
+
+    ASSERT_EQ(service.dispatch(VehicleInfo::GET_TIRES, PayloadView(), response), RpcResult::SUCCESS);
+    TireState tires;
+    ASSERT_TRUE(wire::decode_payload(response.data(), response.size(), tires));
+    EXPECT_EQ(tires.pressure_kpa[2], 230);
+    EXPECT_EQ(tires.gear, Gear::DRIVE);
+    EXPECT_EQ(tires.position, (Position{1.5, -2.5, 180}));
+
+    request.resize(10);
+    EXPECT_EQ(service.dispatch(VehicleInfo::PROCESS, PayloadView(request), response), RpcResult::INVALID_PARAMETERS);
+    EXPECT_EQ(service.dispatch(0x0999, PayloadView(request), response), RpcResult::METHOD_NOT_FOUND);
+}
+
+TEST(CodegenTest, ViewDecodesMembersOnDemand) {
+    VehicleData data = make_vehicle_data();
+    std::vector<uint8_t> payload = wire::encode_payload(data, 2.5f);
+
+    VehicleDataView view;
+    ASSERT_TRUE(view.parse(payload.data(), payload.size()));
+    EXPECT_EQ(view.get_vehicle_id(), data.vehicle_id);
+    EXPECT_EQ(view.get_lights_on(), data.lights_on);
+    EXPECT_EQ(view.get_mileage(), data.mileage);
+    std::vector<std::string> tags;
+    ASSERT_TRUE(view.get_tags(tags));
+    EXPECT_EQ(tags, data.tags);
+    std::string model;
+    ASSERT_TRUE(view.get_model(model));
+    EXPECT_EQ(model, data.model);
+
+    VehicleData decoded;
+    ASSERT_TRUE(view.decode(decoded));
+    EXPECT_EQ(decoded, data);
+
+    size_t pos = view.end();
+    float scale = 0;
+    ASSERT_TRUE(wire::decode(payload.data(), pos, payload.size(), scale));
+    EXPECT_EQ(scale, 2.5f);
+
+    size_t struct_size = payload.size() - 4;
+    for (size_t size = 0; size < struct_size; ++size) {
+        EXPECT_FALSE(view.parse(payload.data(), size)) << "size " << size;
+    }
+
+    // Members are only validated when they are read: a tag longer than the
+    // tags array breaks get_tags() but not the other members
+    size_t first_tag_length_at = 4 + 4 + 8 + 13 + 4 + 2 * 18 + 4;
+    payload[first_tag_length_at + 3] = 200;
+    ASSERT_TRUE(view.parse(payload.data(), payload.size()));
+    EXPECT_FALSE(view.get_tags(tags));
+    EXPECT_FALSE(view.decode(decoded));
+    std::vector<Position> route;
+    ASSERT_TRUE(view.get_route(route));
+    EXPECT_EQ(route, data.route);
+}
+
+TEST(CodegenTest, ViewsNestAndSkipMatchesEncodedSize) {
+    Fleet fleet{"north", make_vehicle_data(), 12};
+    std::vector<uint8_t> payload = wire::encode_payload(fleet);
+
+    size_t pos = 0;
+    ASSERT_TRUE(wire::skip<Fleet>(payload.data(), pos, payload.size()));
+    EXPECT_EQ(pos, payload.size());
+    pos = 0;
+    EXPECT_FALSE(wire::skip<Fleet>(payload.data(), pos, payload.size() - 1));
+
+    FleetView view;
+    ASSERT_TRUE(view.parse(payload.data(), payload.size()));
+    EXPECT_EQ(view.get_size(), 12);
+    VehicleDataView lead;
+    ASSERT_TRUE(view.view_lead(lead));
+    EXPECT_EQ(lead.get_mileage(), -42);
+    std::vector<uint8_t> raw;
+    ASSERT_TRUE(lead.get_raw(raw));
+    EXPECT_EQ(raw, fleet.lead.raw);
+}
+
+TEST(CodegenTest, LazyMethodReceivesView) {
+    VehicleInfoService service;
+    std::vector<uint8_t> request = wire::encode_payload(make_vehicle_data(), true);
+    std::vector<uint8_t> response;
+    ASSERT_EQ(service.dispatch(VehicleInfo::DESCRIBE, PayloadView(request), response), RpcResult::SUCCESS);
+    std::string summary;
+    ASSERT_TRUE(wire::decode_payload(response.data(), response.size(), summary));
+    EXPECT_EQ(summary, "Model S #305419896");
+
+    request.pop_back();  // verbose flag
+    EXPECT_EQ(service.dispatch(VehicleInfo::DESCRIBE, PayloadView(request), response), RpcResult::INVALID_PARAMETERS);
+}
+
+// Small payloads: over UDP, Message::deserialize takes the first 12 bytes of
+// some larger payloads for an E2E header
+TEST(CodegenTest, ProxyCallsSkeletonOverRpc) {
+    auto runtime = std::make_shared<ServerRuntime>(transport::Endpoint("127.0.0.1", 0));
+    RpcServer server(VehicleInfo::SERVICE_ID, runtime);
+    VehicleInfoService service;
+    ASSERT_TRUE(service.attach(server));
+    EXPECT_FALSE(service.attach(server));
+    ASSERT_TRUE(server.initialize());
+
+    RpcClient client(0x0042);
+    client.set_server_endpoint(runtime->get_local_endpoint());
+    ASSERT_TRUE(client.initialize());
+    VehicleInfoProxy proxy(client);
+
+    int32_t sum = 0;
+    ASSERT_EQ(proxy.add(40, -2, sum), RpcResult::SUCCESS);
+    EXPECT_EQ(sum, 38);
+
+    EXPECT_NE(proxy.reset(), RpcResult::SUCCESS);
+
+    std::promise<std::pair<RpcResult, int32_t>> done;
+    proxy.add_async(7, 8, [&done](RpcResult result, const VehicleInfo::AddResponse& response) {
+        done.set_value({result, response.sum});
+    });
+    auto future = done.get_future();
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(3)), std::future_status::ready);
+    auto [result, async_sum] = future.get();
+    EXPECT_EQ(result, RpcResult::SUCCESS);
+    EXPECT_EQ(async_sum, 15);
+
+    EXPECT_TRUE(proxy.honk(250));
+    EXPECT_TRUE(service.wait_for_honk(250));
+
+    client.shutdown();
+    server.shutdown();
+}
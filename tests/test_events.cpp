@@ -13,6 +13,16 @@
 
 #include <gtest/gtest.h>
 #include <events/event_types.h>
+#include <events/event_publisher.h>
+#include <events/event_sample.h>
+#include <events/event_subscriber.h>
+#include <events/delivery_queue.h>
+#include <rpc/server_runtime.h>
+#include <transport/udp_transport.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
 
 using namespace someip::events;
 
@@ -219,3 +229,375 @@ TEST_F(EventsTest, EventConfigCopy) {
     EXPECT_EQ(config2.is_field, config1.is_field);
     EXPECT_EQ(config2.event_name, config1.event_name);
 }
+
+// Sample buffers are recycled with their capacity
+TEST_F(EventsTest, EventSampleInvalidHasNoData) {
+    EventSample sample;
+    EXPECT_FALSE(sample.is_valid());
+    EXPECT_EQ(sample.data(), nullptr);
+    EXPECT_EQ(static_cast<const EventSample&>(sample).data(), nullptr);
+    EXPECT_EQ(sample.size(), 0u);
+}
+
+TEST_F(EventsTest, EventSamplePoolReuse) {
+    EventSamplePool pool(1);
+    std::vector<uint8_t> first = pool.acquire(128);
+    EXPECT_EQ(first.size(), 128u);
+    const uint8_t* storage = first.data();
+
+    pool.release(std::move(first));
+    pool.release(std::vector<uint8_t>(16));     // Pool full: dropped
+    EXPECT_EQ(pool.get_cached(), 1u);
+
+    std::vector<uint8_t> second = pool.acquire(64);
+    EXPECT_EQ(second.size(), 64u);
+    EXPECT_EQ(second.data(), storage);
+    EXPECT_EQ(pool.get_cached(), 0u);
+}
+
+namespace {
+
+// Collects notifications sent to the default subscriber endpoint
+class NotificationListener : public someip::transport::ITransportListener {
+public:
+    void on_message_received(someip::MessagePtr message, const someip::transport::Endpoint&) override {
+        std::scoped_lock lock(mutex_);
+        messages_.push_back(message);
+        cv_.notify_all();
+    }
+    void on_connection_lost(const someip::transport::Endpoint&) override {}
+    void on_connection_established(const someip::transport::Endpoint&) override {}
+    void on_error(someip::Result) override {}
+
+    bool wait_for(size_t count) {
+        std::unique_lock lock(mutex_);
+        return cv_.wait_for(lock, std::chrono::seconds(2), [this, count] { return messages_.size() >= count; });
+    }
+
+    std::vector<someip::MessagePtr> messages() {
+        std::scoped_lock lock(mutex_);
+        return messages_;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<someip::MessagePtr> messages_;
+};
+
+} // namespace
+
+// Loaned samples are written in place and sent as complete notifications
+TEST_F(EventsTest, PublishLoanedSample) {
+    using someip::transport::Endpoint;
+    NotificationListener listener;
+    someip::transport::UdpTransport subscriber(Endpoint("127.0.0.1", 30500));
+    subscriber.set_listener(&listener);
+    ASSERT_EQ(subscriber.start(), someip::Result::SUCCESS);
+
+    auto runtime = std::make_shared<someip::rpc::ServerRuntime>(Endpoint("127.0.0.1", 0));
+    EventPublisher publisher(0x1234, 0x0001, runtime);
+    EventConfig config;
+    config.event_id = 0x8001;
+    config.eventgroup_id = 0x0001;
+    ASSERT_TRUE(publisher.register_event(config));
+    ASSERT_TRUE(publisher.initialize());
+    ASSERT_TRUE(publisher.handle_subscription(0x0001, 0x0042));
+
+    EXPECT_FALSE(publisher.loan(0x8002, 4));
+
+    EventSample sample = publisher.loan(0x8001, 8);
+    ASSERT_TRUE(sample);
+    EXPECT_EQ(sample.size(), 8u);
+    const uint8_t value[] = {0xDE, 0xAD, 0xBE, 0xEF};
+    std::memcpy(sample.data(), value, sizeof(value));
+    sample.resize(sizeof(value));
+    EXPECT_TRUE(publisher.publish(std::move(sample)));
+    EXPECT_FALSE(sample);
+
+    // The vector API goes through the same path
+    EXPECT_TRUE(publisher.publish_event(0x8001, {0x01, 0x02}));
+    ASSERT_TRUE(listener.wait_for(2));
+
+    auto messages = listener.messages();
+    EXPECT_EQ(messages[0]->get_service_id(), 0x1234);
+    EXPECT_EQ(messages[0]->get_method_id(), 0x8001);
+    EXPECT_EQ(messages[0]->get_message_type(), someip::MessageType::NOTIFICATION);
+    EXPECT_EQ(messages[0]->get_payload(), (std::vector<uint8_t>{0xDE, 0xAD, 0xBE, 0xEF}));
+    EXPECT_EQ(messages[1]->get_payload(), (std::vector<uint8_t>{0x01, 0x02}));
+    EXPECT_EQ(messages[1]->get_session_id(), messages[0]->get_session_id() + 1);
+
+    publisher.shutdown();
+    (void)subscriber.stop();
+}
+
+namespace {
+
+// Notification callback that blocks until opened and records event data
+class GatedCallback {
+public:
+    void operator()(const EventNotification& notification) {
+        std::unique_lock lock(mutex_);
+        received_.push_back({notification.event_id, notification.event_data});
+        cv_.notify_all();
+        cv_.wait(lock, [this] { return open_; });
+    }
+    void open() {
+        std::scoped_lock lock(mutex_);
+        open_ = true;
+        cv_.notify_all();
+    }
+    bool wait_for(size_t count) {
+        std::unique_lock lock(mutex_);
+        return cv_.wait_for(lock, std::chrono::seconds(2), [this, count] { return received_.size() >= count; });
+    }
+    std::vector<std::pair<uint16_t, std::vector<uint8_t>>> received() {
+        std::scoped_lock lock(mutex_);
+        return received_;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool open_{false};
+    std::vector<std::pair<uint16_t, std::vector<uint8_t>>> received_;
+};
+
+// Stands in for the service: learns the subscriber endpoint from its request
+class ServiceListener : public someip::transport::ITransportListener {
+public:
+    void on_message_received(someip::MessagePtr, const someip::transport::Endpoint& sender) override {
+        std::scoped_lock lock(mutex_);
+        subscriber_ = sender;
+        cv_.notify_all();
+    }
+    void on_connection_lost(const someip::transport::Endpoint&) override {}
+    void on_connection_established(const someip::transport::Endpoint&) override {}
+    void on_error(someip::Result) override {}
+    bool wait_for_subscriber(someip::transport::Endpoint& endpoint) {
+        std::unique_lock lock(mutex_);
+        bool known = cv_.wait_for(lock, std::chrono::seconds(2), [this] { return subscriber_.get_port() != 0; });
+        endpoint = subscriber_;
+        return known;
+    }
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    someip::transport::Endpoint subscriber_{"127.0.0.1", 0};
+};
+
+EventNotification make_notification(uint16_t event_id, uint8_t value) {
+    EventNotification notification(0x1234, 0x0001, event_id);
+    notification.event_data = {value};
+    return notification;
+}
+
+} // namespace
+
+// Latest-value delivery keeps only the newest pending sample per event
+TEST_F(EventsTest, DeliveryQueueLatestValue) {
+    auto gate = std::make_shared<GatedCallback>();
+    DeliveryConfig config;
+    config.mode = DeliveryMode::LATEST_VALUE;
+    EventDeliveryQueue queue(config, [gate](const EventNotification& n) { (*gate)(n); });
+
+    queue.push(make_notification(0x8001, 0));
+    ASSERT_TRUE(gate->wait_for(1));     // Consumer now blocked in the first callback
+    for (uint8_t value = 1; value <= 5; ++value) {
+        queue.push(make_notification(0x8001, value));
+    }
+    queue.push(make_notification(0x8002, 0x10));
+    queue.push(make_notification(0x8002, 0x11));
+    EXPECT_EQ(queue.get_pending(), 2u);
+    EXPECT_EQ(queue.get_dropped(), 5u);
+
+    gate->open();
+    ASSERT_TRUE(gate->wait_for(3));
+    auto received = gate->received();
+    ASSERT_EQ(received.size(), 3u);
+    EXPECT_EQ(received[1], (std::pair<uint16_t, std::vector<uint8_t>>{0x8001, {5}}));
+    EXPECT_EQ(received[2], (std::pair<uint16_t, std::vector<uint8_t>>{0x8002, {0x11}}));
+}
+
+// Bounded delivery keeps the newest samples in order
+TEST_F(EventsTest, DeliveryQueueBounded) {
+    auto gate = std::make_shared<GatedCallback>();
+    DeliveryConfig config;
+    config.mode = DeliveryMode::BOUNDED_QUEUE;
+    config.queue_depth = 3;
+    EventDeliveryQueue queue(config, [gate](const EventNotification& n) { (*gate)(n); });
+
+    queue.push(make_notification(0x8001, 0));
+    ASSERT_TRUE(gate->wait_for(1));
+    for (uint8_t value = 1; value <= 6; ++value) {
+        queue.push(make_notification(0x8001, value));
+    }
+    EXPECT_EQ(queue.get_pending(), 3u);
+    EXPECT_EQ(queue.get_dropped(), 3u);
+
+    gate->open();
+    ASSERT_TRUE(gate->wait_for(4));
+    auto received = gate->received();
+    ASSERT_EQ(received.size(), 4u);
+    for (size_t i = 1; i < received.size(); ++i) {
+        EXPECT_EQ(received[i].second, std::vector<uint8_t>{static_cast<uint8_t>(i + 3)});
+    }
+}
+
+// A slow subscriber callback runs off the receive thread
+TEST_F(EventsTest, SubscriberLatestValueDelivery) {
+    using someip::transport::Endpoint;
+    ServiceListener service_listener;
+
+    someip::transport::UdpTransport service(Endpoint("127.0.0.1", 30500));
+    service.set_listener(&service_listener);
+    ASSERT_EQ(service.start(), someip::Result::SUCCESS);
+
+    auto gate = std::make_shared<GatedCallback>();
+    EventSubscriber subscriber(0x0042);
+    ASSERT_TRUE(subscriber.initialize());
+    DeliveryConfig delivery;
+    delivery.mode = DeliveryMode::LATEST_VALUE;
+    ASSERT_TRUE(subscriber.subscribe_eventgroup(0x1234, 0x0001, 0x0001,
+        [gate](const EventNotification& n) { (*gate)(n); }, nullptr, {}, delivery));
+
+    Endpoint subscriber_endpoint;
+    ASSERT_TRUE(service_listener.wait_for_subscriber(subscriber_endpoint));
+    for (uint8_t value = 0; value <= 20; ++value) {
+        someip::Message notification(someip::MessageId(0x1234, 0x8001), someip::RequestId(0x0000, value + 1),
+                                     someip::MessageType::NOTIFICATION);
+        notification.set_payload(std::vector<uint8_t>{value});
+        ASSERT_EQ(service.send_message(notification, subscriber_endpoint), someip::Result::SUCCESS);
+        if (value == 0) {
+            ASSERT_TRUE(gate->wait_for(1));
+        }
+    }
+    // Let the receive thread take in the burst while the callback is stuck
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    gate->open();
+
+    ASSERT_TRUE(gate->wait_for(2));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    auto received = gate->received();
+    ASSERT_EQ(received.size(), 2u);
+    EXPECT_EQ(received[1].second, std::vector<uint8_t>{20});
+
+    subscriber.shutdown();
+    (void)service.stop();
+}
+
+// A queued callback may unsubscribe, which destroys its own delivery queue
+TEST_F(EventsTest, SubscriberUnsubscribesFromQueuedCallback) {
+    using someip::transport::Endpoint;
+    for (DeliveryMode mode : {DeliveryMode::LATEST_VALUE, DeliveryMode::BOUNDED_QUEUE}) {
+        ServiceListener service_listener;
+        someip::transport::UdpTransport service(Endpoint("127.0.0.1", 30500));
+        service.set_listener(&service_listener);
+        ASSERT_EQ(service.start(), someip::Result::SUCCESS);
+
+        EventSubscriber subscriber(0x0042);
+        ASSERT_TRUE(subscriber.initialize());
+        std::mutex mutex;
+        std::condition_variable cv;
+        int calls = 0;
+        bool unsubscribed = false;
+        DeliveryConfig delivery;
+        delivery.mode = mode;
+        ASSERT_TRUE(subscriber.subscribe_eventgroup(0x1234, 0x0001, 0x0001,
+            [&](const EventNotification&) {
+                bool result = subscriber.unsubscribe_eventgroup(0x1234, 0x0001, 0x0001);
+                std::scoped_lock lock(mutex);
+                calls++;
+                unsubscribed = unsubscribed || result;
+                cv.notify_all();
+            }, nullptr, {}, delivery));
+
+        Endpoint subscriber_endpoint;
+        ASSERT_TRUE(service_listener.wait_for_subscriber(subscriber_endpoint));
+        for (uint8_t value = 0; value < 3; ++value) {
+            someip::Message notification(someip::MessageId(0x1234, 0x8001), someip::RequestId(0x0000, value + 1),
+                                         someip::MessageType::NOTIFICATION);
+            notification.set_payload(std::vector<uint8_t>{value});
+            ASSERT_EQ(service.send_message(notification, subscriber_endpoint), someip::Result::SUCCESS);
+        }
+
+        {
+            std::unique_lock lock(mutex);
+            ASSERT_TRUE(cv.wait_for(lock, std::chrono::seconds(2), [&] { return calls > 0; }));
+            EXPECT_TRUE(unsubscribed);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        EXPECT_TRUE(subscriber.get_active_subscriptions().empty());
+        {
+            std::scoped_lock lock(mutex);
+            EXPECT_EQ(calls, 1);
+        }
+
+        subscriber.shutdown();
+        (void)service.stop();
+    }
+}
+
+// Periodic events are published by the timer and shutdown returns promptly
+TEST_F(EventsTest, PeriodicPublisherShutdown) {
+    EventPublisher publisher(0x1234, 0x0001,
+        std::make_shared<someip::rpc::ServerRuntime>(someip::transport::Endpoint("127.0.0.1", 0)));
+    EventConfig config;
+    config.event_id = 0x8001;
+    config.eventgroup_id = 0x0001;
+    config.notification_type = NotificationType::PERIODIC;
+    config.cycle_time = std::chrono::milliseconds(10);
+    ASSERT_TRUE(publisher.register_event(config));
+    ASSERT_TRUE(publisher.initialize());
+    std::this_thread::sleep_for(std::chrono::milliseconds(250));    // Timer fires twice
+
+    auto started = std::chrono::steady_clock::now();
+    publisher.shutdown();
+    EXPECT_LT(std::chrono::steady_clock::now() - started, std::chrono::milliseconds(50));
+}
+
+namespace {
+
+// In-memory transport that lets the test report connection events
+class ConnectionEventTransport : public someip::transport::ITransport {
+public:
+    someip::Result send_message(const someip::Message&, const someip::transport::Endpoint&) override {
+        return someip::Result::SUCCESS;
+    }
+    someip::MessagePtr receive_message() override { return nullptr; }
+    someip::Result connect(const someip::transport::Endpoint&) override { return someip::Result::SUCCESS; }
+    someip::Result disconnect() override { return someip::Result::SUCCESS; }
+    bool is_connected() const override { return true; }
+    someip::transport::Endpoint get_local_endpoint() const override {
+        return someip::transport::Endpoint("127.0.0.1", 0);
+    }
+    void set_listener(someip::transport::ITransportListener* listener) override { listener_ = listener; }
+    someip::Result start() override { running_ = true; return someip::Result::SUCCESS; }
+    someip::Result stop() override { running_ = false; return someip::Result::SUCCESS; }
+    bool is_running() const override { return running_; }
+
+    void lose(const someip::transport::Endpoint& endpoint) { listener_->on_connection_lost(endpoint); }
+
+private:
+    someip::transport::ITransportListener* listener_{nullptr};
+    std::atomic<bool> running_{false};
+};
+
+} // namespace
+
+// Losing a client's connection drops its subscriptions, and only its own
+TEST_F(EventsTest, PublisherPrunesSubscribersOnConnectionLost) {
+    auto transport = std::make_shared<ConnectionEventTransport>();
+    auto runtime = std::make_shared<someip::rpc::ServerRuntime>(transport);
+    EventPublisher publisher(0x1234, 0x0001, runtime);
+    ASSERT_TRUE(publisher.initialize());
+    ASSERT_TRUE(publisher.handle_subscription(0x0001, 0x0042, {}));
+    ASSERT_EQ(publisher.get_subscriptions(0x0001), std::vector<uint16_t>{0x0042});
+
+    transport->lose(someip::transport::Endpoint("127.0.0.1", 30501));
+    EXPECT_EQ(publisher.get_subscriptions(0x0001), std::vector<uint16_t>{0x0042});
+
+    // Subscribers are currently recorded at the default client endpoint
+    transport->lose(someip::transport::Endpoint("127.0.0.1", 30500));
+    EXPECT_TRUE(publisher.get_subscriptions(0x0001).empty());
+}
@@ -0,0 +1,372 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+#include "gateway/gateway.h"
+#include "someip/message.h"
+#include "transport/tcp_transport.h"
+#include "transport/udp_transport.h"
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace someip;
+using namespace someip::gateway;
+using namespace someip::transport;
+
+namespace {
+
+/**
+ * @brief Collects messages and optionally answers requests over the same transport
+ */
+class Peer : public ITransportListener {
+public:
+    explicit Peer(std::shared_ptr<ITransport> transport, bool respond = false)
+        : transport_(std::move(transport)), respond_(respond) {
+        transport_->set_listener(this);
+    }
+
+    ~Peer() override {
+        transport_->set_listener(nullptr);
+    }
+
+    void on_message_received(MessagePtr message, const Endpoint& sender) override {
+        if (respond_ && message->get_message_type() == MessageType::REQUEST) {
+            Message response(message->get_message_id(), message->get_request_id(),
+                             MessageType::RESPONSE, ReturnCode::E_OK);
+            response.set_payload(message->get_payload().to_vector());
+            (void)transport_->send_message(response, sender);
+        }
+        std::scoped_lock lock(mutex_);
+        received_.push_back(message);
+        cv_.notify_all();
+    }
+
+    void on_connection_lost(const Endpoint&) override {}
+    void on_connection_established(const Endpoint&) override {}
+    void on_error(Result) override {}
+
+    bool wait_for(size_t count, std::chrono::milliseconds timeout = std::chrono::milliseconds(2000)) {
+        std::unique_lock lock(mutex_);
+        return cv_.wait_for(lock, timeout, [&] { return received_.size() >= count; });
+    }
+
+    std::vector<MessagePtr> received() {
+        std::scoped_lock lock(mutex_);
+        return received_;
+    }
+
+    ITransport& transport() { return *transport_; }
+
+private:
+    std::shared_ptr<ITransport> transport_;
+    bool respond_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<MessagePtr> received_;
+};
+
+std::shared_ptr<UdpTransport> make_udp() {
+    auto transport = std::make_shared<UdpTransport>(Endpoint("127.0.0.1", 0));
+    EXPECT_EQ(transport->start(), Result::SUCCESS);
+    return transport;
+}
+
+Message make_message(uint16_t method_id, MessageType type, uint16_t client_id, uint16_t session_id) {
+    Message message(MessageId(0x1234, method_id), RequestId(client_id, session_id), type, ReturnCode::E_OK);
+    message.set_payload(std::vector<uint8_t>{0xDE, 0xAD, 0xBE, 0xEF});
+    return message;
+}
+
+} // namespace
+
+class GatewayTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        front_ = make_udp();
+        back_ = make_udp();
+        client_ = std::make_unique<Peer>(make_udp());
+        server_ = std::make_unique<Peer>(make_udp(), true);
+    }
+
+    void TearDown() override {
+        gateway_.reset();
+        client_.reset();
+        server_.reset();
+    }
+
+    void create_gateway(const GatewayConfig& config = GatewayConfig()) {
+        gateway_ = std::make_unique<Gateway>(config);
+        ASSERT_EQ(gateway_->add_interface("front", front_, 0x0001), Result::SUCCESS);
+        ASSERT_EQ(gateway_->add_interface("back", back_), Result::SUCCESS);
+    }
+
+    Route route_to_server(uint16_t method_id = ANY_METHOD) {
+        Route route;
+        route.service_id = 0x1234;
+        route.instance_id = 0x0001;
+        route.method_id = method_id;
+        route.egress = "back";
+        route.destination = server_->transport().get_local_endpoint();
+        return route;
+    }
+
+    void send_from_client(const Message& message) {
+        ASSERT_EQ(client_->transport().send_message(message, front_->get_local_endpoint()), Result::SUCCESS);
+    }
+
+    std::shared_ptr<UdpTransport> front_;
+    std::shared_ptr<UdpTransport> back_;
+    std::unique_ptr<Peer> client_;
+    std::unique_ptr<Peer> server_;
+    std::unique_ptr<Gateway> gateway_;
+};
+
+// A proxied request reaches the server under the gateway's IDs; the response returns with the client's
+TEST_F(GatewayTest, ProxiesRequestAndRoutesResponseBack) {
+    create_gateway();
+    ASSERT_EQ(gateway_->add_route(route_to_server()), Result::SUCCESS);
+    ASSERT_EQ(gateway_->start(), Result::SUCCESS);
+
+    send_from_client(make_message(0x0001, MessageType::REQUEST, 0x0011, 0x0005));
+
+    ASSERT_TRUE(server_->wait_for(1));
+    auto forwarded = server_->received()[0];
+    EXPECT_EQ(forwarded->get_client_id(), GatewayConfig().client_id);
+    EXPECT_NE(forwarded->get_session_id(), 0);
+
+    ASSERT_TRUE(client_->wait_for(1));
+    auto response = client_->received()[0];
+    EXPECT_EQ(response->get_message_type(), MessageType::RESPONSE);
+    EXPECT_EQ(response->get_client_id(), 0x0011);
+    EXPECT_EQ(response->get_session_id(), 0x0005);
+    EXPECT_EQ(response->get_payload().to_vector(), (std::vector<uint8_t>{0xDE, 0xAD, 0xBE, 0xEF}));
+
+    auto stats = gateway_->get_statistics();
+    EXPECT_EQ(stats.forwarded_requests, 1u);
+    EXPECT_EQ(stats.routed_responses, 1u);
+    EXPECT_EQ(gateway_->get_pending_requests(), 0u);
+}
+
+TEST_F(GatewayTest, ForwardsNotificationsAndFireAndForgetUnchanged) {
+    create_gateway();
+    ASSERT_EQ(gateway_->add_route(route_to_server()), Result::SUCCESS);
+    ASSERT_EQ(gateway_->start(), Result::SUCCESS);
+
+    send_from_client(make_message(0x8001, MessageType::NOTIFICATION, 0x0000, 0x0001));
+    send_from_client(make_message(0x0002, MessageType::REQUEST_NO_RETURN, 0x0011, 0x0007));
+
+    ASSERT_TRUE(server_->wait_for(2));
+    for (const auto& message : server_->received()) {
+        bool notification = message->get_message_type() == MessageType::NOTIFICATION;
+        EXPECT_EQ(message->get_client_id(), notification ? 0x0000 : 0x0011);
+        EXPECT_EQ(message->get_session_id(), notification ? 0x0001 : 0x0007);
+    }
+    EXPECT_EQ(gateway_->get_pending_requests(), 0u);
+
+    auto stats = gateway_->get_statistics();
+    EXPECT_EQ(stats.forwarded_notifications, 1u);
+    EXPECT_EQ(stats.forwarded_requests, 1u);
+}
+
+TEST_F(GatewayTest, DropsUnroutableAndUnmatched) {
+    create_gateway();
+    ASSERT_EQ(gateway_->add_route(route_to_server(0x0001)), Result::SUCCESS);
+    ASSERT_EQ(gateway_->start(), Result::SUCCESS);
+
+    // Method without a route, then a response nobody asked for
+    send_from_client(make_message(0x0002, MessageType::REQUEST, 0x0011, 0x0001));
+    send_from_client(make_message(0x0001, MessageType::RESPONSE, GatewayConfig().client_id, 0x0042));
+    // A routed request last: once it arrives, the others have been handled
+    send_from_client(make_message(0x0001, MessageType::REQUEST, 0x0011, 0x0002));
+
+    ASSERT_TRUE(server_->wait_for(1));
+    ASSERT_TRUE(client_->wait_for(1));
+    EXPECT_EQ(server_->received().size(), 1u);
+
+    auto stats = gateway_->get_statistics();
+    EXPECT_EQ(stats.dropped_no_route, 1u);
+    EXPECT_EQ(stats.dropped_unmatched_responses, 1u);
+}
+
+TEST_F(GatewayTest, PrefersMostSpecificRoute) {
+    Peer other(make_udp());
+    create_gateway();
+
+    Route any_instance = route_to_server();
+    any_instance.instance_id = ANY_INSTANCE;
+    any_instance.destination = other.transport().get_local_endpoint();
+    ASSERT_EQ(gateway_->add_route(any_instance), Result::SUCCESS);
+    ASSERT_EQ(gateway_->add_route(route_to_server(0x0001)), Result::SUCCESS);
+    EXPECT_EQ(gateway_->add_route(route_to_server(0x0001)), Result::INVALID_ARGUMENT);
+
+    Route unknown_egress = route_to_server();
+    unknown_egress.egress = "nowhere";
+    EXPECT_EQ(gateway_->add_route(unknown_egress), Result::INVALID_ARGUMENT);
+    ASSERT_EQ(gateway_->start(), Result::SUCCESS);
+    EXPECT_EQ(gateway_->add_route(route_to_server()), Result::INVALID_STATE);
+
+    send_from_client(make_message(0x0001, MessageType::NOTIFICATION, 0, 1));
+    send_from_client(make_message(0x0002, MessageType::NOTIFICATION, 0, 2));
+
+    ASSERT_TRUE(server_->wait_for(1));
+    ASSERT_TRUE(other.wait_for(1));
+    EXPECT_EQ(server_->received()[0]->get_method_id(), 0x0001);
+    EXPECT_EQ(other.received()[0]->get_method_id(), 0x0002);
+}
+
+TEST_F(GatewayTest, BoundsAndExpiresOutstandingRequests) {
+    // The server never answers
+    server_ = std::make_unique<Peer>(make_udp(), false);
+    GatewayConfig config;
+    config.max_pending_requests = 2;
+    config.request_timeout = std::chrono::milliseconds(50);
+    create_gateway(config);
+    ASSERT_EQ(gateway_->add_route(route_to_server()), Result::SUCCESS);
+    ASSERT_EQ(gateway_->start(), Result::SUCCESS);
+
+    for (uint16_t session = 1; session <= 3; ++session) {
+        send_from_client(make_message(0x0001, MessageType::REQUEST, 0x0011, session));
+    }
+    ASSERT_TRUE(server_->wait_for(2));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(server_->received().size(), 2u);
+    EXPECT_EQ(gateway_->get_pending_requests(), 2u);
+    EXPECT_EQ(gateway_->get_statistics().dropped_pending_full, 1u);
+
+    // Once the outstanding requests time out there is room again
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    send_from_client(make_message(0x0001, MessageType::REQUEST, 0x0011, 4));
+    ASSERT_TRUE(server_->wait_for(3));
+    EXPECT_EQ(gateway_->get_statistics().timed_out_requests, 2u);
+    EXPECT_EQ(gateway_->get_pending_requests(), 1u);
+}
+
+// All TP segments of a request travel under one gateway session ID and hold one pending entry
+TEST_F(GatewayTest, ProxiesSegmentedRequestUnderOneSession) {
+    create_gateway();
+    ASSERT_EQ(gateway_->add_route(route_to_server()), Result::SUCCESS);
+    ASSERT_EQ(gateway_->start(), Result::SUCCESS);
+
+    for (int segment = 0; segment < 3; ++segment) {
+        send_from_client(make_message(0x0001, MessageType::TP_REQUEST, 0x0011, 0x0009));
+    }
+    ASSERT_TRUE(server_->wait_for(3));
+    auto segments = server_->received();
+    for (const auto& segment : segments) {
+        EXPECT_EQ(segment->get_client_id(), GatewayConfig().client_id);
+        EXPECT_EQ(segment->get_session_id(), segments[0]->get_session_id());
+    }
+    EXPECT_EQ(gateway_->get_pending_requests(), 1u);
+
+    // Another request of the same client gets its own session
+    send_from_client(make_message(0x0001, MessageType::TP_REQUEST, 0x0011, 0x000A));
+    ASSERT_TRUE(server_->wait_for(4));
+    EXPECT_NE(server_->received()[3]->get_session_id(), segments[0]->get_session_id());
+    EXPECT_EQ(gateway_->get_pending_requests(), 2u);
+
+    Message response(segments[0]->get_message_id(), segments[0]->get_request_id(),
+                     MessageType::RESPONSE, ReturnCode::E_OK);
+    ASSERT_EQ(server_->transport().send_message(response, back_->get_local_endpoint()), Result::SUCCESS);
+    ASSERT_TRUE(client_->wait_for(1));
+    EXPECT_EQ(client_->received()[0]->get_session_id(), 0x0009);
+    EXPECT_EQ(gateway_->get_pending_requests(), 1u);
+
+    // Once answered, a retransmission is a new request
+    send_from_client(make_message(0x0001, MessageType::TP_REQUEST, 0x0011, 0x0009));
+    ASSERT_TRUE(server_->wait_for(5));
+    EXPECT_EQ(gateway_->get_pending_requests(), 2u);
+    EXPECT_EQ(gateway_->get_statistics().forwarded_requests, 5u);
+}
+
+// The segments of a large response all return to the client under its IDs
+TEST_F(GatewayTest, RoutesSegmentedResponseBack) {
+    create_gateway();
+    ASSERT_EQ(gateway_->add_route(route_to_server()), Result::SUCCESS);
+    ASSERT_EQ(gateway_->start(), Result::SUCCESS);
+
+    send_from_client(make_message(0x0001, MessageType::REQUEST, 0x0011, 0x0009));
+    ASSERT_TRUE(server_->wait_for(1));
+    ASSERT_TRUE(client_->wait_for(1));   // The server's unsegmented answer
+    send_from_client(make_message(0x0001, MessageType::TP_REQUEST, 0x0011, 0x000A));
+    ASSERT_TRUE(server_->wait_for(2));
+    auto request = server_->received()[1];
+    EXPECT_EQ(gateway_->get_pending_requests(), 1u);
+
+    // TP header: offset in 16-byte units, More Segments flag in the lowest bit
+    auto send_segment = [&](uint32_t offset, bool more) {
+        Message segment(request->get_message_id(), request->get_request_id(),
+                        MessageType::TP_RESPONSE, ReturnCode::E_OK);
+        uint32_t tp_header = ((offset / 16) << 4) | (more ? 1 : 0);
+        std::vector<uint8_t> payload{static_cast<uint8_t>(tp_header >> 24), static_cast<uint8_t>(tp_header >> 16),
+                                     static_cast<uint8_t>(tp_header >> 8), static_cast<uint8_t>(tp_header)};
+        payload.resize(4 + 32, 0x5A);
+        segment.set_payload(payload);
+        ASSERT_EQ(server_->transport().send_message(segment, back_->get_local_endpoint()), Result::SUCCESS);
+    };
+    send_segment(0, true);
+    send_segment(32, true);
+    ASSERT_TRUE(client_->wait_for(3));
+    EXPECT_EQ(gateway_->get_pending_requests(), 1u);
+    send_segment(64, false);
+    ASSERT_TRUE(client_->wait_for(4));
+    EXPECT_EQ(gateway_->get_pending_requests(), 0u);
+
+    auto received = client_->received();
+    for (size_t i = 1; i < received.size(); ++i) {
+        EXPECT_EQ(received[i]->get_message_type(), MessageType::TP_RESPONSE);
+        EXPECT_EQ(received[i]->get_client_id(), 0x0011);
+        EXPECT_EQ(received[i]->get_session_id(), 0x000A);
+    }
+    auto stats = gateway_->get_statistics();
+    EXPECT_EQ(stats.routed_responses, 4u);
+    EXPECT_EQ(stats.dropped_no_route, 0u);
+    EXPECT_EQ(stats.dropped_unmatched_responses, 0u);
+}
+
+// UDP on the client side, TCP towards the server
+TEST_F(GatewayTest, TranslatesUdpToTcp) {
+    auto tcp_server = std::make_shared<TcpTransport>();
+    ASSERT_EQ(tcp_server->initialize(Endpoint("127.0.0.1", 0)), Result::SUCCESS);
+    ASSERT_EQ(tcp_server->enable_server_mode(), Result::SUCCESS);
+    Peer server(tcp_server, true);
+    ASSERT_EQ(tcp_server->start(), Result::SUCCESS);
+
+    auto tcp_client = std::make_shared<TcpTransport>();
+    ASSERT_EQ(tcp_client->initialize(Endpoint("127.0.0.1", 0)), Result::SUCCESS);
+    ASSERT_EQ(tcp_client->start(), Result::SUCCESS);
+    ASSERT_EQ(tcp_client->connect(tcp_server->get_local_endpoint()), Result::SUCCESS);
+
+    gateway_ = std::make_unique<Gateway>();
+    ASSERT_EQ(gateway_->add_interface("front", front_, 0x0001), Result::SUCCESS);
+    ASSERT_EQ(gateway_->add_interface("back", tcp_client), Result::SUCCESS);
+    Route route;
+    route.service_id = 0x1234;
+    route.egress = "back";
+    ASSERT_EQ(gateway_->add_route(route), Result::SUCCESS);
+    ASSERT_EQ(gateway_->start(), Result::SUCCESS);
+
+    send_from_client(make_message(0x0001, MessageType::REQUEST, 0x0022, 0x0009));
+
+    ASSERT_TRUE(server.wait_for(1));
+    ASSERT_TRUE(client_->wait_for(1));
+    auto response = client_->received()[0];
+    EXPECT_EQ(response->get_client_id(), 0x0022);
+    EXPECT_EQ(response->get_session_id(), 0x0009);
+
+    gateway_.reset();
+    tcp_server->stop();
+}
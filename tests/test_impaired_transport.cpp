@@ -0,0 +1,269 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+#include <someip/message.h>
+#include <transport/impaired_transport.h>
+#include <transport/inprocess_transport.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace someip;
+using namespace someip::transport;
+using namespace std::chrono_literals;
+
+namespace {
+
+class CollectingListener : public ITransportListener {
+public:
+    void on_message_received(MessagePtr message, const Endpoint&) override {
+        std::scoped_lock lock(mutex_);
+        sessions_.push_back(message->get_session_id());
+        arrivals_.push_back(std::chrono::steady_clock::now());
+        cv_.notify_all();
+    }
+    void on_connection_lost(const Endpoint&) override {}
+    void on_connection_established(const Endpoint&) override {}
+    void on_error(Result) override {}
+
+    bool wait_for(size_t count, std::chrono::milliseconds timeout = 3000ms) {
+        std::unique_lock lock(mutex_);
+        return cv_.wait_for(lock, timeout, [this, count] { return sessions_.size() >= count; });
+    }
+
+    std::vector<uint16_t> sessions() {
+        std::scoped_lock lock(mutex_);
+        return sessions_;
+    }
+
+    std::vector<std::chrono::steady_clock::time_point> arrivals() {
+        std::scoped_lock lock(mutex_);
+        return arrivals_;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<uint16_t> sessions_;
+    std::vector<std::chrono::steady_clock::time_point> arrivals_;
+};
+
+Message make_message(uint16_t session_id, size_t payload_size = 16) {
+    Message message(MessageId(0x1234, 0x8001), RequestId(0x0001, session_id), MessageType::NOTIFICATION);
+    message.set_payload(std::vector<uint8_t>(payload_size, 0x5A));
+    return message;
+}
+
+/**
+ * @brief Impaired sender and a plain in-process receiver
+ */
+class ImpairedTransportTest : public ::testing::Test {
+protected:
+    void open(const ImpairedTransportConfig& config) {
+        receiver_ = std::make_shared<InProcessTransport>();
+        receiver_->set_listener(&listener_);
+        ASSERT_EQ(receiver_->start(), Result::SUCCESS);
+        sender_ = std::make_unique<ImpairedTransport>(std::make_shared<InProcessTransport>(), config);
+        ASSERT_EQ(sender_->start(), Result::SUCCESS);
+    }
+
+    void send(uint16_t count, size_t payload_size = 16) {
+        for (uint16_t session = 1; session <= count; ++session) {
+            ASSERT_EQ(sender_->send_message(make_message(session, payload_size), receiver_->get_local_endpoint()),
+                      Result::SUCCESS);
+        }
+    }
+
+    // Wait until nothing more arrives
+    std::vector<uint16_t> settle(std::chrono::milliseconds quiet = 100ms) {
+        size_t seen = SIZE_MAX;
+        while (seen != listener_.sessions().size()) {
+            seen = listener_.sessions().size();
+            std::this_thread::sleep_for(quiet);
+        }
+        return listener_.sessions();
+    }
+
+    CollectingListener listener_;
+    std::shared_ptr<InProcessTransport> receiver_;
+    std::unique_ptr<ImpairedTransport> sender_;
+};
+
+} // namespace
+
+TEST_F(ImpairedTransportTest, PassesThroughWithoutImpairment) {
+    open(ImpairedTransportConfig());
+    send(500);
+    ASSERT_TRUE(listener_.wait_for(500));
+
+    auto sessions = listener_.sessions();
+    for (size_t i = 0; i < sessions.size(); ++i) {
+        EXPECT_EQ(sessions[i], i + 1);
+    }
+    EXPECT_EQ(sender_->get_outbound_statistics().delivered, 500u);
+}
+
+TEST_F(ImpairedTransportTest, LossIsSeededAndNearConfiguredRate) {
+    ImpairedTransportConfig config;
+    config.outbound.loss = 0.3;
+    config.seed = 42;
+    open(config);
+    send(2000);
+    auto first = settle();
+
+    // Same seed, same traffic: the same messages are lost
+    CollectingListener again;
+    auto receiver = std::make_shared<InProcessTransport>();
+    receiver->set_listener(&again);
+    ASSERT_EQ(receiver->start(), Result::SUCCESS);
+    ImpairedTransport sender(std::make_shared<InProcessTransport>(), config);
+    ASSERT_EQ(sender.start(), Result::SUCCESS);
+    for (uint16_t session = 1; session <= 2000; ++session) {
+        ASSERT_EQ(sender.send_message(make_message(session), receiver->get_local_endpoint()), Result::SUCCESS);
+    }
+    ASSERT_TRUE(again.wait_for(first.size()));
+    EXPECT_EQ(again.sessions(), first);
+
+    auto stats = sender_->get_outbound_statistics();
+    EXPECT_EQ(stats.lost + stats.delivered, 2000u);
+    EXPECT_EQ(stats.delivered, first.size());
+    EXPECT_GT(stats.lost, 500u);
+    EXPECT_LT(stats.lost, 700u);
+}
+
+TEST_F(ImpairedTransportTest, BurstLossLosesRuns) {
+    ImpairedTransportConfig config;
+    config.outbound.loss = 0.02;
+    config.outbound.burst_length = 8.0;
+    open(config);
+    send(5000);
+    auto sessions = settle();
+
+    // Gaps between delivered sessions are loss bursts
+    size_t bursts = 0;
+    size_t lost = 0;
+    uint16_t previous = 0;
+    for (uint16_t session : sessions) {
+        if (session != previous + 1) {
+            bursts++;
+            lost += session - previous - 1;
+        }
+        previous = session;
+    }
+    ASSERT_GT(bursts, 20u);
+    double mean_burst = static_cast<double>(lost) / static_cast<double>(bursts);
+    EXPECT_GT(mean_burst, 5.0);
+    EXPECT_LT(mean_burst, 11.0);
+}
+
+TEST_F(ImpairedTransportTest, DuplicatesAndReorders) {
+    ImpairedTransportConfig config;
+    config.outbound.duplicate = 1.0;
+    open(config);
+    send(100);
+    ASSERT_TRUE(listener_.wait_for(200));
+    EXPECT_EQ(sender_->get_outbound_statistics().duplicated, 100u);
+
+    // Half the messages skip a 20 ms delay and overtake the others
+    ImpairmentProfile reordering;
+    reordering.delay = 20ms;
+    reordering.reorder = 0.5;
+    sender_->set_outbound_profile(reordering);
+    listener_.sessions();
+    CollectingListener fresh;
+    receiver_->set_listener(&fresh);
+    send(200);
+    ASSERT_TRUE(fresh.wait_for(200));
+
+    auto sessions = fresh.sessions();
+    size_t inversions = 0;
+    for (size_t i = 1; i < sessions.size(); ++i) {
+        if (sessions[i] < sessions[i - 1]) {
+            inversions++;
+        }
+    }
+    EXPECT_GT(inversions, 0u);
+    auto reordered = sender_->get_outbound_statistics().reordered;
+    EXPECT_GT(reordered, 60u);
+    EXPECT_LT(reordered, 140u);
+}
+
+TEST_F(ImpairedTransportTest, DelaysAndJitters) {
+    ImpairedTransportConfig config;
+    config.outbound.delay = 30ms;
+    config.outbound.jitter = 10ms;
+    config.outbound.distribution = DelayDistribution::NORMAL;
+    open(config);
+
+    auto sent_at = std::chrono::steady_clock::now();
+    send(50);
+    ASSERT_TRUE(listener_.wait_for(50));
+
+    std::chrono::steady_clock::duration total{};
+    for (auto arrival : listener_.arrivals()) {
+        EXPECT_GE(arrival - sent_at, 0ms);
+        total += arrival - sent_at;
+    }
+    auto mean = std::chrono::duration_cast<std::chrono::milliseconds>(total / 50);
+    EXPECT_GE(mean.count(), 22);
+    EXPECT_LE(mean.count(), 60);
+}
+
+TEST_F(ImpairedTransportTest, CapsBandwidthAndTailDrops) {
+    ImpairedTransportConfig config;
+    config.outbound.rate_bps = 1000000;  // 125 kB/s
+    config.outbound.queue_limit = 25;
+    open(config);
+
+    // 1000 + 16 header bytes each take ~8.1 ms on the link
+    auto start = std::chrono::steady_clock::now();
+    send(30, 1000);
+    auto sessions = settle(50ms);
+    auto elapsed = listener_.arrivals().back() - start;
+
+    EXPECT_EQ(sender_->get_outbound_statistics().overflowed, 30u - sessions.size());
+    EXPECT_GE(sessions.size(), 24u);
+    EXPECT_LE(sessions.size(), 26u);
+    EXPECT_GE(elapsed, 180ms);
+}
+
+TEST_F(ImpairedTransportTest, ImpairsInboundSeparately) {
+    ImpairedTransportConfig config;
+    config.inbound.loss = 1.0;
+    auto inner = std::make_shared<InProcessTransport>();
+    ImpairedTransport impaired(inner, config);
+    CollectingListener inbound;
+    impaired.set_listener(&inbound);
+    ASSERT_EQ(impaired.start(), Result::SUCCESS);
+
+    open(ImpairedTransportConfig());
+    for (uint16_t session = 1; session <= 10; ++session) {
+        ASSERT_EQ(sender_->send_message(make_message(session), impaired.get_local_endpoint()), Result::SUCCESS);
+        ASSERT_EQ(impaired.send_message(make_message(session), receiver_->get_local_endpoint()), Result::SUCCESS);
+    }
+    ASSERT_TRUE(listener_.wait_for(10));
+
+    std::this_thread::sleep_for(50ms);
+    EXPECT_TRUE(inbound.sessions().empty());
+    EXPECT_EQ(impaired.get_inbound_statistics().lost, 10u);
+    EXPECT_EQ(impaired.get_outbound_statistics().delivered, 10u);
+
+    // Conditions can change mid-test, e.g. when a link recovers
+    impaired.set_inbound_profile(ImpairmentProfile());
+    ASSERT_EQ(sender_->send_message(make_message(11), impaired.get_local_endpoint()), Result::SUCCESS);
+    ASSERT_TRUE(inbound.wait_for(1));
+    EXPECT_EQ(inbound.sessions()[0], 11);
+}
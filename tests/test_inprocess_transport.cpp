@@ -0,0 +1,275 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+#include <rpc/rpc_server.h>
+#include <rpc/server_runtime.h>
+#include <someip/message.h>
+#include <transport/inprocess_transport.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace someip;
+using namespace someip::transport;
+
+namespace {
+
+class CollectingListener : public ITransportListener {
+public:
+    void on_message_received(MessagePtr message, const Endpoint& sender) override {
+        std::unique_lock lock(mutex_);
+        gate_cv_.wait(lock, [this] { return open_; });
+        messages_.push_back(std::move(message));
+        senders_.push_back(sender);
+        cv_.notify_all();
+    }
+    void on_connection_lost(const Endpoint&) override {}
+    void on_connection_established(const Endpoint&) override {}
+    void on_error(Result) override {}
+
+    bool wait_for(size_t count, std::chrono::milliseconds timeout = std::chrono::milliseconds(2000)) {
+        std::unique_lock lock(mutex_);
+        return cv_.wait_for(lock, timeout, [this, count] { return messages_.size() >= count; });
+    }
+
+    // While closed, the delivery thread blocks in the callback
+    void set_open(bool open) {
+        std::scoped_lock lock(mutex_);
+        open_ = open;
+        gate_cv_.notify_all();
+    }
+
+    std::vector<MessagePtr> messages() {
+        std::scoped_lock lock(mutex_);
+        return messages_;
+    }
+
+    std::vector<Endpoint> senders() {
+        std::scoped_lock lock(mutex_);
+        return senders_;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::condition_variable gate_cv_;
+    bool open_{true};
+    std::vector<MessagePtr> messages_;
+    std::vector<Endpoint> senders_;
+};
+
+MessagePtr make_notification(uint16_t session_id, std::vector<uint8_t> payload = {0x01, 0x02}) {
+    auto message = std::make_shared<Message>(MessageId(0x1234, 0x8001), RequestId(0x0001, session_id),
+                                             MessageType::NOTIFICATION);
+    message->set_payload(std::move(payload));
+    return message;
+}
+
+} // namespace
+
+TEST(InProcessTransportTest, DeliversMessageObjectWithSenderEndpoint) {
+    InProcessTransport sender;
+    InProcessTransport receiver;
+    CollectingListener listener;
+    receiver.set_listener(&listener);
+    ASSERT_EQ(sender.start(), Result::SUCCESS);
+    ASSERT_EQ(receiver.start(), Result::SUCCESS);
+
+    // Port 0 was replaced by distinct ports from the dynamic range
+    EXPECT_GE(sender.get_local_endpoint().get_port(), 49152);
+    EXPECT_NE(sender.get_local_endpoint(), receiver.get_local_endpoint());
+
+    MessagePtr message = make_notification(1);
+    ASSERT_EQ(sender.send_message(message, receiver.get_local_endpoint()), Result::SUCCESS);
+    ASSERT_EQ(sender.send_message(*message, receiver.get_local_endpoint()), Result::SUCCESS);
+    ASSERT_TRUE(listener.wait_for(2));
+
+    auto received = listener.messages();
+    EXPECT_EQ(received[0].get(), message.get());  // Handed over, not copied
+    EXPECT_NE(received[1].get(), message.get());
+    EXPECT_EQ(received[1]->get_payload(), message->get_payload());
+    EXPECT_EQ(listener.senders()[0], sender.get_local_endpoint());
+}
+
+TEST(InProcessTransportTest, QueuesForReceiveMessageWithoutListener) {
+    InProcessTransport sender;
+    InProcessTransport receiver;
+    ASSERT_EQ(sender.start(), Result::SUCCESS);
+    ASSERT_EQ(receiver.start(), Result::SUCCESS);
+
+    ASSERT_EQ(sender.send_message(make_notification(7), receiver.get_local_endpoint()), Result::SUCCESS);
+
+    MessagePtr received;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (!received && std::chrono::steady_clock::now() < deadline) {
+        received = receiver.receive_message();
+        std::this_thread::yield();
+    }
+    ASSERT_NE(received, nullptr);
+    EXPECT_EQ(received->get_session_id(), 7);
+    EXPECT_EQ(receiver.receive_message(), nullptr);
+}
+
+TEST(InProcessTransportTest, RejectsUnknownDestinationAndEndpointInUse) {
+    InProcessTransport sender;
+    EXPECT_EQ(sender.send_message(make_notification(1), Endpoint("127.0.0.1", 40000)), Result::NOT_CONNECTED);
+    ASSERT_EQ(sender.start(), Result::SUCCESS);
+    EXPECT_EQ(sender.send_message(make_notification(1), Endpoint("127.0.0.1", 40000)), Result::NOT_CONNECTED);
+
+    InProcessTransport first(Endpoint("127.0.0.1", 40000));
+    InProcessTransport second(Endpoint("127.0.0.1", 40000));
+    InProcessTransport other_address(Endpoint("127.0.0.2", 40000));
+    ASSERT_EQ(first.start(), Result::SUCCESS);
+    EXPECT_EQ(second.start(), Result::NETWORK_ERROR);
+    EXPECT_EQ(other_address.start(), Result::SUCCESS);
+    EXPECT_EQ(sender.send_message(make_notification(1), Endpoint("127.0.0.1", 40000)), Result::SUCCESS);
+
+    // Stopping frees the endpoint
+    ASSERT_EQ(first.stop(), Result::SUCCESS);
+    EXPECT_EQ(sender.send_message(make_notification(1), Endpoint("127.0.0.1", 40000)), Result::NOT_CONNECTED);
+    EXPECT_EQ(second.start(), Result::SUCCESS);
+}
+
+TEST(InProcessTransportTest, ReportsFullQueue) {
+    InProcessTransportConfig config;
+    config.queue_capacity = 4;
+    InProcessTransport sender;
+    InProcessTransport receiver(Endpoint("127.0.0.1", 0), config);
+    CollectingListener listener;
+    listener.set_open(false);
+    receiver.set_listener(&listener);
+    ASSERT_EQ(sender.start(), Result::SUCCESS);
+    ASSERT_EQ(receiver.start(), Result::SUCCESS);
+
+    // One message is held by the blocked delivery thread, four fill the queue
+    size_t accepted = 0;
+    Result result = Result::SUCCESS;
+    for (uint16_t session = 1; session <= 16 && result == Result::SUCCESS; ++session) {
+        result = sender.send_message(make_notification(session), receiver.get_local_endpoint());
+        if (result == Result::SUCCESS) {
+            accepted++;
+        }
+    }
+    EXPECT_EQ(result, Result::BUFFER_OVERFLOW);
+    EXPECT_GE(accepted, 4u);
+    EXPECT_LE(accepted, 5u);
+
+    listener.set_open(true);
+    ASSERT_TRUE(listener.wait_for(accepted));
+    auto received = listener.messages();
+    for (size_t i = 0; i < received.size(); ++i) {
+        EXPECT_EQ(received[i]->get_session_id(), i + 1);
+    }
+}
+
+TEST(InProcessTransportTest, VerifySerializationDeliversRoundTrippedCopy) {
+    InProcessTransportConfig config;
+    config.verify_serialization = true;
+    InProcessTransport sender(Endpoint("127.0.0.1", 0), config);
+    InProcessTransport receiver;
+    CollectingListener listener;
+    receiver.set_listener(&listener);
+    ASSERT_EQ(sender.start(), Result::SUCCESS);
+    ASSERT_EQ(receiver.start(), Result::SUCCESS);
+
+    MessagePtr message = make_notification(3, std::vector<uint8_t>(100, 0xAB));
+    ASSERT_EQ(sender.send_message(message, receiver.get_local_endpoint()), Result::SUCCESS);
+    ASSERT_TRUE(listener.wait_for(1));
+    auto received = listener.messages();
+    EXPECT_NE(received[0].get(), message.get());
+    EXPECT_EQ(received[0]->serialize(), message->serialize());
+
+    // A message no socket transport could carry is refused
+    MessagePtr broken = make_notification(4);
+    broken->set_length(4);
+    EXPECT_EQ(sender.send_message(broken, receiver.get_local_endpoint()), Result::INVALID_MESSAGE);
+}
+
+TEST(InProcessTransportTest, ManyProducersKeepPerSenderOrder) {
+    constexpr size_t PRODUCERS = 4;
+    constexpr uint16_t PER_PRODUCER = 2000;
+    InProcessTransportConfig config;
+    config.queue_capacity = PRODUCERS * PER_PRODUCER;
+    InProcessTransport receiver(Endpoint("127.0.0.1", 0), config);
+    CollectingListener listener;
+    receiver.set_listener(&listener);
+    ASSERT_EQ(receiver.start(), Result::SUCCESS);
+
+    std::vector<std::unique_ptr<InProcessTransport>> senders;
+    std::vector<std::thread> threads;
+    for (size_t p = 0; p < PRODUCERS; ++p) {
+        senders.push_back(std::make_unique<InProcessTransport>());
+        ASSERT_EQ(senders.back()->start(), Result::SUCCESS);
+    }
+    for (size_t p = 0; p < PRODUCERS; ++p) {
+        threads.emplace_back([&, p] {
+            for (uint16_t session = 1; session <= PER_PRODUCER; ++session) {
+                EXPECT_EQ(senders[p]->send_message(make_notification(session), receiver.get_local_endpoint()),
+                          Result::SUCCESS);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_TRUE(listener.wait_for(PRODUCERS * PER_PRODUCER, std::chrono::milliseconds(10000)));
+
+    auto messages = listener.messages();
+    auto from = listener.senders();
+    std::vector<uint16_t> last(PRODUCERS, 0);
+    for (size_t i = 0; i < messages.size(); ++i) {
+        for (size_t p = 0; p < PRODUCERS; ++p) {
+            if (from[i] == senders[p]->get_local_endpoint()) {
+                EXPECT_EQ(messages[i]->get_session_id(), last[p] + 1);
+                last[p] = messages[i]->get_session_id();
+            }
+        }
+    }
+    EXPECT_EQ(last, std::vector<uint16_t>(PRODUCERS, PER_PRODUCER));
+}
+
+// Upper layers run unchanged on top of the in-process transport
+TEST(InProcessTransportTest, CarriesRpcBetweenCoLocatedClientAndServer) {
+    auto server_transport = std::make_shared<InProcessTransport>(Endpoint("127.0.0.1", 30490));
+    auto runtime = std::make_shared<rpc::ServerRuntime>(server_transport);
+    ASSERT_TRUE(runtime->start());
+
+    rpc::RpcServer server(0x4321, runtime);
+    server.register_method(0x0001, [](uint16_t, uint16_t, PayloadView input, std::vector<uint8_t>& output) {
+        output.assign(input.begin(), input.end());
+        output.push_back(0xFF);
+        return rpc::RpcResult::SUCCESS;
+    });
+    ASSERT_TRUE(server.initialize());
+
+    InProcessTransport client;
+    CollectingListener listener;
+    client.set_listener(&listener);
+    ASSERT_EQ(client.start(), Result::SUCCESS);
+
+    Message request(MessageId(0x4321, 0x0001), RequestId(0x0010, 0x0001), MessageType::REQUEST);
+    request.set_payload(std::vector<uint8_t>{0x01, 0x02});
+    ASSERT_EQ(client.send_message(request, runtime->get_local_endpoint()), Result::SUCCESS);
+    ASSERT_TRUE(listener.wait_for(1));
+
+    MessagePtr response = listener.messages()[0];
+    EXPECT_EQ(response->get_message_type(), MessageType::RESPONSE);
+    EXPECT_EQ(response->get_session_id(), 0x0001);
+    EXPECT_EQ(response->get_payload(), (std::vector<uint8_t>{0x01, 0x02, 0xFF}));
+
+    server.shutdown();
+    runtime->stop();
+}
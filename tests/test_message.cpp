@@ -14,6 +14,7 @@
 #include <gtest/gtest.h>
 #include "someip/message.h"
 #include "serialization/serializer.h"
+#include <type_traits>
 
 using namespace someip;
 
@@ -365,6 +366,120 @@ TEST_F(MessageTest, MessageTypeHelpers) {
     EXPECT_FALSE(notification_msg.is_response());
 }
 
+TEST_F(MessageTest, SmallPayloadStoredInline) {
+    Payload small(std::vector<uint8_t>(Payload::INLINE_CAPACITY, 0xAB));
+    EXPECT_TRUE(small.is_inline());
+    EXPECT_EQ(small.size(), Payload::INLINE_CAPACITY);
+
+    Payload large(std::vector<uint8_t>(Payload::INLINE_CAPACITY + 1, 0xCD));
+    EXPECT_FALSE(large.is_inline());
+    EXPECT_EQ(large.view(), std::vector<uint8_t>(Payload::INLINE_CAPACITY + 1, 0xCD));
+
+    // Shrinking back below the threshold returns to inline storage
+    large.assign(small.data(), 4);
+    EXPECT_TRUE(large.is_inline());
+    EXPECT_EQ(large.view(), (std::vector<uint8_t>{0xAB, 0xAB, 0xAB, 0xAB}));
+}
+
+TEST_F(MessageTest, LargePayloadVectorIsAdopted) {
+    std::vector<uint8_t> data(1024, 0x5A);
+    const uint8_t* buffer = data.data();
+
+    Message msg;
+    msg.set_payload(std::move(data));
+    EXPECT_EQ(msg.get_payload().data(), buffer);
+    EXPECT_EQ(msg.get_payload().size(), 1024u);
+    EXPECT_EQ(msg.get_length(), 8u + 1024u);
+}
+
+TEST_F(MessageTest, PayloadCopyAndMoveSemantics) {
+    for (size_t size : {size_t{3}, Payload::INLINE_CAPACITY * 4}) {
+        std::vector<uint8_t> data(size);
+        for (size_t i = 0; i < size; ++i) {
+            data[i] = static_cast<uint8_t>(i);
+        }
+
+        Payload original(data);
+        Payload copy(original);
+        EXPECT_EQ(copy.view(), original.view());
+        EXPECT_EQ(copy.data() == original.data(), !original.is_inline());
+
+        Payload moved(std::move(original));
+        EXPECT_EQ(moved.view(), data);
+        EXPECT_TRUE(original.empty());  // NOLINT(bugprone-use-after-move)
+
+        Payload assigned;
+        assigned = moved;
+        EXPECT_EQ(assigned.view(), data);
+        assigned = std::move(copy);
+        EXPECT_EQ(assigned.view(), data);
+    }
+}
+
+TEST_F(MessageTest, PayloadViewAccess) {
+    Message msg;
+    msg.set_payload({0x10, 0x20, 0x30, 0x40});
+
+    PayloadView view = msg.get_payload();
+    ASSERT_EQ(view.size(), 4u);
+    EXPECT_EQ(view[2], 0x30);
+    EXPECT_EQ(view.subview(1, 2), (std::vector<uint8_t>{0x20, 0x30}));
+    EXPECT_EQ(view.subview(3), (std::vector<uint8_t>{0x40}));
+    EXPECT_TRUE(view.subview(10).empty());
+
+    // Copies into vectors are explicit
+    static_assert(!std::is_convertible_v<PayloadView, std::vector<uint8_t>>,
+                  "a view must not silently copy into a vector");
+    std::vector<uint8_t> copy(msg.get_payload());
+    EXPECT_EQ(copy, view.to_vector());
+    EXPECT_NE(view, (std::vector<uint8_t>{0x10, 0x20, 0x30}));
+
+    // Deserialized small payloads are stored inline as well
+    Message parsed;
+    ASSERT_TRUE(parsed.deserialize(msg.serialize()));
+    EXPECT_EQ(parsed.get_payload(), view);
+}
+
+TEST_F(MessageTest, MessageCopySharesLargePayload) {
+    std::vector<uint8_t> data(Payload::INLINE_CAPACITY * 2, 0x11);
+    Message original;
+    original.set_payload(data);
+
+    Message copy(original);
+    Message assigned;
+    assigned = original;
+    EXPECT_EQ(copy.get_payload().data(), original.get_payload().data());
+    EXPECT_EQ(assigned.get_payload().data(), original.get_payload().data());
+
+    // Writing detaches the writer only
+    uint8_t* writable = copy.get_mutable_payload();
+    EXPECT_NE(writable, original.get_payload().data());
+    writable[0] = 0x22;
+    EXPECT_EQ(copy.get_payload()[0], 0x22);
+    EXPECT_EQ(original.get_payload()[0], 0x11);
+    EXPECT_EQ(assigned.get_payload(), data);
+
+    // A sole owner writes in place
+    const uint8_t* before = copy.get_payload().data();
+    EXPECT_EQ(copy.get_mutable_payload(), before);
+}
+
+TEST_F(MessageTest, SharedPayloadSurvivesOriginal) {
+    Payload copy;
+    {
+        Payload original(std::vector<uint8_t>(256, 0x7E));
+        copy = original;
+        EXPECT_TRUE(original.is_shared());
+        EXPECT_TRUE(copy.is_shared());
+    }
+    EXPECT_FALSE(copy.is_shared());
+    EXPECT_EQ(copy.view(), std::vector<uint8_t>(256, 0x7E));
+
+    // Re-assigning from our own shared bytes is safe
+    copy.assign(copy.data() + 8, 128);
+    EXPECT_EQ(copy.view(), std::vector<uint8_t>(128, 0x7E));
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
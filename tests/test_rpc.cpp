@@ -15,6 +15,16 @@
 #include <rpc/rpc_types.h>
 #include <rpc/rpc_client.h>
 #include <rpc/rpc_server.h>
+#include <rpc/dispatch_table.h>
+#include <rpc/server_runtime.h>
+#include <rpc/load_balancer.h>
+#include <rpc/admission_control.h>
+#include <rpc/sd_load_balancing.h>
+#include <transport/udp_transport.h>
+#include <condition_variable>
+#include <future>
+#include <set>
+#include <mutex>
 #include <thread>
 #include <chrono>
 #include <atomic>
@@ -84,7 +94,7 @@ TEST_F(RpcTest, ServerMethodRegistration) {
 
     // Should be able to register a method
     auto handler = [](uint16_t client_id, uint16_t session_id,
-                     const std::vector<uint8_t>& input,
+                     someip::PayloadView input,
                      std::vector<uint8_t>& output) -> RpcResult {
         output = {0x01, 0x02, 0x03};
         return RpcResult::SUCCESS;
@@ -166,3 +176,796 @@ TEST_F(RpcTest, ServerStatistics) {
     EXPECT_EQ(stats.method_not_found_errors, 0u);
     EXPECT_EQ(stats.average_processing_time, std::chrono::milliseconds(0));
 }
+
+// Test the lock-free method dispatch table
+TEST_F(RpcTest, DispatchTableLookup) {
+    DispatchTable<std::function<int()>> table;
+
+    EXPECT_TRUE(table.insert(0x0001, [] { return 1; }));
+    EXPECT_TRUE(table.insert(0xFF00, [] { return 2; }));
+    EXPECT_FALSE(table.insert(0x0001, [] { return 3; }));
+    EXPECT_EQ(table.size(), 2u);
+    EXPECT_EQ(table.ids(), (std::vector<uint16_t>{0x0001, 0xFF00}));
+
+    {
+        DispatchTable<std::function<int()>>::Reader reader(table);
+        ASSERT_NE(reader.find(0x0001), nullptr);
+        EXPECT_EQ((*reader.find(0x0001))(), 1);
+        EXPECT_EQ((*reader.find(0xFF00))(), 2);
+        EXPECT_EQ(reader.find(0x0002), nullptr);
+        EXPECT_EQ(reader.find(0x01FF), nullptr);
+    }
+
+    EXPECT_TRUE(table.erase(0x0001));
+    EXPECT_FALSE(table.erase(0x0001));
+    EXPECT_FALSE(table.contains(0x0001));
+    EXPECT_TRUE(table.contains(0xFF00));
+
+    table.clear();
+    EXPECT_EQ(table.size(), 0u);
+    EXPECT_TRUE(table.ids().empty());
+}
+
+// A pinned handler survives being unregistered
+TEST_F(RpcTest, DispatchTableHandlerOutlivesUnregister) {
+    DispatchTable<std::function<int()>> table;
+    auto state = std::make_shared<int>(42);
+    table.insert(0x0010, [state] { return *state; });
+
+    DispatchTable<std::function<int()>>::Reader reader(table);
+    const auto* handler = reader.find(0x0010);
+    ASSERT_NE(handler, nullptr);
+
+    std::weak_ptr<int> observer = state;
+    state.reset();
+    EXPECT_TRUE(table.erase(0x0010));
+    EXPECT_FALSE(table.contains(0x0010));
+
+    EXPECT_FALSE(observer.expired());
+    EXPECT_EQ((*handler)(), 42);
+}
+
+// An unregistered handler is freed once the last reader leaves, without another write
+TEST_F(RpcTest, DispatchTableReclaimsAfterLastReader) {
+    DispatchTable<std::function<int()>> table;
+    auto state = std::make_shared<int>(7);
+    std::weak_ptr<int> observer = state;
+    table.insert(0x0020, [state] { return *state; });
+    state.reset();
+
+    {
+        DispatchTable<std::function<int()>>::Reader reader(table);
+        EXPECT_TRUE(table.erase(0x0020));
+        EXPECT_FALSE(observer.expired());
+    }
+    EXPECT_TRUE(observer.expired());
+
+    // synchronize() reclaims what a reader on another thread kept pinned
+    state = std::make_shared<int>(8);
+    observer = state;
+    table.insert(0x0021, [state] { return *state; });
+    state.reset();
+    std::atomic<bool> pinned{false};
+    std::atomic<bool> release{false};
+    std::thread reader_thread([&] {
+        DispatchTable<std::function<int()>>::Reader reader(table);
+        pinned = true;
+        while (!release) {
+            std::this_thread::yield();
+        }
+    });
+    while (!pinned) {
+        std::this_thread::yield();
+    }
+    EXPECT_TRUE(table.erase(0x0021));
+    EXPECT_FALSE(observer.expired());
+    release = true;
+    table.synchronize();
+    EXPECT_TRUE(observer.expired());
+    reader_thread.join();
+}
+
+// Lookups stay consistent while methods are registered concurrently
+TEST_F(RpcTest, DispatchTableConcurrentRegistration) {
+    DispatchTable<std::function<int()>> table;
+    table.insert(0x0001, [] { return 1; });
+    std::atomic<bool> stop{false};
+    std::atomic<int> failures{0};
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 2; ++i) {
+        readers.emplace_back([&table, &stop, &failures]() {
+            while (!stop) {
+                DispatchTable<std::function<int()>>::Reader reader(table);
+                const auto* handler = reader.find(0x0001);
+                if (handler == nullptr || (*handler)() != 1) {
+                    failures++;
+                }
+                const auto* churn = reader.find(0x0002);
+                if (churn != nullptr && (*churn)() != 2) {
+                    failures++;
+                }
+            }
+        });
+    }
+
+    for (int i = 0; i < 2000; ++i) {
+        table.insert(0x0002, [] { return 2; });
+        table.erase(0x0002);
+    }
+    stop = true;
+    for (auto& thread : readers) {
+        thread.join();
+    }
+
+    EXPECT_EQ(failures.load(), 0);
+    EXPECT_EQ(table.ids(), (std::vector<uint16_t>{0x0001}));
+}
+
+namespace {
+
+// Collects messages received by a test client transport
+class CollectingListener : public someip::transport::ITransportListener {
+public:
+    void on_message_received(someip::MessagePtr message, const someip::transport::Endpoint&) override {
+        std::scoped_lock lock(mutex_);
+        messages_.push_back(message);
+        cv_.notify_all();
+    }
+    void on_connection_lost(const someip::transport::Endpoint&) override {}
+    void on_connection_established(const someip::transport::Endpoint&) override {}
+    void on_error(someip::Result) override {}
+
+    bool wait_for(size_t count, std::chrono::milliseconds timeout = std::chrono::milliseconds(2000)) {
+        std::unique_lock lock(mutex_);
+        return cv_.wait_for(lock, timeout, [this, count] { return messages_.size() >= count; });
+    }
+
+    std::vector<someip::MessagePtr> messages() {
+        std::scoped_lock lock(mutex_);
+        return messages_;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<someip::MessagePtr> messages_;
+};
+
+} // namespace
+
+// Several services are hosted on one shared endpoint
+TEST_F(RpcTest, ServerRuntimeHostsMultipleServices) {
+    using someip::transport::Endpoint;
+    auto runtime = std::make_shared<ServerRuntime>(Endpoint("127.0.0.1", 0));
+    ASSERT_TRUE(runtime->start());
+
+    RpcServer first(0x1001, runtime);
+    RpcServer second(0x1002, runtime);
+    RpcServer duplicate(0x1001, runtime);
+    auto reply_with = [](uint8_t value) {
+        return [value](uint16_t, uint16_t, someip::PayloadView, std::vector<uint8_t>& output) {
+            output = {value};
+            return RpcResult::SUCCESS;
+        };
+    };
+    first.register_method(0x0001, reply_with(0x11));
+    second.register_method(0x0001, reply_with(0x22));
+
+    ASSERT_TRUE(first.initialize());
+    ASSERT_TRUE(second.initialize());
+    EXPECT_FALSE(duplicate.initialize());
+    EXPECT_EQ(runtime->get_registered_services(), (std::vector<uint16_t>{0x1001, 0x1002}));
+
+    CollectingListener listener;
+    someip::transport::UdpTransport client(Endpoint("127.0.0.1", 0));
+    client.set_listener(&listener);
+    ASSERT_EQ(client.start(), someip::Result::SUCCESS);
+
+    Endpoint server_endpoint = runtime->get_local_endpoint();
+    for (uint16_t service_id : {0x1001, 0x1002, 0x1003}) {
+        someip::Message request(someip::MessageId(service_id, 0x0001),
+                                someip::RequestId(client_id_, service_id),
+                                someip::MessageType::REQUEST);
+        ASSERT_EQ(client.send_message(request, server_endpoint), someip::Result::SUCCESS);
+    }
+    ASSERT_TRUE(listener.wait_for(3));
+
+    for (const auto& response : listener.messages()) {
+        switch (response->get_service_id()) {
+            case 0x1001:
+                EXPECT_EQ(response->get_payload(), (std::vector<uint8_t>{0x11}));
+                break;
+            case 0x1002:
+                EXPECT_EQ(response->get_payload(), (std::vector<uint8_t>{0x22}));
+                break;
+            default:
+                EXPECT_EQ(response->get_message_type(), someip::MessageType::ERROR);
+                EXPECT_EQ(response->get_return_code(), someip::ReturnCode::E_UNKNOWN_SERVICE);
+                break;
+        }
+    }
+
+    // A server leaving the runtime does not stop the others
+    first.shutdown();
+    EXPECT_FALSE(runtime->is_service_registered(0x1001));
+    EXPECT_TRUE(runtime->is_running());
+    EXPECT_TRUE(second.is_ready());
+
+    (void)client.stop();
+}
+
+// Response cache keeps the most recently used entries
+TEST_F(RpcTest, ResponseCacheLruAndTtl) {
+    ResponseCacheConfig config;
+    config.max_entries = 2;
+    ResponseCache cache(config);
+    std::vector<uint8_t> a{0x01}, b{0x02}, c{0x03};
+    someip::Payload response;
+
+    EXPECT_FALSE(cache.lookup(a, response));
+    cache.store(a, someip::Payload(std::vector<uint8_t>{0xA0}), cache.get_generation());
+    cache.store(b, someip::Payload(std::vector<uint8_t>{0xB0}), cache.get_generation());
+    ASSERT_TRUE(cache.lookup(a, response));   // a becomes most recently used
+    EXPECT_EQ(response.view(), (std::vector<uint8_t>{0xA0}));
+
+    cache.store(c, someip::Payload(std::vector<uint8_t>{0xC0}), cache.get_generation());
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_FALSE(cache.lookup(b, response));  // evicted
+    EXPECT_TRUE(cache.lookup(a, response));
+    EXPECT_TRUE(cache.lookup(c, response));
+    EXPECT_EQ(cache.get_hits(), 3u);
+    EXPECT_EQ(cache.get_misses(), 2u);
+
+    // Responses computed before an invalidation are not stored
+    uint64_t generation = cache.get_generation();
+    cache.clear();
+    cache.store(a, someip::Payload(std::vector<uint8_t>{0xA1}), generation);
+    EXPECT_FALSE(cache.lookup(a, response));
+
+    ResponseCacheConfig short_lived;
+    short_lived.ttl = std::chrono::milliseconds(1);
+    ResponseCache expiring(short_lived);
+    expiring.store(a, someip::Payload(std::vector<uint8_t>{0xA0}), expiring.get_generation());
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    EXPECT_FALSE(expiring.lookup(a, response));
+    EXPECT_EQ(expiring.size(), 0u);
+}
+
+// Cached responses skip the handler and carry the caller's request ID
+TEST_F(RpcTest, ServerResponseCache) {
+    using someip::transport::Endpoint;
+    auto runtime = std::make_shared<ServerRuntime>(Endpoint("127.0.0.1", 0));
+    RpcServer server(test_service_id_, runtime);
+
+    std::atomic<int> handler_calls{0};
+    server.register_method(test_method_id_,
+        [&handler_calls](uint16_t, uint16_t, someip::PayloadView input, std::vector<uint8_t>& output) {
+            handler_calls++;
+            output.assign(input.begin(), input.end());
+            output.push_back(0xFF);
+            return RpcResult::SUCCESS;
+        });
+    EXPECT_TRUE(server.enable_response_cache(test_method_id_));
+    EXPECT_FALSE(server.enable_response_cache(test_method_id_));
+    ASSERT_TRUE(server.initialize());
+
+    CollectingListener listener;
+    someip::transport::UdpTransport client(Endpoint("127.0.0.1", 0));
+    client.set_listener(&listener);
+    ASSERT_EQ(client.start(), someip::Result::SUCCESS);
+
+    auto call = [&](uint16_t session_id, std::vector<uint8_t> params, size_t expected_responses) {
+        someip::Message request(someip::MessageId(test_service_id_, test_method_id_),
+                                someip::RequestId(client_id_, session_id),
+                                someip::MessageType::REQUEST);
+        request.set_payload(std::move(params));
+        ASSERT_EQ(client.send_message(request, runtime->get_local_endpoint()), someip::Result::SUCCESS);
+        ASSERT_TRUE(listener.wait_for(expected_responses));
+    };
+
+    call(1, {0x01, 0x02}, 1);
+    call(2, {0x01, 0x02}, 2);
+    call(3, {0x03}, 3);
+    EXPECT_EQ(handler_calls.load(), 2);
+
+    auto responses = listener.messages();
+    EXPECT_EQ(responses[1]->get_session_id(), 2);
+    EXPECT_EQ(responses[1]->get_client_id(), client_id_);
+    EXPECT_EQ(responses[1]->get_payload(), (std::vector<uint8_t>{0x01, 0x02, 0xFF}));
+
+    server.invalidate_response_cache(test_method_id_);
+    call(4, {0x01, 0x02}, 4);
+    EXPECT_EQ(handler_calls.load(), 3);
+
+    EXPECT_TRUE(server.disable_response_cache(test_method_id_));
+    call(5, {0x01, 0x02}, 5);
+    EXPECT_EQ(handler_calls.load(), 4);
+
+    (void)client.stop();
+}
+
+// Identical concurrent calls share one request when coalescing is enabled
+TEST_F(RpcTest, ClientRequestCoalescing) {
+    RpcServer server(test_service_id_);
+    std::mutex gate_mutex;
+    std::condition_variable gate_cv;
+    bool gate_open = false;
+    std::atomic<int> handler_calls{0};
+
+    server.register_method(test_method_id_,
+        [&](uint16_t, uint16_t, someip::PayloadView input, std::vector<uint8_t>& output) {
+            handler_calls++;
+            std::unique_lock lock(gate_mutex);
+            gate_cv.wait_for(lock, std::chrono::seconds(2), [&gate_open] { return gate_open; });
+            output.assign(input.begin(), input.end());
+            return RpcResult::SUCCESS;
+        });
+    ASSERT_TRUE(server.initialize());
+
+    RpcClient client(client_id_);
+    ASSERT_TRUE(client.initialize());
+    EXPECT_TRUE(client.enable_request_coalescing(test_service_id_, test_method_id_));
+    EXPECT_FALSE(client.enable_request_coalescing(test_service_id_, test_method_id_));
+
+    std::mutex results_mutex;
+    std::condition_variable results_cv;
+    std::vector<RpcResponse> results;
+    auto collect = [&](const RpcResponse& response) {
+        std::scoped_lock lock(results_mutex);
+        results.push_back(response);
+        results_cv.notify_all();
+    };
+
+    std::vector<uint8_t> params{0x01, 0x02};
+    RpcCallHandle leader = client.call_method_async(test_service_id_, test_method_id_, params, collect);
+    RpcCallHandle follower = client.call_method_async(test_service_id_, test_method_id_, params, collect);
+    client.call_method_async(test_service_id_, test_method_id_, params, collect);
+    client.call_method_async(test_service_id_, test_method_id_, {0x09}, collect);
+    ASSERT_NE(leader, 0u);
+    ASSERT_NE(follower, 0u);
+
+    // Cancelling the leader hands its request to a follower
+    EXPECT_TRUE(client.cancel_call(leader));
+
+    {
+        std::scoped_lock lock(gate_mutex);
+        gate_open = true;
+    }
+    gate_cv.notify_all();
+
+    std::unique_lock lock(results_mutex);
+    ASSERT_TRUE(results_cv.wait_for(lock, std::chrono::seconds(2), [&results] { return results.size() >= 4; }));
+    EXPECT_EQ(handler_calls.load(), 2);
+
+    size_t cancelled = 0;
+    size_t shared = 0;
+    for (const auto& response : results) {
+        if (response.result != RpcResult::SUCCESS) {
+            cancelled++;
+        } else if (response.return_values == params) {
+            shared++;
+        }
+    }
+    EXPECT_EQ(cancelled, 1u);
+    EXPECT_EQ(shared, 2u);
+    lock.unlock();
+
+    client.shutdown();
+    server.shutdown();
+}
+
+// A coalesced caller that gives up early does not fail the others
+TEST_F(RpcTest, ClientCoalescedCallsKeepOwnTimeouts) {
+    RpcServer server(test_service_id_);
+    std::atomic<int> handler_calls{0};
+    server.register_method(test_method_id_,
+        [&](uint16_t, uint16_t, someip::PayloadView input, std::vector<uint8_t>& output) {
+            handler_calls++;
+            std::this_thread::sleep_for(std::chrono::milliseconds(300));
+            output.assign(input.begin(), input.end());
+            return RpcResult::SUCCESS;
+        });
+    ASSERT_TRUE(server.initialize());
+
+    RpcClient client(client_id_);
+    ASSERT_TRUE(client.initialize());
+    ASSERT_TRUE(client.enable_request_coalescing(test_service_id_, test_method_id_));
+
+    RpcTimeout short_timeout;
+    short_timeout.response_timeout = std::chrono::milliseconds(100);
+    RpcTimeout long_timeout;
+    long_timeout.response_timeout = std::chrono::milliseconds(2000);
+
+    // Leader gives up first, then a follower gives up first
+    for (bool leader_short : {true, false}) {
+        std::vector<uint8_t> params{leader_short ? uint8_t{0x01} : uint8_t{0x02}};
+        int calls_before = handler_calls.load();
+        auto leader = std::async(std::launch::async, [&] {
+            return client.call_method_sync(test_service_id_, test_method_id_, params,
+                                           leader_short ? short_timeout : long_timeout);
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+        auto follower = std::async(std::launch::async, [&] {
+            return client.call_method_sync(test_service_id_, test_method_id_, params,
+                                           leader_short ? long_timeout : short_timeout);
+        });
+
+        RpcSyncResult short_result = leader_short ? leader.get() : follower.get();
+        RpcSyncResult long_result = leader_short ? follower.get() : leader.get();
+        EXPECT_EQ(short_result.result, RpcResult::TIMEOUT);
+        EXPECT_EQ(long_result.result, RpcResult::SUCCESS);
+        EXPECT_EQ(long_result.return_values, params);
+        EXPECT_EQ(handler_calls.load(), calls_before + 1);
+    }
+
+    client.shutdown();
+    server.shutdown();
+}
+
+// Balancing strategies pick instances as documented
+TEST_F(RpcTest, LoadBalancerStrategies) {
+    using someip::transport::Endpoint;
+    Endpoint a("10.0.0.1", 30509), b("10.0.0.2", 30509), c("10.0.0.3", 30509);
+    Endpoint selected;
+
+    LoadBalancer round_robin;
+    EXPECT_FALSE(round_robin.select(test_service_id_, selected));
+    round_robin.set_instances(test_service_id_, {a, b, c});
+    std::vector<Endpoint> order;
+    for (int i = 0; i < 6; ++i) {
+        ASSERT_TRUE(round_robin.select(test_service_id_, selected));
+        order.push_back(selected);
+    }
+    EXPECT_EQ(order, (std::vector<Endpoint>{a, b, c, a, b, c}));
+    EXPECT_EQ(round_robin.get_outstanding(test_service_id_, a), 2u);
+
+    LoadBalancerConfig least_config;
+    least_config.strategy = LoadBalancingStrategy::LEAST_OUTSTANDING;
+    LoadBalancer least(least_config);
+    least.set_instances(test_service_id_, {a, b});
+    least.select(test_service_id_, selected);
+    least.select(test_service_id_, selected);
+    least.report_success(test_service_id_, a, std::chrono::microseconds(100));
+    ASSERT_TRUE(least.select(test_service_id_, selected));
+    EXPECT_EQ(selected, a);  // a has nothing outstanding, b has one
+
+    LoadBalancerConfig ewma_config;
+    ewma_config.strategy = LoadBalancingStrategy::LATENCY_EWMA;
+    LoadBalancer ewma(ewma_config);
+    ewma.set_instances(test_service_id_, {a, b});
+    ewma.report_success(test_service_id_, a, std::chrono::microseconds(50));
+    ewma.report_success(test_service_id_, b, std::chrono::microseconds(5000));
+    Endpoint fast = a;
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(ewma.select(test_service_id_, selected));
+        EXPECT_EQ(selected, fast);
+        ewma.release(test_service_id_, selected);
+    }
+}
+
+// LATENCY_EWMA neither favours unsampled instances nor forgets timeouts
+TEST_F(RpcTest, LoadBalancerLatencyEstimates) {
+    using someip::transport::Endpoint;
+    Endpoint a("10.0.0.1", 30509), c("10.0.0.3", 30509);
+    Endpoint selected;
+
+    LoadBalancerConfig config;
+    config.strategy = LoadBalancingStrategy::LATENCY_EWMA;
+    config.max_consecutive_failures = 100;
+    LoadBalancer balancer(config);
+    balancer.set_instances(test_service_id_, {a, c});
+    balancer.report_success(test_service_id_, a, std::chrono::microseconds(100));
+
+    // The unsampled instance is estimated at the mean, so load on it counts
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(balancer.select(test_service_id_, selected));
+    }
+    EXPECT_EQ(balancer.get_outstanding(test_service_id_, a), 2u);
+    EXPECT_EQ(balancer.get_outstanding(test_service_id_, c), 2u);
+    for (int i = 0; i < 4; ++i) {
+        balancer.release(test_service_id_, a);
+        balancer.release(test_service_id_, c);
+    }
+
+    // A timing-out instance loses to a slower but responsive one
+    balancer.report_success(test_service_id_, c, std::chrono::microseconds(100));
+    balancer.report_success(test_service_id_, a, std::chrono::microseconds(5000));
+    balancer.report_failure(test_service_id_, c, std::chrono::microseconds(100000));
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(balancer.select(test_service_id_, selected));
+        EXPECT_EQ(selected, a);
+        balancer.release(test_service_id_, selected);
+    }
+}
+
+// Unresponsive instances are ejected and re-admitted later
+TEST_F(RpcTest, LoadBalancerEjection) {
+    using someip::transport::Endpoint;
+    Endpoint a("10.0.0.1", 30509), b("10.0.0.2", 30509);
+    Endpoint selected;
+
+    LoadBalancerConfig config;
+    config.max_consecutive_failures = 2;
+    config.ejection_duration = std::chrono::milliseconds(50);
+    LoadBalancer balancer(config);
+    balancer.set_instances(test_service_id_, {a, b});
+
+    balancer.report_failure(test_service_id_, a);
+    EXPECT_FALSE(balancer.is_ejected(test_service_id_, a));
+    balancer.report_failure(test_service_id_, a);
+    EXPECT_TRUE(balancer.is_ejected(test_service_id_, a));
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(balancer.select(test_service_id_, selected));
+        EXPECT_EQ(selected, b);
+    }
+
+    // With every instance ejected, all of them are used again
+    balancer.report_failure(test_service_id_, b);
+    balancer.report_failure(test_service_id_, b);
+    std::set<Endpoint> used;
+    for (int i = 0; i < 4; ++i) {
+        balancer.select(test_service_id_, selected);
+        used.insert(selected);
+    }
+    EXPECT_EQ(used.size(), 2u);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    EXPECT_FALSE(balancer.is_ejected(test_service_id_, a));
+
+    // Statistics survive an SD refresh that keeps the instance
+    balancer.report_failure(test_service_id_, a);
+    balancer.set_instances(test_service_id_, {a});
+    balancer.report_failure(test_service_id_, a);
+    EXPECT_TRUE(balancer.is_ejected(test_service_id_, a));
+}
+
+// Discovered instances feed the balancer
+TEST_F(RpcTest, LoadBalancerFromServiceDiscovery) {
+    using someip::sd::ServiceInstance;
+    ServiceInstance first(test_service_id_, 1), second(test_service_id_, 2), other(0x9999, 1), tcp(test_service_id_, 3);
+    first.ip_address = "192.168.1.10";
+    first.port = 30509;
+    second.ip_address = "192.168.1.11";
+    second.port = 30509;
+    other.ip_address = "192.168.1.12";
+    other.port = 30509;
+    tcp.ip_address = "192.168.1.13";
+    tcp.port = 30509;
+    tcp.protocol = 0x06;
+
+    LoadBalancer balancer;
+    update_load_balancer(balancer, test_service_id_, {first, second, other, tcp});
+    EXPECT_EQ(balancer.get_instances(test_service_id_),
+              (std::vector<someip::transport::Endpoint>{{"192.168.1.10", 30509}, {"192.168.1.11", 30509}}));
+
+    update_load_balancer(balancer, test_service_id_, {});
+    EXPECT_TRUE(balancer.get_instances(test_service_id_).empty());
+}
+
+// The client spreads calls over instances and ejects the silent one
+TEST_F(RpcTest, ClientLoadBalancing) {
+    using someip::transport::Endpoint;
+    auto runtime = std::make_shared<ServerRuntime>(Endpoint("127.0.0.1", 0));
+    RpcServer server(test_service_id_, runtime);
+    std::atomic<int> handler_calls{0};
+    server.register_method(test_method_id_,
+        [&handler_calls](uint16_t, uint16_t, someip::PayloadView, std::vector<uint8_t>& output) {
+            handler_calls++;
+            output = {0x01};
+            return RpcResult::SUCCESS;
+        });
+    ASSERT_TRUE(server.initialize());
+
+    // A bound socket that never answers
+    someip::transport::UdpTransport silent(Endpoint("127.0.0.1", 0));
+    ASSERT_EQ(silent.start(), someip::Result::SUCCESS);
+
+    LoadBalancerConfig config;
+    config.max_consecutive_failures = 1;
+    auto balancer = std::make_shared<LoadBalancer>(config);
+    balancer->set_instances(test_service_id_, {runtime->get_local_endpoint(), silent.get_local_endpoint()});
+
+    RpcClient client(client_id_);
+    client.set_load_balancer(balancer);
+    ASSERT_TRUE(client.initialize());
+
+    RpcTimeout timeout;
+    timeout.response_timeout = std::chrono::milliseconds(100);
+    auto first = client.call_method_sync(test_service_id_, test_method_id_, {}, timeout);
+    auto second = client.call_method_sync(test_service_id_, test_method_id_, {}, timeout);
+    EXPECT_NE(first.result == RpcResult::SUCCESS, second.result == RpcResult::SUCCESS);
+    EXPECT_TRUE(balancer->is_ejected(test_service_id_, silent.get_local_endpoint()));
+
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(client.call_method_sync(test_service_id_, test_method_id_, {}, timeout).result,
+                  RpcResult::SUCCESS);
+    }
+    EXPECT_EQ(handler_calls.load(), 5);
+    EXPECT_EQ(balancer->get_outstanding(test_service_id_, runtime->get_local_endpoint()), 0u);
+
+    client.shutdown();
+    (void)silent.stop();
+}
+
+// Async calls time out without a sync waiter
+TEST_F(RpcTest, ClientAsyncTimeout) {
+    RpcClient client(client_id_);
+    client.set_server_endpoint(someip::transport::Endpoint("127.0.0.1", 9));
+    ASSERT_TRUE(client.initialize());
+
+    std::promise<RpcResponse> promise;
+    auto future = promise.get_future();
+    RpcTimeout timeout;
+    timeout.response_timeout = std::chrono::milliseconds(50);
+    ASSERT_NE(client.call_method_async(test_service_id_, test_method_id_, {},
+        [&promise](const RpcResponse& response) { promise.set_value(response); }, timeout), 0u);
+
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+    EXPECT_EQ(future.get().result, RpcResult::TIMEOUT);
+    client.shutdown();
+}
+
+// Fire-and-forget requests run the handler and never produce a response
+TEST_F(RpcTest, RequestNoReturn) {
+    using someip::transport::Endpoint;
+    auto runtime = std::make_shared<ServerRuntime>(Endpoint("127.0.0.1", 0));
+    RpcServer server(test_service_id_, runtime);
+    std::mutex received_mutex;
+    std::condition_variable received_cv;
+    std::vector<uint8_t> received;
+    server.register_method(test_method_id_,
+        [&](uint16_t, uint16_t, someip::PayloadView input, std::vector<uint8_t>& output) {
+            std::scoped_lock lock(received_mutex);
+            received.insert(received.end(), input.begin(), input.end());
+            output = {0xFF};
+            received_cv.notify_all();
+            return RpcResult::SUCCESS;
+        });
+    ASSERT_TRUE(server.initialize());
+
+    RpcClient client(client_id_);
+    client.set_server_endpoint(runtime->get_local_endpoint());
+    ASSERT_TRUE(client.initialize());
+
+    EXPECT_TRUE(client.send_request_no_return(test_service_id_, test_method_id_, {0x01}));
+    std::vector<NoReturnRequest> batch;
+    for (uint8_t value = 0x02; value <= 0x04; ++value) {
+        batch.push_back(NoReturnRequest{test_method_id_, {value}});
+    }
+    EXPECT_TRUE(client.send_requests_no_return(test_service_id_, batch));
+
+    {
+        std::unique_lock lock(received_mutex);
+        ASSERT_TRUE(received_cv.wait_for(lock, std::chrono::seconds(2),
+                                         [&received] { return received.size() >= 4; }));
+        EXPECT_EQ(received, (std::vector<uint8_t>{0x01, 0x02, 0x03, 0x04}));
+    }
+    EXPECT_EQ(client.get_statistics().total_calls, 0u);
+
+    // Neither results nor errors are reported back for REQUEST_NO_RETURN
+    CollectingListener listener;
+    someip::transport::UdpTransport raw(Endpoint("127.0.0.1", 0));
+    raw.set_listener(&listener);
+    ASSERT_EQ(raw.start(), someip::Result::SUCCESS);
+    for (uint16_t service_id : {test_service_id_, static_cast<uint16_t>(0x7777)}) {
+        for (uint16_t method_id : {test_method_id_, static_cast<uint16_t>(0x0999)}) {
+            someip::Message request(someip::MessageId(service_id, method_id),
+                                    someip::RequestId(client_id_, method_id),
+                                    someip::MessageType::REQUEST_NO_RETURN);
+            ASSERT_EQ(raw.send_message(request, runtime->get_local_endpoint()), someip::Result::SUCCESS);
+        }
+    }
+    EXPECT_FALSE(listener.wait_for(1, std::chrono::milliseconds(200)));
+
+    client.shutdown();
+    (void)raw.stop();
+}
+
+// Token buckets per client and method, DRR order across clients
+TEST_F(RpcTest, AdmissionControllerFairness) {
+    AdmissionConfig config;
+    config.client_limit = RateLimit{0.001, 3};
+    config.method_limits[0x0002] = RateLimit{0.001, 1};
+    config.client_queue_capacity = 4;
+    config.quantum = 100;
+    AdmissionController controller(config);
+
+    std::vector<int> order;
+    auto record = [&order](int value) { return [&order, value]() { order.push_back(value); }; };
+
+    // Client 1: burst of three, then rate-limited
+    EXPECT_EQ(controller.admit(1, 0x0001, 100, record(11)), AdmissionResult::ADMITTED);
+    EXPECT_EQ(controller.admit(1, 0x0001, 100, record(12)), AdmissionResult::ADMITTED);
+    EXPECT_EQ(controller.admit(1, 0x0001, 100, record(13)), AdmissionResult::ADMITTED);
+    EXPECT_EQ(controller.admit(1, 0x0001, 100, record(14)), AdmissionResult::RATE_LIMITED);
+
+    // Client 2: the method limit applies before the client limit
+    EXPECT_EQ(controller.admit(2, 0x0002, 100, record(21)), AdmissionResult::ADMITTED);
+    EXPECT_EQ(controller.admit(2, 0x0002, 100, record(22)), AdmissionResult::RATE_LIMITED);
+    EXPECT_EQ(controller.admit(2, 0x0001, 100, record(23)), AdmissionResult::ADMITTED);
+    EXPECT_EQ(controller.get_queued(), 5u);
+    EXPECT_EQ(controller.get_rejected(), 2u);
+
+    AdmissionController::Task task;
+    while (controller.pop(task)) {
+        task();
+    }
+    EXPECT_EQ(order, (std::vector<int>{11, 21, 12, 23, 13}));
+
+    // Per-client queue bound
+    AdmissionConfig unlimited;
+    unlimited.client_queue_capacity = 2;
+    AdmissionController bounded(unlimited);
+    EXPECT_EQ(bounded.admit(1, 0x0001, 16, [] {}), AdmissionResult::ADMITTED);
+    EXPECT_EQ(bounded.admit(1, 0x0001, 16, [] {}), AdmissionResult::ADMITTED);
+    EXPECT_EQ(bounded.admit(1, 0x0001, 16, [] {}), AdmissionResult::QUEUE_FULL);
+    EXPECT_EQ(bounded.admit(2, 0x0001, 16, [] {}), AdmissionResult::ADMITTED);
+
+    bounded.close();
+    EXPECT_EQ(bounded.get_queued(), 0u);
+    EXPECT_EQ(bounded.admit(2, 0x0001, 16, [] {}), AdmissionResult::CLOSED);
+    EXPECT_FALSE(bounded.wait_pop(task));
+}
+
+// A flooding client is refused with E_NOT_READY, others are still served
+TEST_F(RpcTest, ServerAdmissionControl) {
+    using someip::transport::Endpoint;
+    auto runtime = std::make_shared<ServerRuntime>(Endpoint("127.0.0.1", 0));
+    RpcServer server(test_service_id_, runtime);
+    server.register_method(test_method_id_,
+        [](uint16_t, uint16_t, someip::PayloadView, std::vector<uint8_t>& output) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            output = {0x01};
+            return RpcResult::SUCCESS;
+        });
+    AdmissionConfig config;
+    config.client_limit = RateLimit{20.0, 10};
+    ASSERT_TRUE(server.enable_admission_control(config));
+    ASSERT_TRUE(server.initialize());
+    EXPECT_FALSE(server.enable_admission_control(config));
+
+    CollectingListener listener;
+    someip::transport::UdpTransport client(Endpoint("127.0.0.1", 0));
+    client.set_listener(&listener);
+    ASSERT_EQ(client.start(), someip::Result::SUCCESS);
+
+    constexpr uint16_t FLOODER = 0x0001;
+    constexpr uint16_t WELL_BEHAVED = 0x0002;
+    auto send = [&](uint16_t client_id, uint16_t session_id) {
+        someip::Message request(someip::MessageId(test_service_id_, test_method_id_),
+                                someip::RequestId(client_id, session_id),
+                                someip::MessageType::REQUEST);
+        ASSERT_EQ(client.send_message(request, runtime->get_local_endpoint()), someip::Result::SUCCESS);
+    };
+    for (uint16_t session_id = 1; session_id <= 50; ++session_id) {
+        send(FLOODER, session_id);
+        if (session_id % 10 == 0) {
+            send(WELL_BEHAVED, session_id);
+        }
+    }
+    ASSERT_TRUE(listener.wait_for(55, std::chrono::seconds(5)));
+
+    size_t flooder_ok = 0;
+    size_t flooder_refused = 0;
+    size_t well_behaved_ok = 0;
+    for (const auto& response : listener.messages()) {
+        bool ok = response->get_return_code() == someip::ReturnCode::E_OK;
+        if (response->get_client_id() == WELL_BEHAVED) {
+            well_behaved_ok += ok ? 1 : 0;
+        } else if (ok) {
+            flooder_ok++;
+        } else {
+            EXPECT_EQ(response->get_return_code(), someip::ReturnCode::E_NOT_READY);
+            flooder_refused++;
+        }
+    }
+    EXPECT_EQ(well_behaved_ok, 5u);
+    EXPECT_GE(flooder_ok, 10u);
+    EXPECT_GT(flooder_refused, 0u);
+    EXPECT_EQ(flooder_ok + flooder_refused, 50u);
+    EXPECT_EQ(server.get_statistics().rejected_calls, flooder_refused);
+
+    server.shutdown();
+    (void)client.stop();
+}
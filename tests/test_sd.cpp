@@ -16,10 +16,17 @@
 #include <sd/sd_message.h>
 #include <sd/sd_server.h>
 #include <sd/sd_client.h>
+#include <sd/sd_cache.h>
+#include <sd/static_discovery.h>
+#include <transport/udp_transport.h>
+#include <someip/message.h>
 #include <arpa/inet.h>
 #include <thread>
 #include <chrono>
+#include <algorithm>
 #include <atomic>
+#include <cstdio>
+#include <unistd.h>
 
 using namespace someip::sd;
 
@@ -481,6 +488,102 @@ TEST_F(SdTest, SdMessageSerialization) {
     EXPECT_EQ(serialized[0] & 0x80, 0x80);  // Reboot flag
 }
 
+// Service entry fields sit where deserialize() reads them and survive a round trip
+TEST_F(SdTest, ServiceEntryRoundTrip) {
+    ServiceEntry original(EntryType::OFFER_SERVICE);
+    original.set_index1(0);
+    original.set_service_id(0x1234);
+    original.set_instance_id(0x5678);
+    original.set_major_version(3);
+    original.set_ttl(0x00ABCDEF);
+
+    auto serialized = original.serialize();
+    ASSERT_EQ(serialized.size(), 14u);
+    EXPECT_EQ(serialized[5], 0x12);   // Service ID (bytes 5-6)
+    EXPECT_EQ(serialized[6], 0x34);
+    EXPECT_EQ(serialized[7], 0x56);   // Instance ID (bytes 7-8)
+    EXPECT_EQ(serialized[8], 0x78);
+    EXPECT_EQ(serialized[9], 3);      // Major version (byte 9)
+
+    // The entry alone is enough input: the base check must not demand more
+    ServiceEntry parsed;
+    size_t offset = 0;
+    ASSERT_TRUE(parsed.deserialize(serialized, offset));
+    EXPECT_EQ(offset, serialized.size());
+    EXPECT_EQ(parsed.get_type(), EntryType::OFFER_SERVICE);
+    EXPECT_EQ(parsed.get_index1(), 0);
+    EXPECT_EQ(parsed.get_service_id(), 0x1234);
+    EXPECT_EQ(parsed.get_instance_id(), 0x5678);
+    EXPECT_EQ(parsed.get_major_version(), 3);
+    EXPECT_EQ(parsed.get_ttl(), 0x00ABCDEFu);
+
+    serialized.pop_back();
+    offset = 0;
+    EXPECT_FALSE(ServiceEntry().deserialize(serialized, offset));
+}
+
+// Event group entries carry the event group ID after the TTL (bytes 14-15)
+TEST_F(SdTest, EventGroupEntryRoundTrip) {
+    EventGroupEntry original(EntryType::SUBSCRIBE_EVENTGROUP);
+    original.set_service_id(0xABCD);
+    original.set_instance_id(0x0001);
+    original.set_major_version(2);
+    original.set_ttl(1800);
+    original.set_eventgroup_id(0x0010);
+
+    auto serialized = original.serialize();
+    ASSERT_EQ(serialized.size(), 16u);
+    EXPECT_EQ(serialized[5], 0xAB);
+    EXPECT_EQ(serialized[6], 0xCD);
+    EXPECT_EQ(serialized[14], 0x00);
+    EXPECT_EQ(serialized[15], 0x10);
+
+    EventGroupEntry parsed;
+    size_t offset = 0;
+    ASSERT_TRUE(parsed.deserialize(serialized, offset));
+    EXPECT_EQ(offset, serialized.size());
+    EXPECT_EQ(parsed.get_service_id(), 0xABCD);
+    EXPECT_EQ(parsed.get_instance_id(), 0x0001);
+    EXPECT_EQ(parsed.get_major_version(), 2);
+    EXPECT_EQ(parsed.get_ttl(), 1800u);
+    EXPECT_EQ(parsed.get_eventgroup_id(), 0x0010);
+}
+
+// A message ending in a 14-byte service entry parses back entry by entry
+TEST_F(SdTest, SdMessageEntriesRoundTrip) {
+    SdMessage original;
+    auto subscribe = std::make_unique<EventGroupEntry>(EntryType::SUBSCRIBE_EVENTGROUP);
+    subscribe->set_service_id(0x1111);
+    subscribe->set_instance_id(0x0002);
+    subscribe->set_eventgroup_id(0x0003);
+    subscribe->set_ttl(5);
+    original.add_entry(std::move(subscribe));
+    auto offer = std::make_unique<ServiceEntry>(EntryType::OFFER_SERVICE);
+    offer->set_service_id(0x2222);
+    offer->set_instance_id(0x0004);
+    offer->set_major_version(1);
+    offer->set_ttl(30);
+    original.add_entry(std::move(offer));
+
+    SdMessage parsed;
+    ASSERT_TRUE(parsed.deserialize(original.serialize()));
+    ASSERT_EQ(parsed.get_entries().size(), 2u);
+
+    auto* parsed_subscribe = dynamic_cast<EventGroupEntry*>(parsed.get_entries()[0].get());
+    ASSERT_NE(parsed_subscribe, nullptr);
+    EXPECT_EQ(parsed_subscribe->get_service_id(), 0x1111);
+    EXPECT_EQ(parsed_subscribe->get_instance_id(), 0x0002);
+    EXPECT_EQ(parsed_subscribe->get_eventgroup_id(), 0x0003);
+    EXPECT_EQ(parsed_subscribe->get_ttl(), 5u);
+
+    auto* parsed_offer = dynamic_cast<ServiceEntry*>(parsed.get_entries()[1].get());
+    ASSERT_NE(parsed_offer, nullptr);
+    EXPECT_EQ(parsed_offer->get_service_id(), 0x2222);
+    EXPECT_EQ(parsed_offer->get_instance_id(), 0x0004);
+    EXPECT_EQ(parsed_offer->get_major_version(), 1);
+    EXPECT_EQ(parsed_offer->get_ttl(), 30u);
+}
+
 // ============================================================================
 // SD Client/Server Integration Tests
 // ============================================================================
@@ -703,3 +806,430 @@ TEST_F(SdTest, PortConversion) {
             << "Round-trip failed for port: " << port;
     }
 }
+
+// Shutdown does not wait for the next (possibly hour-long) offer delay
+TEST_F(SdIntegrationTest, ServerShutdownIsPrompt) {
+    auto config = create_test_config(get_unique_port(), get_unique_port());
+    config.initial_delay = std::chrono::milliseconds(60000);
+    SdServer server(config);
+    ASSERT_TRUE(server.initialize());
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    auto started = std::chrono::steady_clock::now();
+    server.shutdown();
+    EXPECT_LT(std::chrono::steady_clock::now() - started, std::chrono::milliseconds(500));
+}
+
+// ============================================================================
+// Persistent SD Cache Tests
+// ============================================================================
+
+namespace {
+
+std::string temp_cache_path(const char* name) {
+    std::string path = "/tmp/someip_" + std::string(name) + "_" + std::to_string(getpid()) + ".cache";
+    std::remove(path.c_str());
+    return path;
+}
+
+ServiceInstance cached_instance(uint16_t service_id, uint16_t instance_id, uint16_t port) {
+    ServiceInstance instance(service_id, instance_id, 1, 0);
+    instance.ip_address = "127.0.0.1";
+    instance.port = port;
+    instance.ttl_seconds = 3600;
+    return instance;
+}
+
+// Send an SD offer (ttl > 0) or stop offer (ttl = 0) to the client's unicast port.
+// No endpoint option: the client keeps the endpoint it already knows.
+void send_offer(uint16_t client_port, uint16_t service_id, uint16_t instance_id, uint32_t ttl) {
+    auto entry = std::make_unique<ServiceEntry>(EntryType::OFFER_SERVICE);
+    entry->set_service_id(service_id);
+    entry->set_instance_id(instance_id);
+    entry->set_major_version(1);
+    entry->set_ttl(ttl);
+
+    SdMessage sd_message;
+    sd_message.add_entry(std::move(entry));
+
+    someip::Message message(someip::MessageId(0xFFFF, someip::SOMEIP_SD_METHOD_ID), someip::RequestId(0x0000, 0x0000),
+                            someip::MessageType::NOTIFICATION, someip::ReturnCode::E_OK);
+    message.set_payload(sd_message.serialize());
+
+    someip::transport::UdpTransport sender(someip::transport::Endpoint("127.0.0.1", 0));
+    ASSERT_EQ(sender.start(), someip::Result::SUCCESS);
+    ASSERT_EQ(sender.send_message(message, someip::transport::Endpoint("127.0.0.1", client_port)),
+              someip::Result::SUCCESS);
+    sender.stop();
+}
+
+// The subscriber is the sender: its endpoint is taken from the datagram
+void send_subscribe(someip::transport::UdpTransport& sender, uint16_t server_port, uint16_t eventgroup_id,
+                    uint32_t ttl) {
+    auto entry = std::make_unique<EventGroupEntry>(EntryType::SUBSCRIBE_EVENTGROUP);
+    entry->set_service_id(0x1234);
+    entry->set_instance_id(0x0001);
+    entry->set_eventgroup_id(eventgroup_id);
+    entry->set_major_version(1);
+    entry->set_ttl(ttl);
+
+    SdMessage sd_message;
+    sd_message.add_entry(std::move(entry));
+
+    someip::Message message(someip::MessageId(0xFFFF, someip::SOMEIP_SD_METHOD_ID), someip::RequestId(0x0000, 0x0000),
+                            someip::MessageType::NOTIFICATION, someip::ReturnCode::E_OK);
+    message.set_payload(sd_message.serialize());
+    ASSERT_EQ(sender.send_message(message, someip::transport::Endpoint("127.0.0.1", server_port)),
+              someip::Result::SUCCESS);
+}
+
+template <typename Predicate>
+bool wait_until(Predicate predicate) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (!predicate()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return true;
+}
+
+} // namespace
+
+TEST_F(SdTest, PersistentCacheRoundTrip) {
+    std::string path = temp_cache_path("cache_round_trip");
+    {
+        SdCache cache;
+        ASSERT_TRUE(cache.open(path, 4));
+        EXPECT_TRUE(cache.load().empty());
+        EXPECT_TRUE(cache.store(cached_instance(0x1234, 0x0001, 30501)));
+        EXPECT_TRUE(cache.store(cached_instance(0x5678, 0x0002, 30502)));
+        EXPECT_TRUE(cache.store(cached_instance(0x1234, 0x0001, 30503)));  // Refresh in place
+
+        ServiceInstance no_address(0x9999, 0x0001);
+        EXPECT_FALSE(cache.store(no_address));
+    }
+
+    SdCache cache;
+    ASSERT_TRUE(cache.open(path, 4));
+    auto loaded = cache.load();
+    ASSERT_EQ(loaded.size(), 2u);
+    auto first = std::find_if(loaded.begin(), loaded.end(),
+        [](const ServiceInstance& svc) { return svc.service_id == 0x1234; });
+    ASSERT_NE(first, loaded.end());
+    EXPECT_EQ(first->ip_address, "127.0.0.1");
+    EXPECT_EQ(first->port, 30503);
+    EXPECT_EQ(first->major_version, 1);
+    EXPECT_GT(first->ttl_seconds, 3500u);
+    EXPECT_LE(first->ttl_seconds, 3600u);
+
+    cache.remove(0x1234, 0x0001);
+    EXPECT_EQ(cache.load().size(), 1u);
+    cache.close();
+
+    // A different capacity is another layout: the file starts over
+    ASSERT_TRUE(cache.open(path, 8));
+    EXPECT_TRUE(cache.load().empty());
+    cache.close();
+    std::remove(path.c_str());
+}
+
+TEST_F(SdTest, PersistentCacheEvictsClosestToExpiry) {
+    std::string path = temp_cache_path("cache_full");
+    SdCache cache;
+    ASSERT_TRUE(cache.open(path, 2));
+
+    auto short_lived = cached_instance(0x1000, 0x0001, 30501);
+    short_lived.ttl_seconds = 10;
+    EXPECT_TRUE(cache.store(short_lived));
+    EXPECT_TRUE(cache.store(cached_instance(0x2000, 0x0001, 30502)));
+    EXPECT_TRUE(cache.store(cached_instance(0x3000, 0x0001, 30503)));
+
+    auto loaded = cache.load();
+    ASSERT_EQ(loaded.size(), 2u);
+    for (const auto& instance : loaded) {
+        EXPECT_NE(instance.service_id, 0x1000);
+    }
+    cache.close();
+    std::remove(path.c_str());
+}
+
+// Services seen before a restart are usable immediately and then confirmed by live SD
+TEST_F(SdIntegrationTest, ClientWarmStartFromCache) {
+    std::string path = temp_cache_path("client_warm_start");
+    {
+        SdCache cache;
+        ASSERT_TRUE(cache.open(path, 100));
+        ASSERT_TRUE(cache.store(cached_instance(0x1234, 0x0001, 30501)));
+    }
+
+    uint16_t client_port = get_unique_port();
+    auto config = create_test_config(client_port, get_unique_port());
+    config.cache_file = path;
+    SdClient client(config);
+    ASSERT_TRUE(client.initialize());
+
+    auto services = client.get_available_services(0x1234);
+    ASSERT_EQ(services.size(), 1u);
+    EXPECT_TRUE(services[0].from_cache);
+    EXPECT_EQ(services[0].port, 30501);
+
+    // find_service answers from the cache without waiting for an offer
+    std::vector<ServiceInstance> found;
+    ASSERT_TRUE(client.find_service(0x1234, [&](const std::vector<ServiceInstance>& result) {
+        found = result;
+    }));
+    ASSERT_EQ(found.size(), 1u);
+    EXPECT_EQ(found[0].port, 30501);
+
+    // A live offer confirms the instance
+    send_offer(client_port, 0x1234, 0x0001, 5);
+    ASSERT_TRUE(wait_until([&] {
+        auto current = client.get_available_services(0x1234);
+        return current.size() == 1 && !current[0].from_cache;
+    }));
+    EXPECT_EQ(client.get_available_services(0x1234)[0].port, 30501);
+    EXPECT_EQ(client.get_available_services(0x1234)[0].ttl_seconds, 5u);
+
+    // A stop offer evicts it from the cache file too
+    send_offer(client_port, 0x1234, 0x0001, 0);
+    ASSERT_TRUE(wait_until([&] { return client.get_available_services(0x1234).empty(); }));
+    client.shutdown();
+
+    SdCache cache;
+    ASSERT_TRUE(cache.open(path, 100));
+    EXPECT_TRUE(cache.load().empty());
+    cache.close();
+    std::remove(path.c_str());
+}
+
+TEST_F(SdIntegrationTest, ClientEvictsUnconfirmedCacheEntries) {
+    std::string path = temp_cache_path("client_evict");
+    {
+        SdCache cache;
+        ASSERT_TRUE(cache.open(path, 100));
+        ASSERT_TRUE(cache.store(cached_instance(0x1234, 0x0001, 30501)));
+    }
+
+    auto config = create_test_config(get_unique_port(), get_unique_port());
+    config.cache_file = path;
+    config.cyclic_offer = std::chrono::milliseconds(20);
+    SdClient client(config);
+    ASSERT_TRUE(client.initialize());
+    EXPECT_EQ(client.get_available_services(0x1234).size(), 1u);
+
+    // No offer within two cyclic intervals: the entry is dropped
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    EXPECT_TRUE(client.get_available_services(0x1234).empty());
+
+    bool find_answered = false;
+    ASSERT_TRUE(client.find_service(0x1234, [&](const std::vector<ServiceInstance>&) {
+        find_answered = true;
+    }));
+    EXPECT_FALSE(find_answered);
+    client.shutdown();
+
+    SdCache cache;
+    ASSERT_TRUE(cache.open(path, 100));
+    EXPECT_TRUE(cache.load().empty());
+    cache.close();
+    std::remove(path.c_str());
+}
+
+// ============================================================================
+// Static Discovery Tests
+// ============================================================================
+
+namespace {
+
+const char* STATIC_TOPOLOGY = R"({
+    "services": [
+        {
+            "service_id": "0x1234", "instance_id": 1, "major_version": 2,
+            "address": "127.0.0.1", "port": 30509, "protocol": "udp",
+            "eventgroups": [ { "eventgroup_id": 1, "subscribers": ["127.0.0.1:41000", "127.0.0.1:41001"] } ]
+        },
+        { "service_id": 22136, "instance_id": "0x0002", "address": "10.0.0.2", "port": 30510,
+          "protocol": "tcp", "ttl": 60 }
+    ]
+})";
+
+std::string write_static_topology(const char* name, const std::string& json) {
+    std::string path = "/tmp/someip_" + std::string(name) + "_" + std::to_string(getpid()) + ".json";
+    FILE* file = std::fopen(path.c_str(), "w");
+    std::fputs(json.c_str(), file);
+    std::fclose(file);
+    return path;
+}
+
+} // namespace
+
+TEST_F(SdTest, StaticDiscoveryParse) {
+    StaticDiscoveryConfig config;
+    std::string error;
+    ASSERT_TRUE(parse_static_discovery(STATIC_TOPOLOGY, config, &error)) << error;
+    ASSERT_EQ(config.services.size(), 2u);
+
+    const auto& first = config.services[0].instance;
+    EXPECT_EQ(first.service_id, 0x1234);
+    EXPECT_EQ(first.instance_id, 1);
+    EXPECT_EQ(first.major_version, 2);
+    EXPECT_EQ(first.ip_address, "127.0.0.1");
+    EXPECT_EQ(first.port, 30509);
+    EXPECT_EQ(first.protocol, 0x11);
+
+    const auto& second = config.services[1].instance;
+    EXPECT_EQ(second.service_id, 0x5678);
+    EXPECT_EQ(second.instance_id, 2);
+    EXPECT_EQ(second.protocol, 0x06);
+    EXPECT_EQ(second.ttl_seconds, 60u);
+
+    const auto* eventgroup = config.find_eventgroup(0x1234, 1, 1);
+    ASSERT_NE(eventgroup, nullptr);
+    EXPECT_EQ(eventgroup->subscribers.size(), 2u);
+    EXPECT_EQ(config.find_eventgroup(0x1234, 1, 2), nullptr);
+    EXPECT_EQ(config.find(0x1234, 2), nullptr);
+}
+
+TEST_F(SdTest, StaticDiscoveryRejectsInvalidConfig) {
+    const std::vector<std::string> invalid = {
+        "",
+        "{\"services\": [}",
+        "{\"services\": []} trailing",
+        "{\"services\": {}}",
+        "{\"services\": [{\"service_id\": 1, \"instance_id\": 1, \"address\": \"127.0.0.1\"}]}",
+        "{\"services\": [{\"service_id\": 1, \"instance_id\": 1, \"address\": \"host\", \"port\": 1}]}",
+        "{\"services\": [{\"service_id\": 70000, \"instance_id\": 1, \"address\": \"127.0.0.1\", \"port\": 1}]}",
+        "{\"services\": [{\"service_id\": \"-1\", \"instance_id\": 1, \"address\": \"127.0.0.1\", \"port\": 1}]}",
+        "{\"services\": [{\"service_id\": 1, \"instance_id\": 1, \"address\": \"127.0.0.1\", \"port\": 1, "
+        "\"protocol\": \"sctp\"}]}",
+        "{\"services\": [{\"service_id\": 1, \"instance_id\": 1, \"address\": \"127.0.0.1\", \"port\": 1},"
+        " {\"service_id\": 1, \"instance_id\": 1, \"address\": \"127.0.0.1\", \"port\": 2}]}",
+    };
+
+    for (const auto& json : invalid) {
+        StaticDiscoveryConfig config;
+        std::string error;
+        EXPECT_FALSE(parse_static_discovery(json, config, &error)) << json;
+        EXPECT_FALSE(error.empty()) << json;
+    }
+
+    StaticDiscoveryConfig config;
+    EXPECT_FALSE(load_static_discovery("/nonexistent/topology.json", config));
+}
+
+// Configured services are available at initialize() without any SD traffic
+TEST_F(SdIntegrationTest, StaticDiscoveryClient) {
+    std::string path = write_static_topology("static_client", STATIC_TOPOLOGY);
+    auto config = create_test_config(get_unique_port(), get_unique_port());
+    config.static_config_file = path;
+    SdClient client(config);
+    ASSERT_TRUE(client.initialize());
+
+    EXPECT_EQ(client.get_available_services().size(), 2u);
+
+    std::vector<ServiceInstance> found;
+    ASSERT_TRUE(client.find_service(0x1234, [&](const std::vector<ServiceInstance>& result) {
+        found = result;
+    }));
+    ASSERT_EQ(found.size(), 1u);
+    EXPECT_EQ(found[0].port, 30509);
+
+    bool not_found_answered = false;
+    ASSERT_TRUE(client.find_service(0x9999, [&](const std::vector<ServiceInstance>& result) {
+        not_found_answered = result.empty();
+    }));
+    EXPECT_TRUE(not_found_answered);
+
+    int available = 0;
+    ASSERT_TRUE(client.subscribe_service(0x5678,
+        [&](const ServiceInstance& instance) { available += instance.instance_id == 2 ? 1 : 0; },
+        [](const ServiceInstance&) {}));
+    EXPECT_EQ(available, 1);
+
+    EXPECT_TRUE(client.subscribe_eventgroup(0x1234, 1, 1));
+    EXPECT_FALSE(client.subscribe_eventgroup(0x1234, 1, 7));
+    EXPECT_TRUE(client.unsubscribe_eventgroup(0x1234, 1, 1));
+
+    client.shutdown();
+    std::remove(path.c_str());
+
+    // A missing topology fails initialization
+    SdClient missing(config);
+    EXPECT_FALSE(missing.initialize());
+}
+
+TEST_F(SdIntegrationTest, StaticDiscoveryServer) {
+    std::string path = write_static_topology("static_server", STATIC_TOPOLOGY);
+    auto config = create_test_config(get_unique_port(), get_unique_port());
+    config.static_config_file = path;
+    SdServer server(config);
+    ASSERT_TRUE(server.initialize());
+
+    auto subscribers = server.get_eventgroup_subscribers(0x1234, 1, 1);
+    ASSERT_EQ(subscribers.size(), 2u);
+    EXPECT_EQ(subscribers[0], "127.0.0.1:41000");
+    EXPECT_TRUE(server.get_eventgroup_subscribers(0x1234, 1, 2).empty());
+
+    ServiceInstance instance(0x1234, 0x0001, 2, 0);
+    instance.ttl_seconds = 60;
+    EXPECT_TRUE(server.offer_service(instance, "127.0.0.1:30509"));
+    EXPECT_EQ(server.get_offered_services().size(), 1u);
+    EXPECT_TRUE(server.stop_offer_service(0x1234, 0x0001));
+
+    server.shutdown();
+    std::remove(path.c_str());
+}
+
+// With verification enabled, live SD still withdraws a configured service
+TEST_F(SdIntegrationTest, StaticDiscoveryVerification) {
+    std::string path = write_static_topology("static_verify", STATIC_TOPOLOGY);
+    uint16_t client_port = get_unique_port();
+    auto config = create_test_config(client_port, get_unique_port());
+    config.static_config_file = path;
+    config.static_verification = true;
+    SdClient client(config);
+    ASSERT_TRUE(client.initialize());
+    ASSERT_EQ(client.get_available_services(0x1234).size(), 1u);
+
+    send_offer(client_port, 0x1234, 0x0001, 0);
+    EXPECT_TRUE(wait_until([&] { return client.get_available_services(0x1234).empty(); }));
+    EXPECT_EQ(client.get_available_services(0x5678).size(), 1u);
+
+    client.shutdown();
+    std::remove(path.c_str());
+}
+
+// Dynamic subscriptions leave the group on StopSubscribe, on TTL expiry and on shutdown
+TEST_F(SdIntegrationTest, ServerRemovesEndedSubscriptions) {
+    uint16_t server_port = get_unique_port();
+    SdServer server(create_test_config(server_port, get_unique_port()));
+    ASSERT_TRUE(server.initialize());
+
+    using someip::transport::Endpoint;
+    using someip::transport::UdpTransport;
+    UdpTransport first(Endpoint("127.0.0.1", 0)), second(Endpoint("127.0.0.1", 0));
+    ASSERT_EQ(first.start(), someip::Result::SUCCESS);
+    ASSERT_EQ(second.start(), someip::Result::SUCCESS);
+    std::string second_address = "127.0.0.1:" + std::to_string(second.get_local_endpoint().get_port());
+
+    send_subscribe(first, server_port, 1, 3600);
+    send_subscribe(second, server_port, 1, 3600);
+    send_subscribe(first, server_port, 2, 1);
+    ASSERT_TRUE(wait_until([&] { return server.get_eventgroup_subscribers(0x1234, 1, 1).size() == 2 &&
+                                        server.get_eventgroup_subscribers(0x1234, 1, 2).size() == 1; }));
+
+    send_subscribe(first, server_port, 1, 0);
+    ASSERT_TRUE(wait_until([&] { return server.get_eventgroup_subscribers(0x1234, 1, 1).size() == 1; }));
+    EXPECT_EQ(server.get_eventgroup_subscribers(0x1234, 1, 1)[0], second_address);
+
+    // The one-second TTL of the other group runs out
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    EXPECT_TRUE(server.get_eventgroup_subscribers(0x1234, 1, 2).empty());
+
+    server.shutdown();
+    EXPECT_TRUE(server.get_eventgroup_subscribers(0x1234, 1, 1).empty());
+    first.stop();
+    second.stop();
+}
@@ -15,6 +15,7 @@
 #include <cmath>
 #include <limits>
 #include "serialization/serializer.h"
+#include "serialization/stream_deserializer.h"
 
 using namespace someip::serialization;
 
@@ -994,6 +995,84 @@ TEST_F(SerializationTest, DeserializationErrorHandling) {
     EXPECT_EQ(false_error.get_error(), someip::Result::MALFORMED_MESSAGE);
 }
 
+TEST_F(SerializationTest, StreamDeserializerReadsAcrossChunks) {
+    Serializer serializer;
+    serializer.serialize_uint16(0xBEEF);
+    serializer.serialize_string("hello");
+    serializer.serialize_double(-2.5);
+    serializer.serialize_int32(-7);
+    const std::vector<uint8_t>& bytes = serializer.get_buffer();
+
+    // One byte per chunk: every value spans chunk boundaries
+    StreamDeserializer stream;
+    size_t next = 0;
+    auto feed_until = [&](auto read) {
+        while (true) {
+            auto result = read();
+            if (result.is_success()) {
+                return result.get_value();
+            }
+            EXPECT_EQ(result.get_error(), someip::Result::WOULD_BLOCK);
+            EXPECT_LT(next, bytes.size());
+            stream.append(&bytes[next++], 1);
+        }
+    };
+
+    EXPECT_EQ(feed_until([&] { return stream.deserialize_uint16(); }), 0xBEEF);
+    EXPECT_EQ(feed_until([&] { return stream.deserialize_string(); }), "hello");
+    EXPECT_EQ(stream.get_position(), 2u + 4u + 5u + 1u);  // Padded to a 4-byte offset
+    EXPECT_EQ(feed_until([&] { return stream.deserialize_double(); }), -2.5);
+    EXPECT_EQ(feed_until([&] { return stream.deserialize_int32(); }), -7);
+    EXPECT_EQ(next, bytes.size());
+    EXPECT_EQ(stream.get_buffered_chunks(), 0u);
+
+    EXPECT_EQ(stream.deserialize_uint8().get_error(), someip::Result::WOULD_BLOCK);
+    stream.finish();
+    EXPECT_TRUE(stream.at_end());
+    EXPECT_EQ(stream.deserialize_uint8().get_error(), someip::Result::MALFORMED_MESSAGE);
+}
+
+TEST_F(SerializationTest, StreamDeserializerCheckpoints) {
+    Serializer serializer;
+    serializer.serialize_uint32(1);
+    serializer.serialize_uint32(2);
+    serializer.serialize_string("last");
+    const std::vector<uint8_t>& bytes = serializer.get_buffer();
+
+    StreamDeserializer stream;
+    stream.append(std::vector<uint8_t>(bytes.begin(), bytes.begin() + 6));
+
+    // A two-field record read all or nothing
+    auto checkpoint = stream.save();
+    ASSERT_EQ(stream.deserialize_uint32().get_value(), 1u);
+    EXPECT_EQ(stream.deserialize_uint32().get_error(), someip::Result::WOULD_BLOCK);
+    stream.restore(checkpoint);
+    EXPECT_EQ(stream.get_position(), 0u);
+    EXPECT_EQ(stream.get_available(), 6u);
+
+    stream.append(std::vector<uint8_t>(bytes.begin() + 6, bytes.begin() + 10));
+    checkpoint = stream.save();
+    ASSERT_EQ(stream.deserialize_uint32().get_value(), 1u);
+    ASSERT_EQ(stream.deserialize_uint32().get_value(), 2u);
+    EXPECT_EQ(stream.get_buffered_chunks(), 2u);  // Kept for the checkpoint
+    stream.release();
+    EXPECT_EQ(stream.get_buffered_chunks(), 1u);
+
+    // A string cut off by the end of the payload
+    stream.append(std::vector<uint8_t>(bytes.begin() + 10, bytes.begin() + 14));
+    stream.finish();
+    EXPECT_EQ(stream.deserialize_string().get_error(), someip::Result::MALFORMED_MESSAGE);
+    EXPECT_EQ(stream.get_position(), 8u);
+
+    // Padding after the last string of a finished payload may be missing
+    StreamDeserializer padded;
+    padded.append(std::vector<uint8_t>{0x00, 0x00, 0x00, 0x03, 'a', 'b', 'c'});
+    EXPECT_EQ(padded.deserialize_string().get_error(), someip::Result::WOULD_BLOCK);
+    padded.finish();
+    EXPECT_EQ(padded.deserialize_string().get_value(), "abc");
+    EXPECT_TRUE(padded.at_end());
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
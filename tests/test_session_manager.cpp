@@ -13,6 +13,10 @@
 
 #include <gtest/gtest.h>
 #include "core/session_manager.h"
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
 
 using namespace someip;
 
@@ -91,6 +95,98 @@ TEST_F(SessionManagerTest, SessionCount) {
     EXPECT_EQ(session_mgr_->get_active_session_count(), 0);
 }
 
+TEST_F(SessionManagerTest, AllocatorWrapsAroundSkippingZero) {
+    SessionIdAllocator allocator(0xFFFE);
+    EXPECT_EQ(allocator.next(), 0xFFFE);
+    EXPECT_EQ(allocator.next(), 0xFFFF);
+    EXPECT_EQ(allocator.next(), 1);
+    EXPECT_EQ(allocator.next(), 2);
+
+    SessionIdAllocator from_zero(0);
+    EXPECT_EQ(from_zero.next(), 1);
+}
+
+TEST_F(SessionManagerTest, ConcurrentAllocationIsUnique) {
+    constexpr int THREADS = 4;
+    constexpr int PER_THREAD = 10000;
+    SessionIdAllocator allocator;
+    std::vector<std::vector<uint16_t>> results(THREADS);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&allocator, &results, t]() {
+            for (int i = 0; i < PER_THREAD; ++i) {
+                results[t].push_back(allocator.next());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::set<uint16_t> ids;
+    for (const auto& ids_of_thread : results) {
+        ids.insert(ids_of_thread.begin(), ids_of_thread.end());
+    }
+    EXPECT_EQ(ids.size(), static_cast<size_t>(THREADS * PER_THREAD));
+    EXPECT_EQ(ids.count(0), 0u);
+}
+
+TEST_F(SessionManagerTest, InFlightSessionsAreNotReused) {
+    // Occupy every session ID
+    for (size_t i = 1; i < SessionManager::SESSION_SLOTS; ++i) {
+        ASSERT_NE(session_mgr_->create_session(0x1001), 0);
+    }
+    EXPECT_EQ(session_mgr_->get_active_session_count(), SessionManager::SESSION_SLOTS - 1);
+
+    // Exhaustion is reported instead of spinning forever
+    EXPECT_EQ(session_mgr_->create_session(0x1001), 0);
+
+    // A released ID is the only one that can be handed out again
+    session_mgr_->remove_session(0x1234);
+    EXPECT_FALSE(session_mgr_->validate_session(0x1234));
+    EXPECT_EQ(session_mgr_->create_session(0x1002), 0x1234);
+    EXPECT_EQ(session_mgr_->get_session(0x1234)->client_id, 0x1002);
+}
+
+TEST_F(SessionManagerTest, CleanupSparesSessionsBeingCreated) {
+    // Fresh slots have no activity yet, so a cleanup racing the claim would
+    // see them as long expired if the timestamp came after the claim
+    std::atomic<bool> creating{true};
+    std::atomic<size_t> cleaned{0};
+    std::thread cleaner([&]() {
+        while (creating) {
+            cleaned += session_mgr_->cleanup_expired_sessions(std::chrono::seconds(1));
+        }
+    });
+
+    std::vector<uint16_t> sessions;
+    for (size_t i = 1; i < SessionManager::SESSION_SLOTS; ++i) {
+        sessions.push_back(session_mgr_->create_session(0x1001));
+    }
+    creating = false;
+    cleaner.join();
+
+    EXPECT_EQ(cleaned.load(), 0u);
+    for (uint16_t session_id : sessions) {
+        ASSERT_TRUE(session_mgr_->validate_session(session_id)) << session_id;
+    }
+    EXPECT_EQ(session_mgr_->get_active_session_count(), SessionManager::SESSION_SLOTS - 1);
+}
+
+TEST_F(SessionManagerTest, UntrackedSessions) {
+    SessionManager counter_only(false);
+    EXPECT_FALSE(counter_only.is_tracking());
+
+    uint16_t first = counter_only.create_session(0x1001);
+    uint16_t second = counter_only.create_session(0x1001);
+    EXPECT_NE(first, 0);
+    EXPECT_EQ(second, SessionIdAllocator::successor(first));
+    EXPECT_FALSE(counter_only.validate_session(first));
+    EXPECT_EQ(counter_only.get_session(first), nullptr);
+    EXPECT_EQ(counter_only.get_active_session_count(), 0u);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
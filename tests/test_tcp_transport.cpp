@@ -422,3 +422,16 @@ TEST_F(TcpTransportTest, ConfigurationBoundaryValues) {
     // Should handle large values
     ASSERT_TRUE(true);
 }
+
+// stop() wakes the monitor and a blocked accept() instead of waiting them out
+TEST_F(TcpTransportTest, StopIsPrompt) {
+    TcpTransport transport(config);
+    ASSERT_EQ(transport.initialize(Endpoint("127.0.0.1", 0)), Result::SUCCESS);
+    ASSERT_EQ(transport.enable_server_mode(), Result::SUCCESS);
+    ASSERT_EQ(transport.start(), Result::SUCCESS);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    auto started = std::chrono::steady_clock::now();
+    ASSERT_EQ(transport.stop(), Result::SUCCESS);
+    EXPECT_LT(std::chrono::steady_clock::now() - started, std::chrono::milliseconds(500));
+}
@@ -16,6 +16,10 @@
 #include <tp/tp_segmenter.h>
 #include <tp/tp_reassembler.h>
 #include <someip/message.h>
+#include <serialization/serializer.h>
+#include <serialization/stream_deserializer.h>
+#include <algorithm>
+#include <optional>
 #include <thread>
 
 using namespace someip;
@@ -228,6 +232,151 @@ TEST_F(TpTest, TimeoutHandling) {
     ASSERT_FALSE(reassembler.is_reassembling(1));
 }
 
+TEST_F(TpTest, StreamingDeliversSegmentsInOrder) {
+    TpSegmenter segmenter(config);
+    TpReassembler reassembler(config);
+
+    // 2000 big-endian uint32 counters behind a byte-length field
+    serialization::Serializer serializer;
+    serializer.serialize_uint32(2000 * 4);
+    for (uint32_t i = 0; i < 2000; ++i) {
+        serializer.serialize_uint32(i * 3);
+    }
+    Message message(MessageId(0x1234, 0x5678), RequestId(0xABCD, 0x0001),
+                    MessageType::NOTIFICATION, ReturnCode::E_OK);
+    message.set_payload(serializer.get_buffer());
+
+    std::vector<TpSegment> segments;
+    ASSERT_EQ(segmenter.segment_message(message, segments), TpResult::SUCCESS);
+    ASSERT_GT(segments.size(), 4u);
+    std::swap(segments[2], segments[3]);         // Reordered
+    segments.insert(segments.begin() + 2, segments[1]);  // Duplicated
+
+    serialization::StreamDeserializer stream;
+    std::vector<uint32_t> values;
+    std::optional<uint32_t> remaining;
+    size_t chunks_delivered = 0;
+    size_t max_buffered_chunks = 0;
+    size_t segments_before_first_value = 0;
+    reassembler.set_stream_callback([&](uint32_t, TpResult result, std::vector<uint8_t>&& data, bool last) {
+        ASSERT_EQ(result, TpResult::SUCCESS);
+        ++chunks_delivered;
+        stream.append(std::move(data));
+        if (last) {
+            stream.finish();
+        }
+        max_buffered_chunks = std::max(max_buffered_chunks, stream.get_buffered_chunks());
+
+        // Decode the elements that have arrived
+        if (!remaining) {
+            auto length = stream.deserialize_uint32();
+            if (length.is_error()) {
+                EXPECT_EQ(length.get_error(), Result::WOULD_BLOCK);
+                return;
+            }
+            remaining = length.get_value();
+        }
+        while (*remaining > 0) {
+            auto value = stream.deserialize_uint32();
+            if (value.is_error()) {
+                EXPECT_EQ(value.get_error(), Result::WOULD_BLOCK);
+                return;
+            }
+            if (values.empty()) {
+                segments_before_first_value = chunks_delivered;
+            }
+            values.push_back(value.get_value());
+            *remaining -= 4;
+        }
+    });
+
+    for (const auto& segment : segments) {
+        std::vector<uint8_t> complete_message;
+        ASSERT_TRUE(reassembler.process_segment(segment, complete_message));
+        EXPECT_TRUE(complete_message.empty());
+    }
+
+    ASSERT_EQ(values.size(), 2000u);
+    for (uint32_t i = 0; i < 2000; ++i) {
+        ASSERT_EQ(values[i], i * 3);
+    }
+    EXPECT_TRUE(stream.at_end());
+    EXPECT_EQ(chunks_delivered, segments.size() - 1);
+    EXPECT_EQ(segments_before_first_value, 1u);
+    EXPECT_LE(max_buffered_chunks, 2u);
+    EXPECT_EQ(reassembler.get_active_reassemblies(), 0u);
+}
+
+TEST_F(TpTest, StreamingReportsTimeout) {
+    TpConfig short_timeout_config = config;
+    short_timeout_config.reassembly_timeout = std::chrono::milliseconds(50);
+    TpReassembler reassembler(short_timeout_config);
+
+    std::vector<TpResult> results;
+    reassembler.set_stream_callback([&](uint32_t message_id, TpResult result, std::vector<uint8_t>&& data, bool last) {
+        EXPECT_EQ(message_id, 7u);
+        results.push_back(result);
+        EXPECT_EQ(data.empty(), result != TpResult::SUCCESS);
+        EXPECT_EQ(last, result != TpResult::SUCCESS);
+    });
+
+    TpSegment seg;
+    seg.header.message_length = 1000;
+    seg.header.segment_length = 500;
+    seg.header.sequence_number = 7;
+    seg.header.message_type = TpMessageType::FIRST_SEGMENT;
+    seg.payload.assign(500, 0x11);
+    std::vector<uint8_t> complete_message;
+    ASSERT_TRUE(reassembler.process_segment(seg, complete_message));
+    ASSERT_TRUE(reassembler.is_reassembling(7));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(80));
+    reassembler.process_timeouts();
+    EXPECT_FALSE(reassembler.is_reassembling(7));
+    EXPECT_EQ(results, (std::vector<TpResult>{TpResult::SUCCESS, TpResult::REASSEMBLY_TIMEOUT}));
+}
+
+TEST_F(TpTest, StreamingAbandonsMisbehavingMessages) {
+    TpConfig small_pending_config = config;
+    small_pending_config.max_stream_pending = 600;
+    TpReassembler reassembler(small_pending_config);
+
+    std::vector<TpResult> results;
+    reassembler.set_stream_callback([&](uint32_t, TpResult result, std::vector<uint8_t>&& data, bool last) {
+        results.push_back(result);
+        EXPECT_EQ(data.empty(), result != TpResult::SUCCESS);
+        EXPECT_EQ(last, result != TpResult::SUCCESS);
+    });
+
+    auto make_segment = [](uint32_t message_length, uint16_t offset, size_t data_size) {
+        TpSegment seg;
+        seg.header.message_length = message_length;
+        seg.header.segment_offset = offset;
+        seg.header.sequence_number = 7;
+        seg.header.message_type = offset == 0 ? TpMessageType::FIRST_SEGMENT
+                                              : TpMessageType::CONSECUTIVE_SEGMENT;
+        seg.payload.assign(data_size + (offset == 0 ? 20 : 4), 0x11);
+        seg.header.segment_length = static_cast<uint16_t>(seg.payload.size());
+        return seg;
+    };
+    std::vector<uint8_t> complete_message;
+
+    // An early segment that claims a longer message than its first segment
+    ASSERT_TRUE(reassembler.process_segment(make_segment(1000, 0, 480), complete_message));
+    EXPECT_FALSE(reassembler.process_segment(make_segment(5000, 900, 300), complete_message));
+    EXPECT_FALSE(reassembler.is_reassembling(7));
+    EXPECT_EQ(results, (std::vector<TpResult>{TpResult::SUCCESS, TpResult::INVALID_SEGMENT}));
+
+    // Early segments beyond max_stream_pending; duplicates are not counted
+    results.clear();
+    ASSERT_TRUE(reassembler.process_segment(make_segment(5000, 0, 480), complete_message));
+    ASSERT_TRUE(reassembler.process_segment(make_segment(5000, 1000, 400), complete_message));
+    ASSERT_TRUE(reassembler.process_segment(make_segment(5000, 1000, 400), complete_message));
+    EXPECT_FALSE(reassembler.process_segment(make_segment(5000, 1500, 400), complete_message));
+    EXPECT_FALSE(reassembler.is_reassembling(7));
+    EXPECT_EQ(results, (std::vector<TpResult>{TpResult::SUCCESS, TpResult::RESOURCE_EXHAUSTED}));
+}
+
 TEST_F(TpTest, InvalidSegmentHandling) {
     TpReassembler reassembler(config);
 
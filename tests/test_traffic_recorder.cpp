@@ -0,0 +1,302 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+#include <someip/message.h>
+#include <transport/inprocess_transport.h>
+#include <transport/recording_transport.h>
+#include <transport/traffic_recorder.h>
+#include <unistd.h>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+using namespace someip;
+using namespace someip::transport;
+using namespace std::chrono_literals;
+
+namespace {
+
+Message make_message(uint16_t service_id, uint16_t session_id, size_t payload_size = 16) {
+    Message message(MessageId(service_id, 0x8001), RequestId(0x0001, session_id), MessageType::NOTIFICATION);
+    std::vector<uint8_t> payload(payload_size);
+    for (size_t i = 0; i < payload_size; ++i) {
+        payload[i] = static_cast<uint8_t>(session_id + i);
+    }
+    message.set_payload(payload);
+    return message;
+}
+
+class NullListener : public ITransportListener {
+public:
+    void on_message_received(MessagePtr, const Endpoint&) override { received++; }
+    void on_connection_lost(const Endpoint&) override {}
+    void on_connection_established(const Endpoint&) override {}
+    void on_error(Result) override {}
+
+    std::atomic<size_t> received{0};
+};
+
+class TrafficRecorderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        path_ = "/tmp/someip_traffic_test_" + std::to_string(getpid());
+        remove_segments();
+    }
+
+    void TearDown() override {
+        remove_segments();
+    }
+
+    void remove_segments() {
+        for (const auto& segment : TrafficLogReader::list_segments(path_)) {
+            std::remove(segment.c_str());
+        }
+    }
+
+    TrafficRecorderConfig config(size_t segment_size = 1024 * 1024) {
+        TrafficRecorderConfig config;
+        config.path = path_;
+        config.segment_size = segment_size;
+        return config;
+    }
+
+    std::string path_;
+};
+
+} // namespace
+
+TEST_F(TrafficRecorderTest, RecordsAndReadsBack) {
+    TrafficRecorder recorder;
+    ASSERT_TRUE(recorder.open(config()));
+    Endpoint peer("192.168.1.20", 30509, TransportProtocol::UDP);
+    Endpoint peer6("fd00::1", 30510, TransportProtocol::TCP);
+
+    Message message = make_message(0x1234, 7, 40);
+    ASSERT_TRUE(recorder.record(TrafficDirection::SENT, message, peer));
+    auto frame = make_message(0x5678, 8).serialize();
+    ASSERT_TRUE(recorder.record(TrafficDirection::RECEIVED, frame.data(), frame.size(), peer6));
+    EXPECT_EQ(recorder.get_recorded(), 2u);
+
+    // Readable while the recorder still has the segment open
+    TrafficLogReader reader;
+    ASSERT_TRUE(reader.open(recorder.get_segment_path()));
+    ASSERT_EQ(reader.size(), 2u);
+
+    TrafficRecord record;
+    ASSERT_TRUE(reader.read(0, record));
+    EXPECT_EQ(record.direction, TrafficDirection::SENT);
+    EXPECT_EQ(record.message_id, 0x12348001u);
+    EXPECT_EQ(record.peer, peer);
+    EXPECT_EQ(std::vector<uint8_t>(record.frame, record.frame + record.size), message.serialize());
+    Message parsed;
+    ASSERT_TRUE(record.to_message(parsed));
+    EXPECT_EQ(parsed.get_session_id(), 7);
+
+    ASSERT_TRUE(reader.read(1, record));
+    EXPECT_EQ(record.direction, TrafficDirection::RECEIVED);
+    EXPECT_EQ(record.message_id, 0x56788001u);
+    EXPECT_EQ(record.peer, peer6);
+    EXPECT_EQ(std::vector<uint8_t>(record.frame, record.frame + record.size), frame);
+    EXPECT_FALSE(reader.read(2, record));
+
+    ASSERT_TRUE(recorder.record(TrafficDirection::SENT, message, peer));
+    EXPECT_EQ(reader.size(), 3u);
+}
+
+TEST_F(TrafficRecorderTest, SeeksByTimeAndFindsByService) {
+    TrafficRecorder recorder;
+    ASSERT_TRUE(recorder.open(config()));
+    Endpoint peer("127.0.0.1", 30509);
+
+    for (uint16_t session = 1; session <= 100; ++session) {
+        ASSERT_TRUE(recorder.record(TrafficDirection::SENT, make_message(session % 3 == 0 ? 0x2000 : 0x1000, session),
+                                    peer));
+    }
+
+    TrafficLogReader reader;
+    ASSERT_TRUE(reader.open(recorder.get_segment_path()));
+    ASSERT_EQ(reader.size(), 100u);
+
+    TrafficRecord record;
+    uint64_t previous = 0;
+    for (size_t i = 0; i < reader.size(); ++i) {
+        ASSERT_TRUE(reader.read(i, record));
+        EXPECT_GE(record.timestamp_ns, previous);
+        previous = record.timestamp_ns;
+    }
+
+    ASSERT_TRUE(reader.read(40, record));
+    size_t found = reader.seek(record.timestamp_ns);
+    EXPECT_LE(found, 40u);
+    TrafficRecord at;
+    ASSERT_TRUE(reader.read(found, at));
+    EXPECT_EQ(at.timestamp_ns, record.timestamp_ns);
+    EXPECT_EQ(reader.seek(0), 0u);
+    EXPECT_EQ(reader.seek(previous + 1), reader.size());
+
+    size_t matches = 0;
+    for (size_t i = reader.find_next(0, 0x2000); i < reader.size(); i = reader.find_next(i + 1, 0x2000)) {
+        ASSERT_TRUE(reader.read(i, record));
+        Message message;
+        ASSERT_TRUE(record.to_message(message));
+        EXPECT_EQ(message.get_service_id(), 0x2000);
+        EXPECT_EQ(message.get_session_id() % 3, 0);
+        matches++;
+    }
+    EXPECT_EQ(matches, 33u);
+    EXPECT_EQ(reader.find_next(0, 0x3000), reader.size());
+}
+
+TEST_F(TrafficRecorderTest, RotatesAndPrunesSegments) {
+    TrafficRecorderConfig small = config(4096);
+    small.max_segments = 3;
+    TrafficRecorder recorder;
+    ASSERT_TRUE(recorder.open(small));
+    Endpoint peer("127.0.0.1", 30509);
+
+    for (uint16_t session = 1; session <= 500; ++session) {
+        ASSERT_TRUE(recorder.record(TrafficDirection::SENT, make_message(0x1000, session, 64), peer));
+    }
+    EXPECT_EQ(recorder.get_recorded(), 500u);
+    EXPECT_FALSE(recorder.record(TrafficDirection::SENT, make_message(0x1000, 1, 8192), peer));
+    EXPECT_EQ(recorder.get_dropped(), 1u);
+    recorder.close();
+
+    auto segments = TrafficLogReader::list_segments(path_);
+    ASSERT_EQ(segments.size(), 3u);
+    EXPECT_NE(segments.front(), path_ + ".000000");
+
+    // The newest records survive, in order, across segments
+    uint16_t expected = 0;
+    for (const auto& segment : segments) {
+        TrafficLogReader reader;
+        ASSERT_TRUE(reader.open(segment));
+        for (size_t i = 0; i < reader.size(); ++i) {
+            TrafficRecord record;
+            Message message;
+            ASSERT_TRUE(reader.read(i, record));
+            ASSERT_TRUE(record.to_message(message));
+            if (expected != 0) {
+                EXPECT_EQ(message.get_session_id(), expected + 1);
+            }
+            expected = message.get_session_id();
+        }
+    }
+    EXPECT_EQ(expected, 500);
+
+    // A new recording continues after the existing segments
+    ASSERT_TRUE(recorder.open(small));
+    EXPECT_GT(recorder.get_segment_path(), segments.back());
+}
+
+TEST_F(TrafficRecorderTest, RejectsNonRecordings) {
+    TrafficLogReader reader;
+    EXPECT_FALSE(reader.open(path_ + ".missing"));
+
+    std::string bogus = path_ + ".000000";
+    FILE* file = std::fopen(bogus.c_str(), "wb");
+    ASSERT_NE(file, nullptr);
+    std::vector<uint8_t> zeros(8192, 0);
+    std::fwrite(zeros.data(), 1, zeros.size(), file);
+    std::fclose(file);
+    EXPECT_FALSE(reader.open(bogus));
+    EXPECT_EQ(reader.size(), 0u);
+
+    TrafficRecorder recorder;
+    TrafficRecorderConfig unnamed;
+    EXPECT_FALSE(recorder.open(unnamed));
+    EXPECT_FALSE(recorder.record(TrafficDirection::SENT, make_message(0x1000, 1), Endpoint("127.0.0.1", 1)));
+}
+
+TEST_F(TrafficRecorderTest, ClampsCorruptRecordCount) {
+    std::string segment;
+    {
+        TrafficRecorder recorder;
+        ASSERT_TRUE(recorder.open(config(64 * 1024)));
+        ASSERT_TRUE(recorder.record(TrafficDirection::SENT, make_message(0x1234, 1), Endpoint("127.0.0.1", 1)));
+        segment = recorder.get_segment_path();
+    }
+
+    // Header layout: 16 bytes of magic, version and sizes, four u64 fields, then record_count
+    constexpr long INDEX_CAPACITY_OFFSET = 16;
+    constexpr long RECORD_COUNT_OFFSET = 48;
+    FILE* file = std::fopen(segment.c_str(), "r+b");
+    ASSERT_NE(file, nullptr);
+    uint64_t index_capacity = 0;
+    ASSERT_EQ(std::fseek(file, INDEX_CAPACITY_OFFSET, SEEK_SET), 0);
+    ASSERT_EQ(std::fread(&index_capacity, sizeof(index_capacity), 1, file), 1u);
+    uint64_t corrupt = ~uint64_t{0};
+    ASSERT_EQ(std::fseek(file, RECORD_COUNT_OFFSET, SEEK_SET), 0);
+    ASSERT_EQ(std::fwrite(&corrupt, sizeof(corrupt), 1, file), 1u);
+    std::fclose(file);
+
+    TrafficLogReader reader;
+    ASSERT_TRUE(reader.open(segment));
+    EXPECT_EQ(reader.size(), index_capacity);
+    EXPECT_EQ(reader.find_next(0, 0x9999), index_capacity);
+    EXPECT_LE(reader.seek(~uint64_t{0}), index_capacity);
+    TrafficRecord record;
+    EXPECT_FALSE(reader.read(index_capacity, record));
+}
+
+TEST_F(TrafficRecorderTest, RecordingTransportTapsBothDirections) {
+    auto recorder = std::make_shared<TrafficRecorder>();
+    ASSERT_TRUE(recorder->open(config()));
+
+    auto peer = std::make_shared<InProcessTransport>();
+    NullListener peer_listener;
+    peer->set_listener(&peer_listener);
+    ASSERT_EQ(peer->start(), Result::SUCCESS);
+
+    RecordingTransport recording(std::make_shared<InProcessTransport>(), recorder);
+    NullListener listener;
+    recording.set_listener(&listener);
+    ASSERT_EQ(recording.start(), Result::SUCCESS);
+
+    ASSERT_EQ(recording.send_message(make_message(0x1000, 1), peer->get_local_endpoint()), Result::SUCCESS);
+    auto frame = make_message(0x1000, 2).serialize();
+    ASSERT_EQ(recording.send_serialized(frame.data(), frame.size(), peer->get_local_endpoint()), Result::SUCCESS);
+    ASSERT_EQ(peer->send_message(make_message(0x2000, 3), recording.get_local_endpoint()), Result::SUCCESS);
+
+    // Failed sends are not recorded
+    EXPECT_NE(recording.send_message(make_message(0x1000, 4), Endpoint("127.0.0.1", 1)), Result::SUCCESS);
+
+    for (int i = 0; i < 300 && (listener.received < 1 || peer_listener.received < 2); ++i) {
+        std::this_thread::sleep_for(10ms);
+    }
+    ASSERT_EQ(listener.received, 1u);
+    ASSERT_EQ(peer_listener.received, 2u);
+    ASSERT_EQ(recording.stop(), Result::SUCCESS);
+    ASSERT_EQ(peer->stop(), Result::SUCCESS);
+
+    TrafficLogReader reader;
+    ASSERT_TRUE(reader.open(recorder->get_segment_path()));
+    ASSERT_EQ(reader.size(), 3u);
+
+    size_t sent = 0;
+    TrafficRecord record;
+    for (size_t i = 0; i < reader.size(); ++i) {
+        ASSERT_TRUE(reader.read(i, record));
+        if (record.direction == TrafficDirection::SENT) {
+            sent++;
+            EXPECT_EQ(record.message_id >> 16, 0x1000u);
+            EXPECT_EQ(record.peer, peer->get_local_endpoint());
+        } else {
+            EXPECT_EQ(record.message_id >> 16, 0x2000u);
+            EXPECT_EQ(record.peer, peer->get_local_endpoint());
+        }
+    }
+    EXPECT_EQ(sent, 2u);
+}
@@ -13,8 +13,13 @@
 
 #include <gtest/gtest.h>
 #include <transport/udp_transport.h>
+#include <transport/priority_transport.h>
 #include <transport/transport.h>
 #include <someip/message.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
 #include <thread>
 #include <chrono>
 #include <atomic>
@@ -88,6 +93,11 @@ public:
         return cv_.wait_for(lock, timeout, [this]() { return !received_messages_.empty(); });
     }
 
+    bool wait_for_messages(size_t count, std::chrono::milliseconds timeout = std::chrono::milliseconds(2000)) {
+        std::unique_lock lock(mutex_);
+        return cv_.wait_for(lock, timeout, [this, count]() { return received_messages_.size() >= count; });
+    }
+
     bool wait_for_error(std::chrono::milliseconds timeout = std::chrono::milliseconds(1000)) {
         std::unique_lock lock(mutex_);
         return cv_.wait_for(lock, timeout, [this]() { return error_count_ > 0; });
@@ -645,3 +655,358 @@ TEST_F(UdpTransportTest, MultipleMessagesRapidFire) {
     sender.stop();
     receiver.stop();
 }
+
+// A short datagram does not truncate the longer ones received after it
+TEST_F(UdpTransportTest, LongerDatagramAfterShortOne) {
+    UdpTransport sender(local_endpoint, config);
+    UdpTransport receiver(local_endpoint, config);
+    TestUdpListener receiver_listener;
+    receiver.set_listener(&receiver_listener);
+    ASSERT_EQ(sender.start(), Result::SUCCESS);
+    ASSERT_EQ(receiver.start(), Result::SUCCESS);
+
+    // Each receive must use the full buffer, not the size of the last datagram
+    std::vector<Message> messages;
+    for (size_t payload_size : {4u, 64u, 1000u}) {
+        Message message(MessageId(0x1234, 0x0001), RequestId(0x0001, static_cast<uint16_t>(payload_size)),
+                        MessageType::REQUEST_NO_RETURN, ReturnCode::E_OK);
+        message.set_payload(std::vector<uint8_t>(payload_size, 0x5A));
+        messages.push_back(message);
+        ASSERT_EQ(sender.send_message(message, receiver.get_local_endpoint()), Result::SUCCESS);
+        ASSERT_TRUE(receiver_listener.wait_for_messages(messages.size()));
+    }
+
+    for (size_t i = 0; i < messages.size(); ++i) {
+        const auto& received = receiver_listener.received_messages_[i].first;
+        EXPECT_EQ(received->get_session_id(), messages[i].get_session_id());
+        EXPECT_EQ(received->get_payload(), messages[i].get_payload());
+    }
+
+    sender.stop();
+    receiver.stop();
+}
+
+// Test compilation of message ID sets into socket filter programs
+TEST_F(UdpTransportTest, MessageFilterCompilation) {
+    MessageFilter filter;
+    filter.add_service(0x1234);
+    filter.add_method(0xFFFF, 0x8100);
+
+    std::vector<BpfInstruction> program;
+    ASSERT_EQ(compile_message_filter(filter, program), Result::SUCCESS);
+
+    auto datagram = [](uint16_t service_id, uint16_t method_id) {
+        return std::vector<uint8_t>{static_cast<uint8_t>(service_id >> 8),
+                                    static_cast<uint8_t>(service_id),
+                                    static_cast<uint8_t>(method_id >> 8),
+                                    static_cast<uint8_t>(method_id), 0, 0, 0, 8};
+    };
+
+    EXPECT_TRUE(run_message_filter(program, datagram(0x1234, 0x0001)));
+    EXPECT_TRUE(run_message_filter(program, datagram(0x1234, 0x8005)));
+    EXPECT_TRUE(run_message_filter(program, datagram(0xFFFF, 0x8100)));
+    EXPECT_FALSE(run_message_filter(program, datagram(0xFFFF, 0x8101)));
+    EXPECT_FALSE(run_message_filter(program, datagram(0x4321, 0x0001)));
+    EXPECT_FALSE(run_message_filter(program, {0x12}));  // Too short
+
+    // Empty filter drops everything
+    ASSERT_EQ(compile_message_filter(MessageFilter(), program), Result::SUCCESS);
+    EXPECT_FALSE(run_message_filter(program, datagram(0x1234, 0x0001)));
+}
+
+// Test that large method sets stay within the 8-bit jump range
+TEST_F(UdpTransportTest, MessageFilterLargeMethodSet) {
+    MessageFilter filter;
+    for (uint16_t method_id = 0; method_id < 500; ++method_id) {
+        filter.add_method(0x1000, static_cast<uint16_t>(method_id * 3));
+    }
+    filter.add_method(0x2000, 0x0001);
+
+    std::vector<BpfInstruction> program;
+    ASSERT_EQ(compile_message_filter(filter, program), Result::SUCCESS);
+
+    for (uint16_t method_id = 0; method_id < 1500; ++method_id) {
+        std::vector<uint8_t> data = {0x10, 0x00, static_cast<uint8_t>(method_id >> 8),
+                                     static_cast<uint8_t>(method_id)};
+        EXPECT_EQ(run_message_filter(program, data), filter.matches(0x1000, method_id));
+    }
+    EXPECT_TRUE(run_message_filter(program, {0x20, 0x00, 0x00, 0x01}));
+    EXPECT_FALSE(run_message_filter(program, {0x20, 0x00, 0x00, 0x02}));
+
+    // Beyond the kernel instruction limit the filter is rejected
+    for (uint32_t service_id = 0; service_id < 3000; ++service_id) {
+        filter.add_service(static_cast<uint16_t>(service_id));
+    }
+    EXPECT_EQ(compile_message_filter(filter, program), Result::RESOURCE_EXHAUSTED);
+    EXPECT_TRUE(program.empty());
+}
+
+// Test that the kernel drops datagrams rejected by the message filter
+TEST_F(UdpTransportTest, KernelMessageFilter) {
+    UdpTransport sender(local_endpoint, config);
+    UdpTransport receiver(local_endpoint, config);
+    TestUdpListener receiver_listener;
+    receiver.set_listener(&receiver_listener);
+
+    // Filter set before start() is attached when the socket is created
+    MessageFilter filter;
+    filter.add_service(0x1234);
+    ASSERT_EQ(receiver.set_message_filter(filter), Result::SUCCESS);
+
+    ASSERT_EQ(sender.start(), Result::SUCCESS);
+    ASSERT_EQ(receiver.start(), Result::SUCCESS);
+    Endpoint receiver_endpoint = receiver.get_local_endpoint();
+
+    auto make_message = [](uint16_t service_id, uint16_t session_id) {
+        Message message(MessageId(service_id, 0x0001), RequestId(0x0001, session_id),
+                        MessageType::NOTIFICATION, ReturnCode::E_OK);
+        return message;
+    };
+
+    EXPECT_EQ(sender.send_message(make_message(0x4321, 1), receiver_endpoint), Result::SUCCESS);
+    EXPECT_EQ(sender.send_message(make_message(0x1234, 2), receiver_endpoint), Result::SUCCESS);
+    ASSERT_TRUE(receiver_listener.wait_for_message());
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_EQ(receiver_listener.received_messages_.size(), 1u);
+    EXPECT_EQ(receiver_listener.received_messages_[0].first->get_service_id(), 0x1234);
+
+    // Replacing the filter at runtime takes effect immediately
+    receiver_listener.reset();
+    filter = MessageFilter();
+    filter.add_service(0x4321);
+    ASSERT_EQ(receiver.set_message_filter(filter), Result::SUCCESS);
+    EXPECT_EQ(sender.send_message(make_message(0x1234, 3), receiver_endpoint), Result::SUCCESS);
+    EXPECT_EQ(sender.send_message(make_message(0x4321, 4), receiver_endpoint), Result::SUCCESS);
+    ASSERT_TRUE(receiver_listener.wait_for_message());
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_EQ(receiver_listener.received_messages_.size(), 1u);
+    EXPECT_EQ(receiver_listener.received_messages_[0].first->get_session_id(), 4);
+
+    // Clearing the filter accepts everything again
+    receiver_listener.reset();
+    ASSERT_EQ(receiver.clear_message_filter(), Result::SUCCESS);
+    EXPECT_EQ(sender.send_message(make_message(0x1234, 5), receiver_endpoint), Result::SUCCESS);
+    EXPECT_TRUE(receiver_listener.wait_for_message());
+
+    sender.stop();
+    receiver.stop();
+}
+
+// Batched messages share datagrams and arrive as separate messages
+TEST_F(UdpTransportTest, SendMessagesBatching) {
+    config.max_message_size = 100;
+    UdpTransport sender(local_endpoint, config);
+    UdpTransport receiver(local_endpoint, config);
+    TestUdpListener receiver_listener;
+    receiver.set_listener(&receiver_listener);
+    ASSERT_EQ(sender.start(), Result::SUCCESS);
+    ASSERT_EQ(receiver.start(), Result::SUCCESS);
+
+    // 16-byte header + 24-byte payload: two messages per 100-byte datagram
+    std::vector<Message> messages;
+    for (uint16_t session_id = 1; session_id <= 5; ++session_id) {
+        Message message(MessageId(0x1234, 0x0001), RequestId(0x0001, session_id),
+                        MessageType::REQUEST_NO_RETURN, ReturnCode::E_OK);
+        message.set_payload(std::vector<uint8_t>(24, static_cast<uint8_t>(session_id)));
+        messages.push_back(message);
+    }
+    // One oversized message is sent on its own
+    Message large(MessageId(0x1234, 0x0002), RequestId(0x0001, 6),
+                  MessageType::REQUEST_NO_RETURN, ReturnCode::E_OK);
+    large.set_payload(std::vector<uint8_t>(200, 0xAB));
+    messages.push_back(large);
+
+    ASSERT_EQ(sender.send_messages(messages, receiver.get_local_endpoint()), Result::SUCCESS);
+
+    ASSERT_TRUE(receiver_listener.wait_for_messages(messages.size()));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_EQ(receiver_listener.received_messages_.size(), messages.size());
+    for (size_t i = 0; i < messages.size(); ++i) {
+        const auto& received = receiver_listener.received_messages_[i].first;
+        EXPECT_EQ(received->get_session_id(), messages[i].get_session_id());
+        EXPECT_EQ(received->get_payload(), messages[i].get_payload());
+    }
+
+    EXPECT_EQ(sender.send_messages({}, receiver.get_local_endpoint()), Result::SUCCESS);
+
+    // A message too large for UDP fails the batch before anything is sent
+    Message too_large(MessageId(0x1234, 0x0003), RequestId(0x0001, 7),
+                      MessageType::REQUEST_NO_RETURN, ReturnCode::E_OK);
+    too_large.set_payload(std::vector<uint8_t>(70000, 0xCD));
+    EXPECT_EQ(sender.send_message(too_large, receiver.get_local_endpoint()), Result::BUFFER_OVERFLOW);
+    EXPECT_EQ(sender.send_messages({messages[0], too_large}, receiver.get_local_endpoint()),
+              Result::BUFFER_OVERFLOW);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(receiver_listener.received_messages_.size(), messages.size());
+
+    sender.stop();
+    receiver.stop();
+}
+
+namespace {
+
+// Records sent messages; the first send blocks until released
+class GatedTransport : public ITransport {
+public:
+    Result send_message(const Message& message, const Endpoint&) override {
+        std::unique_lock lock(mutex_);
+        sent_.push_back(message.get_method_id());
+        cv_.notify_all();
+        cv_.wait(lock, [this] { return open_; });
+        return Result::SUCCESS;
+    }
+    MessagePtr receive_message() override { return nullptr; }
+    Result connect(const Endpoint&) override { return Result::SUCCESS; }
+    Result disconnect() override { return Result::SUCCESS; }
+    bool is_connected() const override { return true; }
+    Endpoint get_local_endpoint() const override { return Endpoint("127.0.0.1", 0); }
+    void set_listener(ITransportListener*) override {}
+    Result start() override { running_ = true; return Result::SUCCESS; }
+    Result stop() override { running_ = false; return Result::SUCCESS; }
+    bool is_running() const override { return running_; }
+
+    bool wait_for_first_send() {
+        std::unique_lock lock(mutex_);
+        return cv_.wait_for(lock, std::chrono::seconds(1), [this] { return !sent_.empty(); });
+    }
+    void open() {
+        std::scoped_lock lock(mutex_);
+        open_ = true;
+        cv_.notify_all();
+    }
+    std::vector<uint16_t> sent() {
+        std::scoped_lock lock(mutex_);
+        return sent_;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<uint16_t> sent_;
+    bool open_{false};
+    std::atomic<bool> running_{false};
+};
+
+Message make_method_message(uint16_t service_id, uint16_t method_id) {
+    return Message(MessageId(service_id, method_id), RequestId(0x0001, 0x0001),
+                   MessageType::NOTIFICATION, ReturnCode::E_OK);
+}
+
+} // namespace
+
+// A critical message overtakes a queued bulk segment train
+TEST_F(UdpTransportTest, PriorityTransportStrictPriority) {
+    auto gate = std::make_shared<GatedTransport>();
+    PriorityTransport transport(gate);
+    ASSERT_EQ(transport.set_traffic_class(0x2000, 2), Result::SUCCESS);             // Bulk service
+    ASSERT_EQ(transport.set_traffic_class(0x1000, 0x8001, 0), Result::SUCCESS);     // Critical event
+    EXPECT_EQ(transport.set_traffic_class(0x3000, 3), Result::INVALID_ARGUMENT);
+    EXPECT_EQ(transport.set_traffic_class(0x3000, 0x0001, 3), Result::INVALID_ARGUMENT);
+    EXPECT_EQ(transport.classify(make_method_message(0x2000, 0x0001)), 2);
+    EXPECT_EQ(transport.classify(make_method_message(0x1000, 0x8001)), 0);
+    EXPECT_EQ(transport.classify(make_method_message(0x1000, 0x8002)), 1);
+    ASSERT_EQ(transport.start(), Result::SUCCESS);
+
+    Endpoint destination("127.0.0.1", 30509);
+    for (uint16_t segment = 1; segment <= 10; ++segment) {
+        ASSERT_EQ(transport.send_message(make_method_message(0x2000, segment), destination), Result::SUCCESS);
+    }
+    ASSERT_TRUE(gate->wait_for_first_send());
+    ASSERT_EQ(transport.send_message(make_method_message(0x1000, 0x8002), destination), Result::SUCCESS);
+    ASSERT_EQ(transport.send_message(make_method_message(0x1000, 0x8001), destination), Result::SUCCESS);
+    EXPECT_EQ(transport.get_queued(2), 9u);
+    EXPECT_EQ(transport.send_message(make_method_message(0x1000, 0x0001), destination, 7),
+              Result::INVALID_ARGUMENT);
+
+    gate->open();
+    ASSERT_EQ(transport.stop(), Result::SUCCESS);   // Drains the queues
+
+    std::vector<uint16_t> expected{1, 0x8001, 0x8002};
+    for (uint16_t segment = 2; segment <= 10; ++segment) {
+        expected.push_back(segment);
+    }
+    EXPECT_EQ(gate->sent(), expected);
+}
+
+// Weighted round robin shares the link by class weight
+TEST_F(UdpTransportTest, PriorityTransportWeighted) {
+    PriorityTransportConfig config;
+    config.policy = SchedulingPolicy::WEIGHTED;
+    config.classes = {TrafficClassConfig{2}, TrafficClassConfig{1}};
+    auto gate = std::make_shared<GatedTransport>();
+    PriorityTransport transport(gate, config);
+    ASSERT_EQ(transport.start(), Result::SUCCESS);
+
+    Endpoint destination("127.0.0.1", 30509);
+    ASSERT_EQ(transport.send_message(make_method_message(0x1000, 0x00FF), destination, 1), Result::SUCCESS);
+    ASSERT_TRUE(gate->wait_for_first_send());
+    for (int i = 0; i < 6; ++i) {
+        ASSERT_EQ(transport.send_message(make_method_message(0x1000, 0x000A), destination, 0), Result::SUCCESS);
+    }
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_EQ(transport.send_message(make_method_message(0x1000, 0x000B), destination, 1), Result::SUCCESS);
+    }
+
+    gate->open();
+    ASSERT_EQ(transport.stop(), Result::SUCCESS);
+    EXPECT_EQ(gate->sent(), (std::vector<uint16_t>{0x00FF, 0x0A, 0x0A, 0x0B, 0x0A, 0x0A, 0x0B, 0x0A, 0x0A, 0x0B}));
+}
+
+// Each datagram carries the marking of its class
+TEST_F(UdpTransportTest, PriorityTransportOverUdp) {
+    // Plain socket that reports the TOS byte of each datagram
+    int receiver = socket(AF_INET, SOCK_DGRAM, 0);
+    ASSERT_GE(receiver, 0);
+    int on = 1;
+    ASSERT_EQ(setsockopt(receiver, IPPROTO_IP, IP_RECVTOS, &on, sizeof(on)), 0);
+    timeval timeout{2, 0};
+    ASSERT_EQ(setsockopt(receiver, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)), 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t addr_len = sizeof(addr);
+    ASSERT_EQ(bind(receiver, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+    ASSERT_EQ(getsockname(receiver, reinterpret_cast<sockaddr*>(&addr), &addr_len), 0);
+    Endpoint destination("127.0.0.1", ntohs(addr.sin_port));
+
+    auto receive_tos = [receiver]() {
+        uint8_t data[2048];
+        iovec iov{data, sizeof(data)};
+        alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))];
+        msghdr msg{};
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+        if (recvmsg(receiver, &msg, 0) < 0) {
+            return -1;
+        }
+        for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+            if (cmsg->cmsg_level == IPPROTO_IP && cmsg->cmsg_type == IP_TOS) {
+                return static_cast<int>(*CMSG_DATA(cmsg));
+            }
+        }
+        return -1;
+    };
+
+    auto udp = std::make_shared<UdpTransport>(local_endpoint, config);
+    EXPECT_EQ(udp->set_traffic_marking(0, 64), Result::INVALID_ARGUMENT);
+    PriorityTransport transport(udp);
+    ASSERT_EQ(transport.set_traffic_class(0x1234, 0), Result::SUCCESS);
+    ASSERT_EQ(transport.start(), Result::SUCCESS);
+    ASSERT_EQ(udp->set_traffic_marking(0, 10), Result::SUCCESS);   // Socket default: AF11
+
+    ASSERT_EQ(transport.send_message(make_method_message(0x1234, 0x0001), destination), Result::SUCCESS);
+    EXPECT_EQ(receive_tos(), 46 << 2);
+    ASSERT_EQ(transport.send_message(make_method_message(0x4321, 0x0001), destination), Result::SUCCESS);
+    EXPECT_EQ(receive_tos(), 0);
+
+    // Direct sends keep the socket marking
+    ASSERT_EQ(udp->send_message(make_method_message(0x4321, 0x0002), destination), Result::SUCCESS);
+    EXPECT_EQ(receive_tos(), 10 << 2);
+    EXPECT_EQ(udp->send_message(make_method_message(0x4321, 0x0003), destination, 0, 64),
+              Result::INVALID_ARGUMENT);
+
+    (void)transport.stop();
+    close(receiver);
+}
@@ -0,0 +1,345 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+#include <transport/xdp_udp_transport.h>
+#include <transport/udp_transport.h>
+#include <someip/message.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace someip;
+using namespace someip::transport;
+
+namespace {
+
+class TestXdpListener : public ITransportListener {
+public:
+    void on_message_received(MessagePtr message, const Endpoint& sender) override {
+        std::scoped_lock lock(mutex_);
+        received_messages_.push_back({message, sender});
+        cv_.notify_one();
+    }
+
+    void on_connection_lost(const Endpoint& /*endpoint*/) override {}
+    void on_connection_established(const Endpoint& /*endpoint*/) override {}
+    void on_error(Result /*error*/) override {}
+
+    bool wait_for_message(std::chrono::milliseconds timeout = std::chrono::milliseconds(2000)) {
+        std::unique_lock lock(mutex_);
+        return cv_.wait_for(lock, timeout, [this]() { return !received_messages_.empty(); });
+    }
+
+    std::vector<std::pair<MessagePtr, Endpoint>> received_messages_;
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+};
+
+XdpFrameAddress make_address() {
+    XdpFrameAddress address;
+    address.src_mac = {0x02, 0x00, 0x00, 0x00, 0x00, 0x01};
+    address.dst_mac = {0x02, 0x00, 0x00, 0x00, 0x00, 0x02};
+    address.src_ip = 0x0A4D0001;  // 10.77.0.1
+    address.dst_ip = 0x0A4D0002;  // 10.77.0.2
+    address.src_port = 30501;
+    address.dst_port = 30502;
+    return address;
+}
+
+Message make_request() {
+    Message message(MessageId(0x1234, 0x0001), RequestId(0x0001, 0x0001),
+                    MessageType::REQUEST, ReturnCode::E_OK);
+    message.set_payload({0xDE, 0xAD, 0xBE, 0xEF});
+    return message;
+}
+
+} // namespace
+
+/**
+ * @brief AF_XDP transport unit tests
+ * @tests REQ_TRANSPORT_001
+ * @tests REQ_TRANSPORT_004
+ * @tests REQ_TRANSPORT_005
+ * @tests feat_req_someip_800
+ */
+class XdpTransportTest : public ::testing::Test {
+protected:
+    Endpoint local_endpoint{"127.0.0.1", 0};  // Port 0 = auto-assign
+};
+
+TEST_F(XdpTransportTest, EncapsulationRoundTrip) {
+    XdpFrameAddress address = make_address();
+    std::vector<uint8_t> payload = make_request().serialize();
+    std::vector<uint8_t> frame(2048);
+
+    size_t length = XdpUdpTransport::encapsulate(address, payload.data(), payload.size(),
+                                                 frame.data(), frame.size());
+    ASSERT_EQ(length, XdpUdpTransport::FRAME_HEADER_SIZE + payload.size());
+
+    XdpFrameAddress decoded;
+    const uint8_t* decoded_payload = nullptr;
+    size_t decoded_size = 0;
+    ASSERT_TRUE(XdpUdpTransport::decapsulate(frame.data(), length, decoded,
+                                             decoded_payload, decoded_size));
+    EXPECT_EQ(decoded.src_mac, address.src_mac);
+    EXPECT_EQ(decoded.dst_mac, address.dst_mac);
+    EXPECT_EQ(decoded.src_ip, address.src_ip);
+    EXPECT_EQ(decoded.dst_ip, address.dst_ip);
+    EXPECT_EQ(decoded.src_port, address.src_port);
+    EXPECT_EQ(decoded.dst_port, address.dst_port);
+    ASSERT_EQ(decoded_size, payload.size());
+    EXPECT_EQ(std::vector<uint8_t>(decoded_payload, decoded_payload + decoded_size), payload);
+
+    Message message;
+    EXPECT_TRUE(message.deserialize(payload));
+    EXPECT_EQ(message.get_service_id(), 0x1234);
+}
+
+TEST_F(XdpTransportTest, EncapsulationRejectsTooSmallBuffer) {
+    XdpFrameAddress address = make_address();
+    std::vector<uint8_t> payload(100, 0x55);
+    std::vector<uint8_t> frame(XdpUdpTransport::FRAME_HEADER_SIZE + 99);
+
+    EXPECT_EQ(XdpUdpTransport::encapsulate(address, payload.data(), payload.size(),
+                                           frame.data(), frame.size()), 0u);
+}
+
+TEST_F(XdpTransportTest, DecapsulationRejectsInvalidFrames) {
+    XdpFrameAddress address = make_address();
+    std::vector<uint8_t> payload(32, 0xA5);
+    std::vector<uint8_t> frame(2048);
+    size_t length = XdpUdpTransport::encapsulate(address, payload.data(), payload.size(),
+                                                 frame.data(), frame.size());
+    ASSERT_GT(length, 0u);
+
+    XdpFrameAddress decoded;
+    const uint8_t* decoded_payload = nullptr;
+    size_t decoded_size = 0;
+
+    // Truncated frame
+    EXPECT_FALSE(XdpUdpTransport::decapsulate(frame.data(), length - 1, decoded,
+                                              decoded_payload, decoded_size));
+
+    // Not IPv4 (ARP EtherType)
+    std::vector<uint8_t> arp(frame.begin(), frame.begin() + length);
+    arp[12] = 0x08;
+    arp[13] = 0x06;
+    EXPECT_FALSE(XdpUdpTransport::decapsulate(arp.data(), arp.size(), decoded,
+                                              decoded_payload, decoded_size));
+
+    // Fragment (more fragments flag set)
+    std::vector<uint8_t> fragment(frame.begin(), frame.begin() + length);
+    fragment[14 + 6] |= 0x20;
+    EXPECT_FALSE(XdpUdpTransport::decapsulate(fragment.data(), fragment.size(), decoded,
+                                              decoded_payload, decoded_size));
+
+    // Corrupted IPv4 header fails the header checksum
+    std::vector<uint8_t> corrupted(frame.begin(), frame.begin() + length);
+    corrupted[14 + 8] ^= 0xFF;
+    EXPECT_FALSE(XdpUdpTransport::decapsulate(corrupted.data(), corrupted.size(), decoded,
+                                              decoded_payload, decoded_size));
+}
+
+TEST_F(XdpTransportTest, ParsesCompleteArpEntriesOfInterface) {
+    std::istringstream table(
+        "IP address       HW type     Flags       HW address            Mask     Device\n"
+        "10.77.0.2        0x1         0x2         02:00:00:00:00:02     *        xdp0\n"
+        "10.77.0.3        0x1         0x0         00:00:00:00:00:00     *        xdp0\n"
+        "10.77.0.4        0x1         0x2         02:00:00:00:00:04     *        eth0\n"
+        "garbage\n");
+
+    auto neighbors = XdpUdpTransport::parse_arp_table(table, "xdp0");
+    ASSERT_EQ(neighbors.size(), 1u);
+    auto it = neighbors.find(0x0A4D0002);
+    ASSERT_NE(it, neighbors.end());
+    EXPECT_EQ(it->second, (std::array<uint8_t, 6>{0x02, 0x00, 0x00, 0x00, 0x00, 0x02}));
+}
+
+TEST_F(XdpTransportTest, FallsBackToUdpWithoutInterface) {
+    XdpTransportConfig config;
+    config.interface_name = "someip-none0";
+    XdpUdpTransport transport(local_endpoint, config);
+    TestXdpListener listener;
+    transport.set_listener(&listener);
+
+    ASSERT_EQ(transport.start(), Result::SUCCESS);
+    EXPECT_TRUE(transport.is_running());
+    EXPECT_FALSE(transport.is_xdp_active());
+    EXPECT_NE(transport.get_local_endpoint().get_port(), 0);
+
+    UdpTransport peer(local_endpoint);
+    TestXdpListener peer_listener;
+    peer.set_listener(&peer_listener);
+    ASSERT_EQ(peer.start(), Result::SUCCESS);
+
+    ASSERT_EQ(transport.send_message(make_request(), peer.get_local_endpoint()), Result::SUCCESS);
+    ASSERT_TRUE(peer_listener.wait_for_message());
+    EXPECT_EQ(peer_listener.received_messages_[0].second.get_port(),
+              transport.get_local_endpoint().get_port());
+
+    ASSERT_EQ(peer.send_message(make_request(), transport.get_local_endpoint()), Result::SUCCESS);
+    ASSERT_TRUE(listener.wait_for_message());
+    EXPECT_EQ(listener.received_messages_[0].first->get_payload().size(), 4u);
+
+    EXPECT_EQ(transport.get_statistics().tx_kernel_path, 1u);
+    EXPECT_EQ(transport.get_statistics().tx_packets, 0u);
+
+    (void)peer.stop();
+    EXPECT_EQ(transport.stop(), Result::SUCCESS);
+    EXPECT_FALSE(transport.is_running());
+}
+
+// stop() may run while another thread is sending. Over XDP this races the
+// unmapping of the rings when SOMEIP_XDP_TEST_IFACE/_PEER_IP are set (see
+// VethExchangeInGenericMode), otherwise it covers the fallback path.
+TEST_F(XdpTransportTest, SendRacingStop) {
+    const char* iface = std::getenv("SOMEIP_XDP_TEST_IFACE");
+    const char* local_ip = std::getenv("SOMEIP_XDP_TEST_LOCAL_IP");
+    const char* peer_ip = std::getenv("SOMEIP_XDP_TEST_PEER_IP");
+    bool use_xdp = iface && local_ip && peer_ip;
+
+    UdpTransport peer(local_endpoint);
+    ASSERT_EQ(peer.start(), Result::SUCCESS);
+    Endpoint destination = use_xdp ? Endpoint(peer_ip, 30512) : peer.get_local_endpoint();
+
+    XdpTransportConfig config;
+    config.interface_name = use_xdp ? iface : "someip-none0";
+    for (int round = 0; round < 20; ++round) {
+        XdpUdpTransport transport(use_xdp ? Endpoint(local_ip, 30511) : local_endpoint, config);
+        ASSERT_EQ(transport.start(), Result::SUCCESS);
+
+        std::atomic<bool> sending{true};
+        std::atomic<int> unexpected{0};
+        std::thread sender([&]() {
+            while (sending) {
+                Result result = transport.send_message(make_request(), destination);
+                if (result != Result::SUCCESS && result != Result::NOT_CONNECTED &&
+                    result != Result::RESOURCE_EXHAUSTED) {
+                    unexpected++;
+                }
+            }
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        EXPECT_EQ(transport.stop(), Result::SUCCESS);
+        sending = false;
+        sender.join();
+
+        EXPECT_FALSE(transport.is_xdp_active());
+        EXPECT_EQ(unexpected.load(), 0);
+    }
+
+    (void)peer.stop();
+}
+
+TEST_F(XdpTransportTest, ReportsErrorWhenFallbackDisabled) {
+    XdpTransportConfig config;
+    config.interface_name = "someip-none0";
+    config.fallback_to_udp = false;
+    XdpUdpTransport transport(local_endpoint, config);
+
+    EXPECT_NE(transport.start(), Result::SUCCESS);
+    EXPECT_FALSE(transport.is_running());
+}
+
+TEST_F(XdpTransportTest, RejectsInvalidPoolGeometry) {
+    XdpTransportConfig config;
+    config.interface_name = "lo";
+    config.frame_size = 3000;
+    config.fallback_to_udp = false;
+    XdpUdpTransport transport(local_endpoint, config);
+
+    EXPECT_EQ(transport.start(), Result::INVALID_ARGUMENT);
+}
+
+/**
+ * End-to-end exchange over a veth pair in generic mode. Requires root and a
+ * prepared pair, e.g.:
+ *
+ *   ip netns add someip-peer
+ *   ip link add xdp0 type veth peer name xdp1 netns someip-peer
+ *   ip addr add 10.77.0.1/24 dev xdp0 && ip link set xdp0 up
+ *   ip -n someip-peer addr add 10.77.0.2/24 dev xdp1
+ *   ip -n someip-peer link set xdp1 up
+ *   SOMEIP_XDP_TEST_IFACE=xdp0 SOMEIP_XDP_TEST_NETNS=someip-peer \
+ *   SOMEIP_XDP_TEST_LOCAL_IP=10.77.0.1 SOMEIP_XDP_TEST_PEER_IP=10.77.0.2 ./test_xdp_transport
+ */
+TEST_F(XdpTransportTest, VethExchangeInGenericMode) {
+    const char* iface = std::getenv("SOMEIP_XDP_TEST_IFACE");
+    const char* netns = std::getenv("SOMEIP_XDP_TEST_NETNS");
+    const char* local_ip = std::getenv("SOMEIP_XDP_TEST_LOCAL_IP");
+    const char* peer_ip = std::getenv("SOMEIP_XDP_TEST_PEER_IP");
+    if (!iface || !netns || !local_ip || !peer_ip) {
+        GTEST_SKIP() << "SOMEIP_XDP_TEST_* environment not set";
+    }
+
+    XdpTransportConfig config;
+    config.interface_name = iface;
+    config.fallback_to_udp = false;
+    XdpUdpTransport transport(Endpoint(local_ip, 30511), config);
+    TestXdpListener listener;
+    transport.set_listener(&listener);
+    ASSERT_EQ(transport.start(), Result::SUCCESS);
+    ASSERT_TRUE(transport.is_xdp_active());
+
+    // The peer socket is created inside the peer namespace and keeps it
+    std::unique_ptr<UdpTransport> peer;
+    TestXdpListener peer_listener;
+    std::thread([&]() {
+        int ns_fd = open((std::string("/var/run/netns/") + netns).c_str(), O_RDONLY);
+        if (ns_fd >= 0 && setns(ns_fd, CLONE_NEWNET) == 0) {
+            peer = std::make_unique<UdpTransport>(Endpoint(peer_ip, 30512));
+            peer->set_listener(&peer_listener);
+            if (peer->start() != Result::SUCCESS) {
+                peer.reset();
+            }
+        }
+        if (ns_fd >= 0) {
+            close(ns_fd);
+        }
+    }).join();
+    ASSERT_NE(peer, nullptr);
+
+    // Peer -> XDP: redirected into the UMEM and decoded in user space
+    ASSERT_EQ(peer->send_message(make_request(), Endpoint(local_ip, 30511)), Result::SUCCESS);
+    ASSERT_TRUE(listener.wait_for_message());
+    EXPECT_EQ(listener.received_messages_[0].second.get_address(), peer_ip);
+    EXPECT_EQ(listener.received_messages_[0].second.get_port(), 30512);
+    EXPECT_EQ(transport.get_statistics().rx_packets, 1u);
+
+    // XDP -> peer: the neighbour is known from the received ARP exchange,
+    // otherwise the first send goes through the kernel path.
+    Endpoint peer_endpoint(peer_ip, 30512);
+    for (int i = 0; i < 2; ++i) {
+        ASSERT_EQ(transport.send_message(make_request(), peer_endpoint), Result::SUCCESS);
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    ASSERT_TRUE(peer_listener.wait_for_message());
+    XdpStatistics stats = transport.get_statistics();
+    EXPECT_GE(stats.tx_packets, 1u);
+    EXPECT_EQ(stats.tx_packets + stats.tx_kernel_path, 2u);
+
+    (void)peer->stop();
+    EXPECT_EQ(transport.stop(), Result::SUCCESS);
+}
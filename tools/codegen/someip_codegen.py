@@ -0,0 +1,837 @@
+#!/usr/bin/env python3
+################################################################################
+# Copyright (c) 2025 Vinicius Tadeu Zein
+#
+# See the NOTICE file(s) distributed with this work for additional
+# information regarding copyright ownership.
+#
+# This program and the accompanying materials are made available under the
+# terms of the Apache License Version 2.0 which is available at
+# https://www.apache.org/licenses/LICENSE-2.0
+#
+# SPDX-License-Identifier: Apache-2.0
+################################################################################
+
+"""
+Generate typed SOME/IP proxies, skeletons and serializers from an interface
+description.
+
+The description is a JSON file with enums, structs and services (methods,
+fire-and-forget methods and events); see tools/codegen/README.md. The output
+is a single header that depends only on the OpenSOMEIP headers:
+
+- one C++ struct per IDL struct, with a wire::Codec specialization whose
+  field offsets and sizes are computed by the generator, and a view class
+  that decodes single members of an encoded struct on demand
+- per service, a struct of IDs, a proxy wrapping rpc::RpcClient and a
+  skeleton base class that registers typed handlers with rpc::RpcServer
+
+Exit codes:
+- 0: Header written
+- 1: Invalid interface description
+"""
+
+import argparse
+import json
+import re
+import sys
+from pathlib import Path
+from typing import Dict, List, Optional, Tuple
+
+COPYRIGHT = """/********************************************************************************
+ * Generated by tools/codegen/someip_codegen.py from {source}. Do not edit.
+ ********************************************************************************/
+"""
+
+# IDL name -> (C++ type, wire size)
+PRIMITIVES = {
+    "bool": ("bool", 1),
+    "uint8": ("uint8_t", 1),
+    "uint16": ("uint16_t", 2),
+    "uint32": ("uint32_t", 4),
+    "uint64": ("uint64_t", 8),
+    "int8": ("int8_t", 1),
+    "int16": ("int16_t", 2),
+    "int32": ("int32_t", 4),
+    "int64": ("int64_t", 8),
+    "float32": ("float", 4),
+    "float64": ("double", 8),
+}
+
+ENUM_BASES = {"uint8", "uint16", "uint32", "int8", "int16", "int32"}
+
+# Names of locals and parameters in generated methods
+RESERVED_PARAMETERS = {"callback", "input", "offset", "output", "response", "result", "returned", "timeout",
+                       "values"}
+
+IDENTIFIER = re.compile(r"^[A-Za-z_][A-Za-z0-9_]*$")
+ARRAY_SUFFIX = re.compile(r"^(.*)\[(\d*)\]$")
+
+
+class IdlError(Exception):
+    """Raised for an invalid interface description."""
+
+
+class Type:
+    """A resolved IDL type."""
+
+    def __init__(self, cpp: str, fixed_size: int, view: Optional[str] = None):
+        self.cpp = cpp
+        self.fixed_size = fixed_size  # 0 for variable-size types
+        self.view = view  # View class of structs
+
+
+def parse_id(value, what: str, limit: int = 0xFFFF) -> int:
+    """Accept an ID as a number or a decimal/hex string."""
+    if isinstance(value, str):
+        try:
+            value = int(value, 0)
+        except ValueError:
+            raise IdlError(f"{what}: invalid ID '{value}'")
+    if not isinstance(value, int) or value < 0 or value > limit:
+        raise IdlError(f"{what}: ID out of range")
+    return value
+
+
+def check_identifier(name, what: str) -> str:
+    if not isinstance(name, str) or not IDENTIFIER.match(name):
+        raise IdlError(f"{what}: invalid name '{name}'")
+    return name
+
+
+def camel(name: str) -> str:
+    return "".join(part[:1].upper() + part[1:] for part in name.split("_") if part)
+
+
+def upper_snake(name: str) -> str:
+    return re.sub(r"(?<=[a-z0-9])(?=[A-Z])", "_", name).upper()
+
+
+class Generator:
+    """Validates an interface description and renders the header."""
+
+    def __init__(self, idl: dict, source: str):
+        self.idl = idl
+        self.source = source
+        self.types: Dict[str, Type] = {}
+        self.views = set()
+        self.lines: List[str] = []
+
+    # Types ---------------------------------------------------------------
+
+    def resolve(self, name, what: str) -> Type:
+        if not isinstance(name, str):
+            raise IdlError(f"{what}: type must be a string")
+        match = ARRAY_SUFFIX.match(name)
+        if match:
+            element = self.resolve(match.group(1), what)
+            if match.group(2) == "":
+                return Type(f"std::vector<{element.cpp}>", 0)
+            length = int(match.group(2))
+            if length == 0:
+                raise IdlError(f"{what}: fixed arrays need at least one element")
+            return Type(f"std::array<{element.cpp}, {length}>", element.fixed_size * length)
+        if name == "string":
+            return Type("std::string", 0)
+        if name in PRIMITIVES:
+            cpp, size = PRIMITIVES[name]
+            return Type(cpp, size)
+        if name in self.types:
+            return self.types[name]
+        raise IdlError(f"{what}: unknown type '{name}' (types must be defined before use)")
+
+    def fields(self, entries, what: str) -> List[Tuple[str, Type]]:
+        if not isinstance(entries, list):
+            raise IdlError(f"{what}: expected a list of fields")
+        result = []
+        seen = set()
+        for entry in entries:
+            name = check_identifier(entry.get("name"), what)
+            if name in seen:
+                raise IdlError(f"{what}: duplicate field '{name}'")
+            seen.add(name)
+            result.append((name, self.resolve(entry.get("type"), f"{what}.{name}")))
+        return result
+
+    def define(self, name: str, type_: Type, what: str):
+        if name in self.types or name in PRIMITIVES or name == "string":
+            raise IdlError(f"{what}: '{name}' is already defined")
+        self.types[name] = type_
+
+    # Output --------------------------------------------------------------
+
+    def emit(self, line: str = ""):
+        self.lines.append(line)
+
+    def emit_signature(self, head: str, params: List[str], tail: str = " {"):
+        """Emit a declaration, one parameter per line if it does not fit."""
+        line = f"{head}({', '.join(params)}){tail}"
+        if len(line) <= 110 or len(params) < 2:
+            self.emit(line)
+            return
+        indent = " " * (len(head) - len(head.lstrip()) + len(head.strip()) + 1)
+        self.emit(f"{head}({params[0]},")
+        for param in params[1:-1]:
+            self.emit(f"{indent}{param},")
+        self.emit(f"{indent}{params[-1]}){tail}")
+
+    def generate(self) -> str:
+        package = self.idl.get("package", "")
+        namespaces = [check_identifier(part, "package") for part in package.split(".")] if package else []
+        services = self.idl.get("services", [])
+        has_rpc = bool(services)
+        has_events = any(s.get("events") for s in services)
+
+        guard = "SOMEIP_GENERATED_" + re.sub(r"[^A-Za-z0-9]", "_", Path(self.source).stem).upper() + "_H"
+        self.emit(COPYRIGHT.format(source=Path(self.source).name).rstrip())
+        self.emit()
+        self.emit(f"#ifndef {guard}")
+        self.emit(f"#define {guard}")
+        self.emit()
+        self.emit('#include "serialization/wire_codec.h"')
+        if has_rpc:
+            self.emit('#include "rpc/rpc_client.h"')
+            self.emit('#include "rpc/rpc_server.h"')
+        if has_events:
+            self.emit('#include "events/event_publisher.h"')
+            self.emit('#include "events/event_subscriber.h"')
+        self.emit("#include <array>")
+        self.emit("#include <cstdint>")
+        self.emit("#include <functional>")
+        self.emit("#include <string>")
+        self.emit("#include <vector>")
+        self.emit()
+
+        qualified = "::".join(namespaces)
+        for enum in self.idl.get("enums", []):
+            self.generate_enum(enum, namespaces)
+        for struct in self.idl.get("structs", []):
+            fields = self.generate_struct(struct, namespaces, qualified)
+            name = f"{qualified}::{struct['name']}" if qualified else struct["name"]
+            self.types[struct["name"]] = Type(name,
+                                              sum(t.fixed_size for _, t in fields)
+                                              if all(t.fixed_size for _, t in fields) else 0,
+                                              f"{name}View")
+        service_names = set()
+        for service in services:
+            name = check_identifier(service.get("name"), "service")
+            if name in service_names or name in self.types or name in self.views:
+                raise IdlError(f"service {name}: name is already defined")
+            service_names.add(name)
+            self.generate_service(service, namespaces, qualified)
+
+        self.emit(f"#endif // {guard}")
+        return "\n".join(self.lines) + "\n"
+
+    def open_namespaces(self, namespaces: List[str]):
+        for namespace in namespaces:
+            self.emit(f"namespace {namespace} {{")
+        if namespaces:
+            self.emit()
+
+    def close_namespaces(self, namespaces: List[str]):
+        for namespace in reversed(namespaces):
+            self.emit(f"}} // namespace {namespace}")
+        if namespaces:
+            self.emit()
+
+    def generate_enum(self, enum: dict, namespaces: List[str]):
+        name = check_identifier(enum.get("name"), "enum")
+        what = f"enum {name}"
+        base = enum.get("type", "uint8")
+        if base not in ENUM_BASES:
+            raise IdlError(f"{what}: base type must be one of {', '.join(sorted(ENUM_BASES))}")
+        values = enum.get("values")
+        if not isinstance(values, dict) or not values:
+            raise IdlError(f"{what}: expected a non-empty object of values")
+        cpp_base, size = PRIMITIVES[base]
+        qualified = "::".join(namespaces + [name])
+        self.define(name, Type(qualified, size), what)
+
+        self.open_namespaces(namespaces)
+        self.emit(f"enum class {name} : {cpp_base} {{")
+        items = list(values.items())
+        for index, (label, value) in enumerate(items):
+            check_identifier(label, what)
+            separator = "," if index + 1 < len(items) else ""
+            self.emit(f"    {label} = {parse_id(value, f'{what}.{label}', 0xFFFFFFFF)}{separator}")
+        self.emit("};")
+        self.emit()
+        self.close_namespaces(namespaces)
+
+    def generate_struct(self, struct: dict, namespaces: List[str], qualified_ns: str) -> List[Tuple[str, Type]]:
+        name = check_identifier(struct.get("name"), "struct")
+        what = f"struct {name}"
+        if name in self.types or name in PRIMITIVES or name in self.views:
+            raise IdlError(f"{what}: '{name}' is already defined")
+        self.views.add(f"{name}View")
+        fields = self.fields(struct.get("fields", []), what)
+        if not fields:
+            raise IdlError(f"{what}: needs at least one field")
+        qualified = f"{qualified_ns}::{name}" if qualified_ns else name
+        fixed = all(t.fixed_size for _, t in fields)
+
+        self.open_namespaces(namespaces)
+        self.emit(f"struct {name} {{")
+        for field, type_ in fields:
+            self.emit(f"    {type_.cpp} {field}{{}};")
+        self.emit()
+        comparisons = [f"{field} == other.{field}" for field, _ in fields]
+        self.emit(f"    bool operator==(const {name}& other) const {{")
+        if len(" && ".join(comparisons)) <= 90:
+            self.emit(f"        return {' && '.join(comparisons)};")
+        else:
+            for index, comparison in enumerate(comparisons):
+                prefix = "        return " if index == 0 else "               "
+                suffix = ";" if index + 1 == len(comparisons) else " &&"
+                self.emit(f"{prefix}{comparison}{suffix}")
+        self.emit("    }")
+        self.emit(f"    bool operator!=(const {name}& other) const {{ return !(*this == other); }}")
+        self.emit("};")
+        self.emit()
+        self.close_namespaces(namespaces)
+
+        self.emit("template <>")
+        self.emit(f"struct someip::serialization::wire::Codec<{qualified}> {{")
+        if fixed:
+            self.generate_fixed_codec(qualified, fields)
+        else:
+            self.generate_variable_codec(qualified, fields)
+        self.emit("};")
+        self.emit()
+
+        self.open_namespaces(namespaces)
+        self.generate_view(name, fields)
+        self.close_namespaces(namespaces)
+        return fields
+
+    def generate_fixed_codec(self, qualified: str, fields: List[Tuple[str, Type]]):
+        size = sum(t.fixed_size for _, t in fields)
+        self.emit(f"    static constexpr size_t FIXED_SIZE = {size};")
+        self.emit()
+        self.emit(f"    static void encode_fixed(uint8_t* out, const {qualified}& value) {{")
+        offset = 0
+        for field, type_ in fields:
+            self.emit(f"        Codec<{type_.cpp}>::encode_fixed(out + {offset}, value.{field});")
+            offset += type_.fixed_size
+        self.emit("    }")
+        self.emit()
+        self.emit(f"    static void decode_fixed(const uint8_t* in, {qualified}& value) {{")
+        offset = 0
+        for field, type_ in fields:
+            self.emit(f"        Codec<{type_.cpp}>::decode_fixed(in + {offset}, value.{field});")
+            offset += type_.fixed_size
+        self.emit("    }")
+
+    @staticmethod
+    def runs(fields: List[Tuple[str, Type]]) -> List[List[Tuple[str, Type]]]:
+        """Group consecutive fixed-size fields so they share one bounds check."""
+        groups: List[List[Tuple[str, Type]]] = []
+        for field in fields:
+            if field[1].fixed_size and groups and groups[-1][0][1].fixed_size:
+                groups[-1].append(field)
+            else:
+                groups.append([field])
+        return groups
+
+    def generate_variable_codec(self, qualified: str, fields: List[Tuple[str, Type]]):
+        groups = self.runs(fields)
+        self.emit("    static constexpr size_t FIXED_SIZE = 0;")
+        self.emit()
+        self.emit(f"    static size_t end(size_t pos, const {qualified}& value) {{")
+        for group in groups:
+            if group[0][1].fixed_size:
+                self.emit(f"        pos += {sum(t.fixed_size for _, t in group)};")
+            else:
+                self.emit(f"        pos = wire::encoded_end(pos, value.{group[0][0]});")
+        self.emit("        return pos;")
+        self.emit("    }")
+        self.emit()
+
+        self.emit(f"    static void encode(uint8_t* out, size_t& pos, const {qualified}& value) {{")
+        for group in groups:
+            if group[0][1].fixed_size:
+                offset = 0
+                for field, type_ in group:
+                    self.emit(f"        Codec<{type_.cpp}>::encode_fixed(out + pos + {offset}, value.{field});")
+                    offset += type_.fixed_size
+                self.emit(f"        pos += {offset};")
+            else:
+                self.emit(f"        wire::encode(out, pos, value.{group[0][0]});")
+        self.emit("    }")
+        self.emit()
+
+        self.emit(f"    static bool decode(const uint8_t* in, size_t& pos, size_t end, {qualified}& value) {{")
+        for group in groups:
+            if group[0][1].fixed_size:
+                run = sum(t.fixed_size for _, t in group)
+                self.emit(f"        if (end - pos < {run}) {{")
+                self.emit("            return false;")
+                self.emit("        }")
+                offset = 0
+                for field, type_ in group:
+                    self.emit(f"        Codec<{type_.cpp}>::decode_fixed(in + pos + {offset}, value.{field});")
+                    offset += type_.fixed_size
+                self.emit(f"        pos += {run};")
+            else:
+                self.emit(f"        if (!wire::decode(in, pos, end, value.{group[0][0]})) {{")
+                self.emit("            return false;")
+                self.emit("        }")
+        self.emit("        return true;")
+        self.emit("    }")
+        self.emit()
+
+        self.emit("    static bool skip(const uint8_t* in, size_t& pos, size_t end) {")
+        self.emit_skips(groups, "in")
+        self.emit("        return true;")
+        self.emit("    }")
+
+    def emit_skips(self, groups: List[List[Tuple[str, Type]]], data: str, record: Optional[str] = None):
+        """Advance pos past each group, reading only length fields."""
+        for index, group in enumerate(groups):
+            if group[0][1].fixed_size:
+                run = sum(t.fixed_size for _, t in group)
+                self.emit(f"        if (end - pos < {run}) {{")
+                self.emit("            return false;")
+                self.emit("        }")
+                self.emit(f"        pos += {run};")
+            else:
+                self.emit(f"        if (!someip::serialization::wire::skip<{group[0][1].cpp}>({data}, pos, end)) {{")
+                self.emit("            return false;")
+                self.emit("        }")
+            if record:
+                self.emit(f"        {record}[{index + 1}] = pos;")
+
+    def generate_view(self, name: str, fields: List[Tuple[str, Type]]):
+        groups = self.runs(fields)
+        self.emit("/**")
+        self.emit(f" * @brief Lazily decoded {name}")
+        self.emit(" *")
+        self.emit(" * parse() reads only the length fields and records where each member")
+        self.emit(" * starts; members are decoded when they are read. The viewed bytes must")
+        self.emit(" * outlive the view, and members may only be read after parse() succeeded.")
+        self.emit(" */")
+        self.emit(f"class {name}View {{")
+        self.emit("public:")
+        self.emit("    /**")
+        self.emit(f"     * @brief Index a {name} encoded at data + pos, not reading at or past end")
+        self.emit("     * @return false if the data is truncated")
+        self.emit("     */")
+        self.emit("    bool parse(const uint8_t* data, size_t end, size_t pos = 0) {")
+        self.emit("        data_ = data;")
+        self.emit("        offsets_[0] = pos;")
+        self.emit_skips(groups, "data", "offsets_")
+        self.emit("        return true;")
+        self.emit("    }")
+        self.emit()
+        self.emit("    /**")
+        self.emit(f"     * @brief Offset after the {name}")
+        self.emit("     */")
+        self.emit(f"    size_t end() const {{ return offsets_[{len(groups)}]; }}")
+        self.emit()
+        self.emit("    /**")
+        self.emit("     * @brief Decode all members")
+        self.emit("     */")
+        self.emit(f"    bool decode({name}& value) const {{")
+        self.emit("        size_t pos = offsets_[0];")
+        self.emit("        return someip::serialization::wire::decode(data_, pos, end(), value);")
+        self.emit("    }")
+        for index, group in enumerate(groups):
+            offset = 0
+            for field, type_ in group:
+                self.emit()
+                if type_.fixed_size:
+                    at = f"offsets_[{index}] + {offset}" if offset else f"offsets_[{index}]"
+                    self.emit(f"    {type_.cpp} get_{field}() const {{")
+                    self.emit(f"        {type_.cpp} value{{}};")
+                    self.emit(f"        someip::serialization::wire::Codec<{type_.cpp}>::decode_fixed(data_ + {at}, value);")
+                    self.emit("        return value;")
+                    self.emit("    }")
+                    offset += type_.fixed_size
+                    continue
+                self.emit(f"    bool get_{field}({type_.cpp}& value) const {{")
+                self.emit(f"        size_t pos = offsets_[{index}];")
+                self.emit(f"        return someip::serialization::wire::decode(data_, pos, offsets_[{index + 1}], value);")
+                self.emit("    }")
+                if type_.view:
+                    self.emit()
+                    self.emit(f"    bool view_{field}({type_.view}& view) const {{")
+                    self.emit(f"        return view.parse(data_, offsets_[{index + 1}], offsets_[{index}]);")
+                    self.emit("    }")
+        self.emit()
+        self.emit("private:")
+        self.emit("    const uint8_t* data_{nullptr};")
+        self.emit(f"    std::array<size_t, {len(groups) + 1}> offsets_{{}};")
+        self.emit("};")
+        self.emit()
+
+    # Services ------------------------------------------------------------
+
+    def generate_service(self, service: dict, namespaces: List[str], qualified_ns: str):
+        name = service["name"]
+        what = f"service {name}"
+        service_id = parse_id(service.get("id"), what)
+        major = parse_id(service.get("major", 1), f"{what}.major", 0xFF)
+        minor = parse_id(service.get("minor", 0), f"{what}.minor", 0xFFFFFFFF)
+
+        methods = []
+        lazy = set()
+        used_ids = {}
+        used_names = set()
+        for method in service.get("methods", []):
+            method_name = check_identifier(method.get("name"), f"{what} method")
+            method_what = f"{what}.{method_name}"
+            method_id = parse_id(method.get("id"), method_what, 0x7FFF)
+            fire_and_forget = bool(method.get("fire_and_forget", False))
+            if method.get("lazy", False):
+                lazy.add(method_name)
+            inputs = self.fields(method.get("in", []), f"{method_what}.in")
+            outputs = self.fields(method.get("out", []), f"{method_what}.out")
+            if fire_and_forget and outputs:
+                raise IdlError(f"{method_what}: fire-and-forget methods have no out parameters")
+            reserved = {n for n, _ in inputs + outputs} & RESERVED_PARAMETERS
+            if reserved:
+                raise IdlError(f"{method_what}: parameter names {sorted(reserved)} are used by the generated code")
+            if {n for n, _ in inputs} & {n for n, _ in outputs}:
+                raise IdlError(f"{method_what}: in and out parameters must have different names")
+            if method_name in lazy and not any(t.view for _, t in inputs):
+                raise IdlError(f"{method_what}: lazy methods need a struct in parameter")
+            methods.append((method_name, method_id, fire_and_forget, inputs, outputs))
+            self.claim(used_ids, used_names, method_id, method_name, method_what)
+
+        events = []
+        for event in service.get("events", []):
+            event_name = check_identifier(event.get("name"), f"{what} event")
+            event_what = f"{what}.{event_name}"
+            event_id = parse_id(event.get("id"), event_what)
+            if event_id < 0x8000:
+                raise IdlError(f"{event_what}: event IDs start at 0x8000")
+            eventgroup = parse_id(event.get("eventgroup", 1), f"{event_what}.eventgroup")
+            type_ = self.resolve(event.get("type"), event_what)
+            events.append((event_name, event_id, eventgroup, bool(event.get("field", False)), type_))
+            self.claim(used_ids, used_names, event_id, event_name, event_what)
+
+        self.open_namespaces(namespaces)
+        self.generate_ids(name, service_id, major, minor, methods, events)
+        self.generate_proxy(name, methods, events)
+        self.generate_skeleton(name, methods, events, lazy)
+        self.close_namespaces(namespaces)
+
+    @staticmethod
+    def claim(used_ids: dict, used_names: set, id_: int, name: str, what: str):
+        if id_ in used_ids:
+            raise IdlError(f"{what}: ID 0x{id_:04X} is already used by {used_ids[id_]}")
+        if name in used_names:
+            raise IdlError(f"{what}: name is already used")
+        used_ids[id_] = name
+        used_names.add(name)
+
+    def generate_ids(self, name, service_id, major, minor, methods, events):
+        self.emit("/**")
+        self.emit(f" * @brief IDs and response types of service {name}")
+        self.emit(" */")
+        self.emit(f"struct {name} {{")
+        self.emit(f"    static constexpr uint16_t SERVICE_ID = 0x{service_id:04X};")
+        self.emit(f"    static constexpr uint8_t MAJOR_VERSION = {major};")
+        self.emit(f"    static constexpr uint32_t MINOR_VERSION = {minor};")
+        for method_name, method_id, _, _, _ in methods:
+            self.emit(f"    static constexpr someip::rpc::MethodId {upper_snake(method_name)} = 0x{method_id:04X};")
+        for event_name, event_id, eventgroup, _, _ in events:
+            constant = upper_snake(event_name)
+            self.emit(f"    static constexpr uint16_t {constant} = 0x{event_id:04X};")
+            self.emit(f"    static constexpr uint16_t {constant}_EVENTGROUP = 0x{eventgroup:04X};")
+        for method_name, _, fire_and_forget, _, outputs in methods:
+            if fire_and_forget:
+                continue
+            self.emit()
+            if outputs:
+                self.emit(f"    struct {camel(method_name)}Response {{")
+                for field, type_ in outputs:
+                    self.emit(f"        {type_.cpp} {field}{{}};")
+                self.emit("    };")
+                self.emit(f"    using {camel(method_name)}Callback = "
+                          f"std::function<void(someip::rpc::RpcResult, const {camel(method_name)}Response&)>;")
+            else:
+                self.emit(f"    using {camel(method_name)}Callback = std::function<void(someip::rpc::RpcResult)>;")
+        self.emit("};")
+        self.emit()
+
+    @staticmethod
+    def parameter(type_: Type, name: str, output: bool = False) -> str:
+        if output:
+            return f"{type_.cpp}& {name}"
+        if type_.cpp in (t for t, _ in PRIMITIVES.values()):
+            return f"{type_.cpp} {name}"
+        return f"const {type_.cpp}& {name}"
+
+    def input_parameter(self, type_: Type, name: str, lazy: bool) -> str:
+        if lazy and type_.view:
+            return f"const {type_.view}& {name}"
+        return self.parameter(type_, name)
+
+    def generate_proxy(self, name, methods, events):
+        self.emit("/**")
+        self.emit(f" * @brief Typed client of service {name}")
+        self.emit(" *")
+        self.emit(" * Encodes arguments and decodes results with the generated codecs; a")
+        self.emit(" * response that does not decode completes with RpcResult::INTERNAL_ERROR.")
+        self.emit(" */")
+        self.emit(f"class {name}Proxy {{")
+        self.emit("public:")
+        self.emit(f"    explicit {name}Proxy(someip::rpc::RpcClient& client) : client_(client) {{}}")
+        for method_name, _, fire_and_forget, inputs, outputs in methods:
+            constant = f"{name}::{upper_snake(method_name)}"
+            args = ", ".join(n for n, _ in inputs)
+            in_params = [self.parameter(t, n) for n, t in inputs]
+            self.emit()
+            if fire_and_forget:
+                self.emit("    /**")
+                self.emit(f"     * @brief Send {method_name} without waiting for a response")
+                self.emit("     */")
+                self.emit_signature(f"    bool {method_name}", in_params)
+                self.emit(f"        return client_.send_request_no_return({name}::SERVICE_ID, {constant},")
+                self.emit(f"                                              someip::serialization::wire::encode_payload({args}));")
+                self.emit("    }")
+                continue
+
+            timeout = "const someip::rpc::RpcTimeout& timeout = someip::rpc::RpcTimeout()"
+            params = in_params + [self.parameter(t, n, True) for n, t in outputs] + [timeout]
+            self.emit("    /**")
+            self.emit(f"     * @brief Call {method_name} and wait for the result")
+            self.emit("     */")
+            self.emit_signature(f"    someip::rpc::RpcResult {method_name}", params)
+            self.emit(f"        auto response = client_.call_method_sync({name}::SERVICE_ID, {constant},")
+            self.emit(f"                                                 someip::serialization::wire::encode_payload({args}), timeout);")
+            if outputs:
+                outs = ", ".join(n for n, _ in outputs)
+                self.emit("        const auto& values = response.return_values;")
+                self.emit("        if (response.result == someip::rpc::RpcResult::SUCCESS &&")
+                self.emit(f"            !someip::serialization::wire::decode_payload(values.data(), values.size(), {outs})) {{")
+                self.emit("            return someip::rpc::RpcResult::INTERNAL_ERROR;")
+                self.emit("        }")
+            self.emit("        return response.result;")
+            self.emit("    }")
+
+            self.emit()
+            self.emit("    /**")
+            self.emit(f"     * @brief Call {method_name}; the callback runs on the client's receive thread")
+            self.emit("     */")
+            response_type = f"{name}::{camel(method_name)}Response"
+            callback = f"{name}::{camel(method_name)}Callback"
+            async_params = in_params + [f"{callback} callback", timeout]
+            self.emit_signature(f"    someip::rpc::RpcCallHandle {method_name}_async", async_params)
+            self.emit(f"        return client_.call_method_async(")
+            self.emit(f"            {name}::SERVICE_ID, {constant}, someip::serialization::wire::encode_payload({args}),")
+            self.emit("            [callback = std::move(callback)](const someip::rpc::RpcResponse& response) {")
+            if outputs:
+                fields = ", ".join(f"values.{n}" for n, _ in outputs)
+                self.emit(f"                {response_type} values;")
+                self.emit("                someip::rpc::RpcResult result = response.result;")
+                self.emit("                const auto& returned = response.return_values;")
+                self.emit("                if (result == someip::rpc::RpcResult::SUCCESS &&")
+                self.emit("                    !someip::serialization::wire::decode_payload(returned.data(), returned.size(),")
+                self.emit(f"                                                                 {fields})) {{")
+                self.emit("                    result = someip::rpc::RpcResult::INTERNAL_ERROR;")
+                self.emit("                }")
+                self.emit("                callback(result, values);")
+            else:
+                self.emit("                callback(response.result);")
+            self.emit("            }, timeout);")
+            self.emit("    }")
+
+        for event_name, _, _, _, type_ in events:
+            constant = f"{name}::{upper_snake(event_name)}"
+            self.emit()
+            self.emit("    /**")
+            self.emit(f"     * @brief Subscribe to {event_name} through its eventgroup")
+            self.emit("     *")
+            self.emit("     * Other events of the eventgroup are ignored by this subscription.")
+            self.emit("     */")
+            self.emit_signature(f"    static bool subscribe_{event_name}",
+                                ["someip::events::EventSubscriber& subscriber", "uint16_t instance_id",
+                                 f"std::function<void(const {type_.cpp}&)> handler"])
+            self.emit("        return subscriber.subscribe_eventgroup(")
+            self.emit(f"            {name}::SERVICE_ID, instance_id, {constant}_EVENTGROUP,")
+            self.emit("            [handler = std::move(handler)](const someip::events::EventNotification& notification) {")
+            self.emit(f"                {type_.cpp} value{{}};")
+            self.emit("                const auto& data = notification.event_data;")
+            self.emit(f"                if (notification.event_id == {constant} &&")
+            self.emit("                    someip::serialization::wire::decode_payload(data.data(), data.size(), value)) {")
+            self.emit("                    handler(value);")
+            self.emit("                }")
+            self.emit("            });")
+            self.emit("    }")
+
+        self.emit()
+        self.emit("private:")
+        self.emit("    someip::rpc::RpcClient& client_;")
+        self.emit("};")
+        self.emit()
+
+    def generate_skeleton(self, name, methods, events, lazy):
+        self.emit("/**")
+        self.emit(f" * @brief Typed server base of service {name}")
+        self.emit(" *")
+        self.emit(" * Implement the methods and attach() the skeleton to an RpcServer of")
+        self.emit(f" * {name}::SERVICE_ID. Requests that do not decode are answered with")
+        self.emit(" * RpcResult::INVALID_PARAMETERS without calling the implementation.")
+        self.emit(" * Lazy methods receive struct parameters as views, which are only")
+        self.emit(" * indexed, so members the implementation does not read are never decoded.")
+        self.emit(" */")
+        self.emit(f"class {name}Skeleton {{")
+        self.emit("public:")
+        self.emit(f"    virtual ~{name}Skeleton() = default;")
+        for method_name, _, fire_and_forget, inputs, outputs in methods:
+            params = [self.input_parameter(t, n, method_name in lazy) for n, t in inputs]
+            params += [self.parameter(t, n, True) for n, t in outputs]
+            self.emit()
+            if fire_and_forget:
+                self.emit_signature(f"    virtual void {method_name}", params, " = 0;")
+            else:
+                self.emit_signature(f"    virtual someip::rpc::RpcResult {method_name}", params, " = 0;")
+
+        self.emit()
+        self.emit("    /**")
+        self.emit("     * @brief Register a handler per method")
+        self.emit("     * @return false if a method is already registered on the server")
+        self.emit("     */")
+        self.emit("    bool attach(someip::rpc::RpcServer& server) {")
+        if not methods:
+            self.emit("        (void)server;")
+        self.emit("        bool attached = true;")
+        for method_name, _, _, _, _ in methods:
+            self.emit(f"        attached = server.register_method({name}::{upper_snake(method_name)},")
+            self.emit("            [this](uint16_t, uint16_t, someip::PayloadView input, std::vector<uint8_t>& output) {")
+            self.emit(f"                return handle_{method_name}(input, output);")
+            self.emit("            }) && attached;")
+        self.emit("        return attached;")
+        self.emit("    }")
+
+        self.emit()
+        self.emit("    /**")
+        self.emit("     * @brief Handle a request without an RpcServer")
+        self.emit("     */")
+        self.emit("    someip::rpc::RpcResult dispatch(someip::rpc::MethodId method_id, someip::PayloadView input,")
+        self.emit("                                    std::vector<uint8_t>& output) {")
+        self.emit("        switch (method_id) {")
+        for method_name, _, _, _, _ in methods:
+            self.emit(f"        case {name}::{upper_snake(method_name)}:")
+            self.emit(f"            return handle_{method_name}(input, output);")
+        self.emit("        default:")
+        self.emit("            (void)input;")
+        self.emit("            (void)output;")
+        self.emit("            return someip::rpc::RpcResult::METHOD_NOT_FOUND;")
+        self.emit("        }")
+        self.emit("    }")
+
+        if events:
+            self.emit()
+            self.emit("    /**")
+            self.emit("     * @brief Register the service's events with a publisher")
+            self.emit("     */")
+            self.emit("    static bool register_events(someip::events::EventPublisher& publisher) {")
+            self.emit("        bool registered = true;")
+            for event_name, _, _, is_field, _ in events:
+                constant = f"{name}::{upper_snake(event_name)}"
+                self.emit("        {")
+                self.emit("            someip::events::EventConfig config;")
+                self.emit(f"            config.event_id = {constant};")
+                self.emit(f"            config.eventgroup_id = {constant}_EVENTGROUP;")
+                self.emit(f"            config.is_field = {'true' if is_field else 'false'};")
+                self.emit(f'            config.event_name = "{event_name}";')
+                self.emit("            registered = publisher.register_event(config) && registered;")
+                self.emit("        }")
+            self.emit("        return registered;")
+            self.emit("    }")
+            for event_name, _, _, is_field, type_ in events:
+                constant = f"{name}::{upper_snake(event_name)}"
+                publish = "publish_field" if is_field else "publish_event"
+                self.emit()
+                self.emit_signature(f"    static bool publish_{event_name}",
+                                    ["someip::events::EventPublisher& publisher", self.parameter(type_, "value")])
+                self.emit(f"        return publisher.{publish}({constant},")
+                self.emit("                                 someip::serialization::wire::encode_payload(value));")
+                self.emit("    }")
+
+        self.emit()
+        self.emit("private:")
+        for method_name, _, fire_and_forget, inputs, outputs in methods:
+            self.emit(f"    someip::rpc::RpcResult handle_{method_name}(someip::PayloadView input, "
+                      "std::vector<uint8_t>& output) {")
+            for field, type_ in inputs + outputs:
+                if method_name in lazy and type_.view and (field, type_) in inputs:
+                    self.emit(f"        {type_.view} {field};")
+                else:
+                    self.emit(f"        {type_.cpp} {field}{{}};")
+            ins = ", ".join(n for n, _ in inputs)
+            if method_name in lazy:
+                self.emit("        size_t offset = 0;")
+                for field, type_ in inputs:
+                    if type_.view:
+                        self.emit(f"        if (!{field}.parse(input.data(), input.size(), offset)) {{")
+                    else:
+                        self.emit("        if (!someip::serialization::wire::decode(input.data(), offset, input.size(), "
+                                  f"{field})) {{")
+                    self.emit("            return someip::rpc::RpcResult::INVALID_PARAMETERS;")
+                    self.emit("        }")
+                    if type_.view:
+                        self.emit(f"        offset = {field}.end();")
+            elif inputs:
+                self.emit(f"        if (!someip::serialization::wire::decode_payload(input.data(), input.size(), {ins})) {{")
+                self.emit("            return someip::rpc::RpcResult::INVALID_PARAMETERS;")
+                self.emit("        }")
+            else:
+                self.emit("        (void)input;")
+            call_args = ", ".join(n for n, _ in inputs + outputs)
+            if fire_and_forget:
+                self.emit(f"        {method_name}({call_args});")
+                self.emit("        (void)output;")
+                self.emit("        return someip::rpc::RpcResult::SUCCESS;")
+            else:
+                self.emit(f"        someip::rpc::RpcResult result = {method_name}({call_args});")
+                self.emit("        if (result == someip::rpc::RpcResult::SUCCESS) {")
+                self.emit(f"            output = someip::serialization::wire::encode_payload({', '.join(n for n, _ in outputs)});")
+                self.emit("        }")
+                self.emit("        return result;")
+            self.emit("    }")
+            if method_name != methods[-1][0]:
+                self.emit()
+        self.emit("};")
+        self.emit()
+
+
+def generate(idl_path: Path) -> str:
+    with open(idl_path, encoding="utf-8") as stream:
+        try:
+            idl = json.load(stream)
+        except json.JSONDecodeError as error:
+            raise IdlError(f"{idl_path}: {error}")
+    if not isinstance(idl, dict):
+        raise IdlError(f"{idl_path}: expected an object at the top level")
+    return Generator(idl, str(idl_path)).generate()
+
+
+def main(argv: Optional[List[str]] = None) -> int:
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("idl", type=Path, help="Interface description (JSON)")
+    parser.add_argument("-o", "--output", type=Path, help="Header to write (default: stdout)")
+    args = parser.parse_args(argv)
+
+    try:
+        header = generate(args.idl)
+    except (IdlError, OSError) as error:
+        print(f"error: {error}", file=sys.stderr)
+        return 1
+
+    if args.output:
+        args.output.parent.mkdir(parents=True, exist_ok=True)
+        # Leave an unchanged header alone so dependents are not rebuilt
+        if not args.output.exists() or args.output.read_text(encoding="utf-8") != header:
+            args.output.write_text(header, encoding="utf-8")
+    else:
+        sys.stdout.write(header)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())